@@ -6,6 +6,7 @@
 #pragma once
 
 #define UnitSphereRadius 1.0
+#define TwoPi 6.28318530718
 
 // Acceleration structure against which to trace rays.
 RaytracingAccelerationStructure Scene : register(t0, space0);
@@ -13,8 +14,9 @@ RaytracingAccelerationStructure Scene : register(t0, space0);
 // Render target of type UAV RW2DTexture.
 RWTexture2D<unorm float4> RenderTarget : register(u0);
 
-// Random Number Buffer of type UAV.
-RWBuffer<float> RandomNumberBuffer : register(u1);
+// Sums of the colors (xyz) and squared luminances (w) of the rays traced so far, for progressive rendering. Render target of type UAV RW2DTexture.
+// A negative w marks a pixel that adaptive sampling has stopped tracing.
+RWTexture2D<float4> AccumulationBuffer : register(u1);
 
 // Global "Constant Buffer" structure to pass all of the individual constants together.
 struct InlineConstantBuffer
@@ -28,39 +30,70 @@ struct InlineConstantBuffer
 	// "Sky Color" at the bottom of the sky.
 	float4 SkyBottomColor;
 
-	// Number of Random Floats.
-	uint RandomFloatCount;
-	float3 Pad01;
+	// Seed for the random numbers, so that different frames can get different ones.
+	uint RandomSeed;
+
+	// Generator of the random numbers. (SamplerTypeRandom or SamplerTypeSobol.)
+	uint SamplerType;
+
+	// Index of the first sample of this pass, within each pixel. The rays of a pass are added to the accumulation buffer, unless this is 0.
+	uint FirstSampleIndex;
+
+	// Standard error of a pixel's mean luminance below which it stops being traced, for adaptive sampling across passes. (0.0 traces every pixel with every pass.)
+	float AdaptiveThreshold;
 
 	// Vertical Field of View, in Radians.
 	float VertFoVRad;
 
-	// Max Recursion Depth.
-	uint MaxRecursionDepth;
+	// Max number of rays traced along a path: the camera ray, then one per bounce.
+	uint MaxPathDepth;
 
-	// Number of Rays per pixel.
+	// Number of rays a path traces before Russian roulette may end it. (0 traces every path until it misses, or reaches MaxPathDepth.)
+	uint RouletteMinDepth;
+
+	// Number of Rays per pixel, in this pass.
 	uint RaysPerPixel;
-	   	
-	// For Lambertian Light Attenuation.
-	float LambertianAttenuationValue;
 };
 
 ConstantBuffer<InlineConstantBuffer> Constants : register(b0);
 
-// Ray payload for the main/only rays.
+// Parameters of an instance's material, matching SceneMaterial in SceneDescription.hpp. (32 bytes.)
+struct Material
+{
+	float3 Albedo;
+	float Roughness;
+
+	// Radiance the surface emits, which gets added to every path that hits it, whatever its hit group.
+	float3 Emission;
+	float IndexOfRefraction;
+};
+
+// Material table, one material per instance, indexed by InstanceIndex(). Uploaded once, along with the scene.
+StructuredBuffer<Material> Materials : register(t1, space0);
+
+// Ray payload for the main/only rays. It carries a path from one bounce to the next, as the Ray Generation shader traces them in a loop.
 struct RayPayload
 {
-	// Final color "collected" by this Ray, to be calculated in the Miss and/or Closest Hit Shader.
-	float3 Color;
+	// Product of the attenuations of the surfaces the path has bounced off so far, to be scaled by each Closest-Hit shader.
+	float3 Throughput;
+
+	// Light the path has picked up from the emissive surfaces it hit, each one weighted by the throughput the path had when it got there.
+	float3 Radiance;
+
+	// Origin in World-Space of the path's next ray, from the Closest-Hit shader: the hit, or wherever the ray left the surface after going through it.
+	float3 WorldScatterOrigin;
+
+	// Direction in World-Space of the path's next ray, from the Closest-Hit shader.
+	float3 WorldScatterDirection;
 
-	// Last scattering direction in World-Space.
-	float3 WorldLastScatterDirection;
+	// Distance along the ray to its hit, from the Closest-Hit shader. The Miss shaders set it negative, to end the path.
+	float HitT;
 
-	// Tracker for number of times this ray has intersected something.
+	// Tracker for number of times this path has intersected something.
 	uint IntersectionCount;
-	
-	// Tracker for number of times this ray has been traced, for limiting recursion depth. Increment this before each TraceRay() call.
-	uint RecursionDepth;
+
+	// Index of the camera ray within its pixel, which picks the sample of each of its random dimensions. (See GetSample3D().)
+	uint SampleIndex;
 };
 
 // Intersection attributes.
@@ -79,6 +112,16 @@ enum HitTypes
 	SphereHit = 0
 };
 
+// Generators for the random numbers of camera rays and their bounces.
+static const uint SamplerTypeRandom = 0;
+static const uint SamplerTypeSobol = 1;
+
+// Samples a pixel needs before adaptive sampling may consider it converged.
+static const uint AdaptiveMinSampleCount = 16;
+
+// First group of sample dimensions that Russian roulette draws from, past those of every bounce.
+static const uint RouletteSampleGroup = 0x10000;
+
 // Collects the Thread dimensions, as defined while making the DispatchRays() call.
 uint2 GetThreadDimensions()
 {
@@ -100,31 +143,113 @@ float3 GetWorldCameraPosition(float4x4 CameraToWorld)
 	return mul(CameraToWorld, float4(0.0, 0.0, 0.0, 1.0)).xyz;
 }
 
-// Function for wrapping requested index values into the target resource's available range of elements.
-uint GetWrappedIndex(uint RequestedIndex, uint TotalElements)
+// PCG hash (Jarzynski and Olano, "Hash Functions for GPU Rendering"), for generating random numbers from counters rather than reading them from a buffer.
+// NOTE: Must match GetRandomHash() in CPUShaderStuff.hpp, so that both rendering paths get the same numbers.
+uint GetRandomHash(uint Value)
 {
-	uint WrappedIndex = (uint)((uint)RequestedIndex % (uint)TotalElements);
+	uint State = Value * 747796405u + 2891336453u;
+	uint Word = ((State >> ((State >> 28u) + 4u)) ^ State) * 277803737u;
 
-	return WrappedIndex;
+	return (Word >> 22u) ^ Word;
 }
 
-// Calculates random offsets into a pixel (Range [0.0, 1.0]), for jittering ray positions. Uses the Wang Hash function.
-float2 GetPixelOffset(uint CurrentRayWithinPixel)
+// Seed of a pixel's random numbers, from its position and the frame's seed, so that no two pixels share a sequence.
+uint GetPixelSeed(uint2 ThreadId, uint2 ThreadDims, uint RandomSeed)
 {
-	// Generate valid indices for collecting random floats.
-	uint RequestedIndex_x = (CurrentRayWithinPixel - 1) * 2 + 0;
-	uint RequestedIndex_y = (CurrentRayWithinPixel - 1) * 2 + 1;
+	uint PixelIndex = ThreadId.y * ThreadDims.x + ThreadId.x;
+
+	return GetRandomHash(PixelIndex ^ GetRandomHash(RandomSeed));
+}
 
-	uint Index_x = GetWrappedIndex(RequestedIndex_x, Constants.RandomFloatCount);
-	uint Index_y = GetWrappedIndex(RequestedIndex_y, Constants.RandomFloatCount);
+// Float (Range [0.0, 1.0)) from the top 24 bits of a 0.32 fixed-point value, which a float holds exactly.
+float GetUnitFloat(uint Value)
+{
+	return (float)(Value >> 8) * (1.0 / 16777216.0);
+}
 
-	// Generate the pixel offsets.
-	float2 PixelOffset = {0.0, 0.0};
-	
-	PixelOffset.x = 0.5 * RandomNumberBuffer[Index_x] + 0.5;
-	PixelOffset.y = 0.5 * RandomNumberBuffer[Index_y] + 0.5;
-	
-	return PixelOffset;
+// Generator matrices of the second and third Sobol dimensions. (The first one is a bit reversal.)
+// NOTE: Must match SobolDirections in CPUShaderStuff.hpp.
+static const uint SobolDirections[2][32] =
+{
+	{
+		0x80000000u, 0xc0000000u, 0xa0000000u, 0xf0000000u, 0x88000000u, 0xcc000000u, 0xaa000000u, 0xff000000u,
+		0x80800000u, 0xc0c00000u, 0xa0a00000u, 0xf0f00000u, 0x88880000u, 0xcccc0000u, 0xaaaa0000u, 0xffff0000u,
+		0x80008000u, 0xc000c000u, 0xa000a000u, 0xf000f000u, 0x88008800u, 0xcc00cc00u, 0xaa00aa00u, 0xff00ff00u,
+		0x80808080u, 0xc0c0c0c0u, 0xa0a0a0a0u, 0xf0f0f0f0u, 0x88888888u, 0xccccccccu, 0xaaaaaaaau, 0xffffffffu
+	},
+	{
+		0x80000000u, 0xc0000000u, 0x60000000u, 0x90000000u, 0xe8000000u, 0x5c000000u, 0x8e000000u, 0xc5000000u,
+		0x68800000u, 0x9cc00000u, 0xee600000u, 0x55900000u, 0x80680000u, 0xc09c0000u, 0x60ee0000u, 0x90550000u,
+		0xe8808000u, 0x5cc0c000u, 0x8e606000u, 0xc5909000u, 0x6868e800u, 0x9c9c5c00u, 0xeeee8e00u, 0x5555c500u,
+		0x8000e880u, 0xc0005cc0u, 0x60008e60u, 0x9000c590u, 0xe8006868u, 0x5c009c9cu, 0x8e00eeeeu, 0xc5005555u
+	}
+};
+
+// Sobol point of the given index, in one of the first 3 dimensions, as a 0.32 fixed-point value.
+uint GetSobol(uint Index, uint Dimension)
+{
+	if (Dimension == 0)
+	{
+		return reversebits(Index);
+	}
+
+	uint Value = 0;
+
+	// Without a branch on each bit, which would be taken at random.
+	for (uint Bit = 0; Index != 0; Bit++, Index >>= 1)
+	{
+		Value ^= SobolDirections[Dimension - 1][Bit] & (0 - (Index & 1));
+	}
+
+	return Value;
+}
+
+// Nested uniform (Owen) scramble of a 0.32 fixed-point value, using the hash of Burley, "Practical Hash-based Owen Scrambling".
+uint GetOwenScramble(uint Value, uint Seed)
+{
+	Value = reversebits(Value);
+
+	Value += Seed;
+	Value ^= Value * 0x6c50b47cu;
+	Value ^= Value * 0xb82f1e52u;
+	Value ^= Value * 0xc7afe638u;
+	Value ^= Value * 0x8d22f6e6u;
+
+	return reversebits(Value);
+}
+
+// 3D sample (Range [0.0, 1.0)) of one group of dimensions of a camera ray. Group 0 jitters the camera ray, and group N scatters its Nth bounce.
+// With the Sobol sampler, each pixel and group gets its own shuffle and scramble of the same 3D sequence: the samples of a pixel stay stratified, but are decorrelated from those of other pixels and groups.
+float3 GetSample3D(uint PixelSeed, uint SampleIndex, uint Group, uint SamplerType)
+{
+	uint GroupSeed = GetRandomHash(PixelSeed ^ GetRandomHash(Group));
+
+	float3 Sample;
+
+	if (SamplerType == SamplerTypeSobol)
+	{
+		uint ShuffledIndex = GetOwenScramble(SampleIndex, GroupSeed);
+
+		Sample.x = GetUnitFloat(GetOwenScramble(GetSobol(ShuffledIndex, 0), GetRandomHash(GroupSeed + 0)));
+		Sample.y = GetUnitFloat(GetOwenScramble(GetSobol(ShuffledIndex, 1), GetRandomHash(GroupSeed + 1)));
+		Sample.z = GetUnitFloat(GetOwenScramble(GetSobol(ShuffledIndex, 2), GetRandomHash(GroupSeed + 2)));
+	}
+	else
+	{
+		uint SampleSeed = GetRandomHash(GroupSeed ^ GetRandomHash(SampleIndex));
+
+		Sample.x = GetUnitFloat(GetRandomHash(SampleSeed + 0));
+		Sample.y = GetUnitFloat(GetRandomHash(SampleSeed + 1));
+		Sample.z = GetUnitFloat(GetRandomHash(SampleSeed + 2));
+	}
+
+	return Sample;
+}
+
+// Calculates random offsets into a pixel (Range [0.0, 1.0)), for jittering ray positions.
+float2 GetPixelOffset(uint PixelSeed, uint SampleIndex, uint SamplerType)
+{
+	return GetSample3D(PixelSeed, SampleIndex, 0, SamplerType).xy;
 }
 
 // Calculates a Point's position in World-Space, using a Camera-to-World transform and some other values. Used for generating Camera-Ray directions.
@@ -153,6 +278,26 @@ float3 GetColorValue(float3 SkyTopColor, float3 SkyBottomColor, float3 WorldRayD
 	return ColorValue;
 }
 
+// Rec. 709 luminance of a color, for estimating the noise of a pixel.
+float GetLuminance(float3 Color)
+{
+	return dot(Color, float3(0.2126, 0.7152, 0.0722));
+}
+
+// Checks whether the standard error of a pixel's mean luminance has dropped below the threshold, from the sums of the luminances and squared luminances of its samples.
+bool GetPixelConverged(float LuminanceSum, float LuminanceSquaredSum, uint SampleCount, float Threshold)
+{
+	if (Threshold <= 0.0 || SampleCount < AdaptiveMinSampleCount)
+	{
+		return false;
+	}
+
+	float Mean = LuminanceSum / (float)SampleCount;
+	float Variance = max((LuminanceSquaredSum / (float)SampleCount) - (Mean * Mean), 0.0) * ((float)SampleCount / (float)(SampleCount - 1));
+
+	return sqrt(Variance / (float)SampleCount) <= Threshold;
+}
+
 // Function for checking the number of solutions to the Sphere's "Intersection Quadratic".
 float GetIntersectionCount()
 {
@@ -171,6 +316,24 @@ float GetIntersectionCount()
 	return Discriminant;
 }
 
+// Function for calculating the distance along the Ray to where it enters the Sphere. (Rays leaving the Sphere's surface have it behind them, so that they never hit the Sphere they scattered off of.)
+float GetIntersectionDistance()
+{
+	// 'a' from the quadratic formula.
+	float a = dot(ObjectRayDirection(), ObjectRayDirection());
+	
+	// 'b' from the quadratic formula.
+	float3 ObjectSphereCenter = {0.0, 0.0, 0.0};
+	float b = 2.0 * dot(ObjectRayDirection(), (ObjectRayOrigin() - ObjectSphereCenter));
+
+	// 'c' from the quadratic formula.
+	float c = dot((ObjectRayOrigin() - ObjectSphereCenter), (ObjectRayOrigin() - ObjectSphereCenter)) - (UnitSphereRadius * UnitSphereRadius);
+
+	float Discriminant = (b * b) - (4 * a * c);
+	
+	return (-b - sqrt(Discriminant)) / (2.0 * a);
+}
+
 // Function for calculating the position of the Sphere intersection, in World-Space.
 float3 GetWorldIntersectionPoint()
 {
@@ -246,23 +409,86 @@ float3 GetObjectSurfaceNormal(float3 ObjectIntersectionPoint)
 	return ObjectSurfaceNormal;
 }
 
-// Function for calculating a "random" point inside a Unit Sphere'.
-float3 GetRandomPointInUnitSphere(uint IntersectionCount)
+// 2D sample (Range [0.0, 1.0)) for scattering the given bounce (IntersectionCount, starting at 1) of a camera ray.
+float2 GetScatterSample(uint PixelSeed, uint SampleIndex, uint IntersectionCount, uint SamplerType)
+{
+	return GetSample3D(PixelSeed, SampleIndex, IntersectionCount, SamplerType).xy;
+}
+
+// Function for mapping a 2D sample onto the hemisphere around a World-Space normal, with a density proportional to the cosine to the normal.
+// The sample is spread uniformly over the unit disk and projected up onto the hemisphere (Malley's method), in a basis around the normal (Duff et al., "Building an Orthonormal Basis, Revisited").
+// For a Lambertian surface, that density cancels the cosine and BRDF out, so each scattered ray weighs exactly the surface's attenuation.
+float3 GetCosineWeightedDirection(float3 WorldSurfaceNormal, float2 Sample)
 {
-	float3 RandomPointInUnitSphere;
+	float Sign = WorldSurfaceNormal.z >= 0.0 ? 1.0 : -1.0;
+	float a = -1.0 / (Sign + WorldSurfaceNormal.z);
+	float b = WorldSurfaceNormal.x * WorldSurfaceNormal.y * a;
+
+	float3 Tangent = float3(1.0 + Sign * WorldSurfaceNormal.x * WorldSurfaceNormal.x * a, Sign * b, -Sign * WorldSurfaceNormal.x);
+	float3 Bitangent = float3(b, Sign + WorldSurfaceNormal.y * WorldSurfaceNormal.y * a, -WorldSurfaceNormal.y);
+
+	float DiskRadius = sqrt(Sample.x);
+	float DiskAngle = TwoPi * Sample.y;
+
+	return (DiskRadius * cos(DiskAngle) * Tangent) + (DiskRadius * sin(DiskAngle) * Bitangent) + (sqrt(max(1.0 - Sample.x, 0.0)) * WorldSurfaceNormal);
+}
+
+// Mirror reflection of a direction off of a surface with the given normal.
+float3 GetReflectedDirection(float3 Direction, float3 WorldSurfaceNormal)
+{
+	return Direction - ((2.0 * dot(Direction, WorldSurfaceNormal)) * WorldSurfaceNormal);
+}
+
+// Refraction of a unit direction through a surface whose unit normal faces against it, with Eta the ratio of the indices of refraction on either side (incident over transmitted), by Snell's law.
+// Directions past the critical angle get clamped to the surface's tangent plane. (A sphere entered from outside never takes them on its way out, so the dielectric shader never asks for one.)
+float3 GetRefractedDirection(float3 Direction, float3 WorldSurfaceNormal, float Eta)
+{
+	float CosIncidence = -dot(Direction, WorldSurfaceNormal);
+	float CosTransmitted = sqrt(max(1.0 - (Eta * Eta * (1.0 - (CosIncidence * CosIncidence))), 0.0));
+
+	return normalize((Eta * Direction) + (((Eta * CosIncidence) - CosTransmitted) * WorldSurfaceNormal));
+}
+
+// Schlick's approximation of the Fresnel reflectance of a dielectric, seen from outside at the given cosine to its normal.
+float GetSchlickReflectance(float CosIncidence, float IndexOfRefraction)
+{
+	float R0 = (1.0 - IndexOfRefraction) / (1.0 + IndexOfRefraction);
+	R0 = R0 * R0;
+
+	float OneMinusCos = 1.0 - CosIncidence;
+
+	return R0 + ((1.0 - R0) * OneMinusCos * OneMinusCos * OneMinusCos * OneMinusCos * OneMinusCos);
+}
+
+// Function for mapping a 3D sample to a point uniformly distributed within the unit ball, for fuzzing reflections.
+float3 GetUnitBallPoint(float3 Sample)
+{
+	float z = 1.0 - (2.0 * Sample.x);
+	float DiskRadius = sqrt(max(1.0 - (z * z), 0.0));
+	float Angle = TwoPi * Sample.y;
+
+	return pow(Sample.z, 1.0 / 3.0) * float3(DiskRadius * cos(Angle), DiskRadius * sin(Angle), z);
+}
+
+// Function for deciding whether Russian roulette ends a path that has traced PathDepth rays. Past RouletteMinDepth, it survives with the probability of its brightest throughput channel, and makes up for the paths that were ended by carrying that much more.
+// Returns false for a path that was ended, whose throughput is then 0.
+bool GetRouletteSurvival(uint PixelSeed, uint SampleIndex, uint PathDepth, uint RouletteMinDepth, uint SamplerType, inout float3 Throughput)
+{
+	if (RouletteMinDepth == 0 || PathDepth < RouletteMinDepth)
+	{
+		return true;
+	}
+
+	float SurvivalProbability = min(max(Throughput.x, max(Throughput.y, Throughput.z)), 1.0);
 
-	// Collect valid indices.
-	uint RequestedIndex_x = ((DispatchRaysIndex().y * DispatchRaysDimensions().x + DispatchRaysIndex().x) * 3) + IntersectionCount + 0;
-	uint RequestedIndex_y = ((DispatchRaysIndex().y * DispatchRaysDimensions().x + DispatchRaysIndex().x) * 3) + IntersectionCount + 1;
-	uint RequestedIndex_z = ((DispatchRaysIndex().y * DispatchRaysDimensions().x + DispatchRaysIndex().x) * 3) + IntersectionCount + 2;
+	if (GetSample3D(PixelSeed, SampleIndex, RouletteSampleGroup + PathDepth, SamplerType).x >= SurvivalProbability)
+	{
+		Throughput = float3(0.0, 0.0, 0.0);
 
-	uint Index_x = GetWrappedIndex(RequestedIndex_x, Constants.RandomFloatCount);
-	uint Index_y = GetWrappedIndex(RequestedIndex_y, Constants.RandomFloatCount);
-	uint Index_z = GetWrappedIndex(RequestedIndex_z, Constants.RandomFloatCount);
+		return false;
+	}
 
-	RandomPointInUnitSphere.x = RandomNumberBuffer[Index_x];
-	RandomPointInUnitSphere.y = RandomNumberBuffer[Index_y];
-	RandomPointInUnitSphere.z = RandomNumberBuffer[Index_z];
+	Throughput /= SurvivalProbability;
 
-	return RandomPointInUnitSphere;
+	return true;
 }
@@ -0,0 +1,26 @@
+@echo off
+rem CompileShaders.bat - Compiles each shader library in this directory into a header in "Source\Compiled Shaders", which Main.cpp embeds.
+rem October 2019
+rem Chris M.
+rem https://github.com/RealTimeChris
+
+rem Run it from a Developer Command Prompt, for dxc.exe from the Windows SDK, whenever any of the HLSL changes, and commit the headers along with it.
+rem "CompileShaders.bat ser" compiles them for Shader Model 6.9 with SHADER_EXECUTION_REORDERING defined, which reorders the hits by hit group (see RayGeneration.hlsl).
+
+setlocal
+cd /d "%~dp0"
+
+set Profile=lib_6_3
+set Defines=
+
+if /i "%~1"=="ser" (
+	set Profile=lib_6_9
+	set Defines=-D SHADER_EXECUTION_REORDERING
+)
+
+if not exist "..\Source\Compiled Shaders" mkdir "..\Source\Compiled Shaders"
+
+for %%S in (*.hlsl) do (
+	echo %%~nS
+	dxc.exe -nologo -T %Profile% %Defines% -Vn %%~nS -Fh "..\Source\Compiled Shaders\%%~nS.h" "%%S" || exit /b 1
+)
@@ -1,16 +0,0 @@
-// DielectricAnyHit.hlsl
-// October 2019
-// Chris M.
-// https://github.com/RealTimeChris
-
-#pragma once
-
-#include "CommonShaderStuff.h"
-
-// Dielectric Any-Hit shader.
-[shader("anyhit")]
-void DielectricAnyHit(inout RayPayload Payload, in IntersectionAttributes Attributes)
-{
-	// Nothing, for now.
-	
-}
@@ -0,0 +1,53 @@
+// DielectricClosestHit.hlsl
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include "CommonShaderStuff.h"
+
+// Dielectric Closest-Hit shader.
+// Picks reflection or refraction by the Schlick reflectance, and follows a refracted ray straight through the sphere and out the far side, so that the next ray starts outside of it again. Light that the far side reflects back inside doesn't get followed.
+[shader("closesthit")]
+void DielectricClosestHit(inout RayPayload Payload, in IntersectionAttributes Attributes)
+{
+	// Set some stuff in the Payload.
+	Payload.IntersectionCount++;
+
+	float3 WorldSurfaceNormal = normalize(mul(ObjectToWorld3x4(), float4(Attributes.ObjectSurfaceNormal, 0.0)).xyz);
+
+	// Radius of the sphere in World-Space. (Instances are uniformly scaled.)
+	float WorldRadius = length(mul(ObjectToWorld3x4(), float4(UnitSphereRadius, 0.0, 0.0, 0.0)).xyz);
+
+	float3 Direction = normalize(WorldRayDirection());
+	float3 WorldHitPosition = WorldRayOrigin() + (RayTCurrent() * WorldRayDirection());
+
+	Material SurfaceMaterial = Materials[InstanceIndex()];
+
+	float IndexOfRefraction = SurfaceMaterial.IndexOfRefraction;
+	float CosIncidence = min(-dot(Direction, WorldSurfaceNormal), 1.0);
+
+	float3 ScatterSample = GetSample3D(GetPixelSeed(GetThreadId(), GetThreadDimensions(), Constants.RandomSeed), Payload.SampleIndex, Payload.IntersectionCount, Constants.SamplerType);
+
+	if (ScatterSample.x < GetSchlickReflectance(CosIncidence, IndexOfRefraction))
+	{
+		Payload.WorldScatterOrigin = WorldHitPosition;
+		Payload.WorldScatterDirection = GetReflectedDirection(Direction, WorldSurfaceNormal);
+	}
+	else
+	{
+		// Through the sphere: the chord along the refracted direction ends where the far side's normal is the near side's, mirrored about the chord.
+		float3 InsideDirection = GetRefractedDirection(Direction, WorldSurfaceNormal, 1.0 / IndexOfRefraction);
+		float ChordLength = -2.0 * WorldRadius * dot(InsideDirection, WorldSurfaceNormal);
+		float3 ExitSurfaceNormal = WorldSurfaceNormal - ((2.0 * dot(InsideDirection, WorldSurfaceNormal)) * InsideDirection);
+
+		Payload.WorldScatterOrigin = WorldHitPosition + (ChordLength * InsideDirection);
+		Payload.WorldScatterDirection = GetRefractedDirection(InsideDirection, -ExitSurfaceNormal, IndexOfRefraction);
+	}
+
+	// Hand the scattered ray back to the Ray Generation shader, which traces it next. The albedo tints the glass.
+	Payload.Radiance += Payload.Throughput * SurfaceMaterial.Emission;
+	Payload.Throughput *= SurfaceMaterial.Albedo;
+	Payload.HitT = RayTCurrent();
+}
@@ -11,8 +11,6 @@
 [shader("miss")]
 void DielectricMiss(inout RayPayload Payload)
 {
-	if (Payload.IntersectionCount == 0)
-	{
-		Payload.Color = GetColorValue(Constants.SkyTopColor.xyz, Constants.SkyBottomColor.xyz, WorldRayDirection());
-	}
+	// End the path. The Ray Generation shader gives it the sky's color.
+	Payload.HitT = -1.0;
 }
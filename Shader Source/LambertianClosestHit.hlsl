@@ -15,30 +15,18 @@ void LambertianClosestHit(inout RayPayload Payload, in IntersectionAttributes At
 	Payload.IntersectionCount++;
 
 
-	// Collect a random point in the Unit Sphere, for creating a random reflection/scatter direction.
-
-	float3 WorldIntersectionPoint = mul(ObjectToWorld3x4(), float4(Attributes.ObjectIntersectionPoint, 1.0)).xyz;
+	// Collect a cosine-weighted direction around the Surface Normal, for the random reflection/scatter direction.
 
 	float3 WorldSurfaceNormal = normalize(mul(ObjectToWorld3x4(), float4(Attributes.ObjectSurfaceNormal, 0.0)).xyz);
 
-	float3 RandomPointInUnitSphere = GetRandomPointInUnitSphere(Payload.IntersectionCount);
-
-	float3 WorldScatterTarget = WorldIntersectionPoint + WorldSurfaceNormal + RandomPointInUnitSphere;
-
-	Payload.WorldLastScatterDirection = normalize(WorldScatterTarget - WorldIntersectionPoint);
+	float2 ScatterSample = GetScatterSample(GetPixelSeed(GetThreadId(), GetThreadDimensions(), Constants.RandomSeed), Payload.SampleIndex, Payload.IntersectionCount, Constants.SamplerType);
 
-	if (Payload.RecursionDepth < Constants.MaxRecursionDepth)
-	{
-		// Create the Reflection Ray.
-		RayDesc ReflectionRay;
+	Material SurfaceMaterial = Materials[InstanceIndex()];
 
-		ReflectionRay.Origin = WorldIntersectionPoint;
-		ReflectionRay.Direction = Payload.WorldLastScatterDirection;
-		ReflectionRay.TMin = 0.0;
-		ReflectionRay.TMax = 10000;
-		
-		Payload.RecursionDepth++;
-		
-		TraceRay(Scene, RAY_FLAG_FORCE_OPAQUE | RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH, ~InstanceID(), 0, 1, 0, ReflectionRay, Payload);
-	}
+	// Hand the Reflection Ray back to the Ray Generation shader, which traces it next.
+	Payload.Radiance += Payload.Throughput * SurfaceMaterial.Emission;
+	Payload.Throughput *= SurfaceMaterial.Albedo;
+	Payload.WorldScatterOrigin = WorldRayOrigin() + (RayTCurrent() * WorldRayDirection());
+	Payload.WorldScatterDirection = GetCosineWeightedDirection(WorldSurfaceNormal, ScatterSample);
+	Payload.HitT = RayTCurrent();
 }
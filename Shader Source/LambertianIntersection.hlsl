@@ -26,7 +26,7 @@ void LambertianIntersection()
 		// Collect the Surface Normal, in Object-Space.
 		Attributes.ObjectSurfaceNormal = GetObjectSurfaceNormal(Attributes.ObjectIntersectionPoint);
 
-		// Report the hit.
-		ReportHit(RayTCurrent(), SphereHit, Attributes);
+		// Report the hit where the ray enters the sphere. ReportHit() ignores it when that's behind the ray's origin.
+		ReportHit(GetIntersectionDistance(), SphereHit, Attributes);
 	}
 }
@@ -13,5 +13,21 @@ void MetallicClosestHit(inout RayPayload Payload, in IntersectionAttributes Attr
 {
 	// Set some stuff in the Payload.
 	Payload.IntersectionCount++;
-	
+
+	float3 WorldSurfaceNormal = normalize(mul(ObjectToWorld3x4(), float4(Attributes.ObjectSurfaceNormal, 0.0)).xyz);
+
+	Material SurfaceMaterial = Materials[InstanceIndex()];
+
+	// Reflect the ray off of the surface, and fuzz it with a random point in a ball of the material's roughness. Fuzzed rays that end up below the surface keep the mirror reflection.
+	float3 ReflectedDirection = GetReflectedDirection(normalize(WorldRayDirection()), WorldSurfaceNormal);
+
+	float3 FuzzSample = GetSample3D(GetPixelSeed(GetThreadId(), GetThreadDimensions(), Constants.RandomSeed), Payload.SampleIndex, Payload.IntersectionCount, Constants.SamplerType);
+	float3 FuzzedDirection = normalize(ReflectedDirection + (SurfaceMaterial.Roughness * GetUnitBallPoint(FuzzSample)));
+
+	// Hand the Reflection Ray back to the Ray Generation shader, which traces it next.
+	Payload.Radiance += Payload.Throughput * SurfaceMaterial.Emission;
+	Payload.Throughput *= SurfaceMaterial.Albedo;
+	Payload.WorldScatterOrigin = WorldRayOrigin() + (RayTCurrent() * WorldRayDirection());
+	Payload.WorldScatterDirection = dot(FuzzedDirection, WorldSurfaceNormal) > 0.0 ? FuzzedDirection : ReflectedDirection;
+	Payload.HitT = RayTCurrent();
 }
@@ -17,61 +17,107 @@ void RayGeneration()
 	// Collect Thread Id for the current worker.
 	uint2 ThreadId = GetThreadId();
 
+	// Pixels that adaptive sampling has stopped keep the average they were last written with.
+	if (Constants.FirstSampleIndex > 0 && AccumulationBuffer[ThreadId].w < 0.0)
+	{
+		return;
+	}
+
 	// Get the Camera's position in World-Space.
 	float3 WorldCameraPosition = GetWorldCameraPosition(Constants.CameraToWorld);
 
 	// Color value for the current pixel, to be accumulated during the loop, then averaged down afterwards and written to the Render Target.
 	float3 PixelColor = {0.0, 0.0, 0.0};
 
+	// Sum of the squared luminances of the rays, for estimating the pixel's noise.
+	float LuminanceSquaredSum = 0.0;
+
+	// Seed of the random numbers of the current pixel.
+	uint PixelSeed = GetPixelSeed(ThreadId, ThreadDims, Constants.RandomSeed);
+
 	// Loop for creating and tracing rays within the current pixel (Pixel = Worker Thread).
 	for (uint RayIndex = 1; RayIndex <= Constants.RaysPerPixel; RayIndex++)
 	{
 		// Collect the pixel offset values for the current ray.
-		float2 PixelOffset = GetPixelOffset(RayIndex);
+		float2 PixelOffset = GetPixelOffset(PixelSeed, Constants.FirstSampleIndex + RayIndex - 1, Constants.SamplerType);
 
 		// Collect the point in World-Space to shoot the current camera-ray through.
 		float3 WorldPointPosition = GetWorldPointPosition(Constants.CameraToWorld, ThreadDims, ThreadId, PixelOffset, Constants.VertFoVRad);
 
 		// Create and initialize the Ray Payload and Ray Description.		
-		RayDesc CameraRay;
-		CameraRay.Direction = normalize(WorldPointPosition - WorldCameraPosition);
-		CameraRay.Origin = WorldCameraPosition;
-		CameraRay.TMin = 0.000;
-		CameraRay.TMax = 10000;
+		RayDesc Ray;
+		Ray.Direction = normalize(WorldPointPosition - WorldCameraPosition);
+		Ray.Origin = WorldCameraPosition;
+		Ray.TMin = 0.000;
+		Ray.TMax = 10000;
 
 		RayPayload Payload;
-		Payload.Color.x = 0.0;
-		Payload.Color.y = 0.0;
-		Payload.Color.z = 0.0;
+		Payload.Throughput = float3(1.0, 1.0, 1.0);
+		Payload.Radiance = float3(0.0, 0.0, 0.0);
 		Payload.IntersectionCount = 0;
-		Payload.RecursionDepth = 0;
+		Payload.SampleIndex = Constants.FirstSampleIndex + RayIndex - 1;
 
-		Payload.RecursionDepth++;
+		// Trace the path one ray at a time, continuing from where the Closest-Hit shader scattered the last one, so that nothing recurses.
+		for (uint PathDepth = 1; PathDepth <= Constants.MaxPathDepth; PathDepth++)
+		{
+			// Hit groups without a Closest-Hit shader leave the payload alone, which ends the path.
+			Payload.HitT = -1.0;
 
-		TraceRay(Scene, RAY_FLAG_FORCE_OPAQUE | RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH, ~0, 0, 1, 0, CameraRay, Payload);
+#if defined(SHADER_EXECUTION_REORDERING)
+			// Shader Model 6.9: find the hit without shading it, and let the threads get regrouped by the hit group they hit before the Closest-Hit shaders run, so that each material's shader runs on coherent waves.
+			dx::HitObject Hit = dx::HitObject::TraceRay(Scene, RAY_FLAG_FORCE_OPAQUE, ~0, 0, 1, 0, Ray, Payload);
 
-		if (Payload.IntersectionCount > 0)
-		{
-			Payload.Color = GetColorValue(Constants.SkyTopColor.xyz, Constants.SkyBottomColor.xyz, Payload.WorldLastScatterDirection);
+			dx::MaybeReorderThread(Hit);
+
+			dx::HitObject::Invoke(Hit, Payload);
+#else
+			TraceRay(Scene, RAY_FLAG_FORCE_OPAQUE, ~0, 0, 1, 0, Ray, Payload);
+#endif
+
+			if (Payload.HitT < 0.0)
+			{
+				break;
+			}
 
-			for (uint i = 1; i <= Payload.IntersectionCount; i++)
+			if (GetRouletteSurvival(PixelSeed, Payload.SampleIndex, PathDepth, Constants.RouletteMinDepth, Constants.SamplerType, Payload.Throughput) == false)
 			{
-				Payload.Color.x *= Constants.LambertianAttenuationValue;
-				Payload.Color.y *= Constants.LambertianAttenuationValue;
-				Payload.Color.z *= Constants.LambertianAttenuationValue;
+				break;
 			}
+
+			Ray.Origin = Payload.WorldScatterOrigin;
+			Ray.Direction = Payload.WorldScatterDirection;
 		}
+
+		// Paths that reached the sky, or ran out of depth, get the sky's color along their last ray, attenuated by every bounce, on top of the light they picked up on the way.
+		float3 RayColor = Payload.Radiance + (Payload.Throughput * GetColorValue(Constants.SkyTopColor.xyz, Constants.SkyBottomColor.xyz, Ray.Direction));
 		
 		// Add the returned Ray's color value to the pixel's color value, to be averaged after.
-		PixelColor.x += Payload.Color.x;
-		PixelColor.y += Payload.Color.y;
-		PixelColor.z += Payload.Color.z;
+		PixelColor.x += RayColor.x;
+		PixelColor.y += RayColor.y;
+		PixelColor.z += RayColor.z;
+
+		LuminanceSquaredSum += GetLuminance(RayColor) * GetLuminance(RayColor);
+	}
+
+	// Add the sums of the previous passes, if any, and keep them for the next ones.
+	if (Constants.FirstSampleIndex > 0)
+	{
+		PixelColor += AccumulationBuffer[ThreadId].xyz;
+		LuminanceSquaredSum += AccumulationBuffer[ThreadId].w;
 	}
 
-	// Average the pixel's color value.
-	PixelColor.x /= (float)Constants.RaysPerPixel;
-	PixelColor.y /= (float)Constants.RaysPerPixel;
-	PixelColor.z /= (float)Constants.RaysPerPixel;
+	// Stop tracing the pixel in the next passes, once it is converged.
+	if (GetPixelConverged(GetLuminance(PixelColor), LuminanceSquaredSum, Constants.FirstSampleIndex + Constants.RaysPerPixel, Constants.AdaptiveThreshold) == true)
+	{
+		LuminanceSquaredSum = -1.0;
+	}
+
+	AccumulationBuffer[ThreadId] = float4(PixelColor.x, PixelColor.y, PixelColor.z, LuminanceSquaredSum);
+
+	// Average the pixel's color value, over the rays of every pass so far.
+	PixelColor.x /= (float)(Constants.FirstSampleIndex + Constants.RaysPerPixel);
+	PixelColor.y /= (float)(Constants.FirstSampleIndex + Constants.RaysPerPixel);
+	PixelColor.z /= (float)(Constants.FirstSampleIndex + Constants.RaysPerPixel);
 
 	// Write the pixel's color value out to the Render Target.
 	RenderTarget[ThreadId] = float4(PixelColor.x, PixelColor.y, PixelColor.z, 0.0);
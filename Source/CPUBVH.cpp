@@ -0,0 +1,1642 @@
+// CPUBVH.cpp - Bounding volume hierarchy over axis-aligned boxes, built with the surface area heuristic, for the CPU rendering path.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include "CPUBVH.hpp"
+#include "CPUSphereKernels.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define BVH_BUILD_SSE 1
+#include <immintrin.h>
+#else
+#define BVH_BUILD_SSE 0
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// GCC and Clang only emit AVX2 instructions inside functions that are explicitly targeted at them.
+#if BVH_BUILD_SSE && (defined(__GNUC__) || defined(__clang__))
+#define BVH_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define BVH_TARGET_AVX2
+#endif
+
+// Most SAH bins per axis.
+const unsigned int BVHMaxBinCount{ 32 };
+
+// Subtrees with at least this many primitives get built as their own task.
+const unsigned int BVHParallelSubtreeThreshold{ 4096 };
+
+// Nodes with at least this many primitives get their bounds and bins computed in parallel, in chunks of this size.
+const unsigned int BVHParallelBinningThreshold{ 65536 };
+const unsigned int BVHParallelBinningGrain{ 16384 };
+
+// Refits split the nodes this close to the root across the thread pool, for hierarchies over at least BVHParallelSubtreeThreshold primitives.
+const unsigned int BVHParallelRefitDepth{ 8 };
+
+// Largest leaf a quantized node can point to.
+const unsigned int BVHQuantizedMaxLeafSize{ 255 };
+
+// Updates that move more than this fraction of the primitives refit every node, rather than walking up from each of them.
+const unsigned int BVHIncrementalRefitDivisor{ 8 };
+
+// One SAH bin: the bounds and count of the primitives whose centroids fall into it.
+struct alignas(16) SAHBin
+{
+	float Min[4];
+	float Max[4];
+	unsigned int PrimitiveCount;
+};
+
+// Bins along all three axes, which get filled in together.
+struct SAHBinSet
+{
+	SAHBin Bins[3][BVHMaxBinCount];
+};
+
+// Bounds of a set of primitives, and of their centroids.
+struct alignas(16) RangeBounds
+{
+	float Min[4];
+	float Max[4];
+	float CentroidMin[4];
+	float CentroidMax[4];
+};
+
+// Utility functions.
+inline float GetSurfaceArea(const float(&Min)[4], const float(&Max)[4])
+{
+	float x = Max[0] - Min[0];
+	float y = Max[1] - Min[1];
+	float z = Max[2] - Min[2];
+
+	if (x < 0.0f || y < 0.0f || z < 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return 2.0f * ((x * y) + (y * z) + (z * x));
+}
+
+inline float GetSurfaceArea(const BVHNode& Node)
+{
+	float Min[4]{ Node.MinX, Node.MinY, Node.MinZ, 0.0f };
+	float Max[4]{ Node.MaxX, Node.MaxY, Node.MaxZ, 0.0f };
+
+	return GetSurfaceArea(Min, Max);
+}
+
+inline void ResetBounds(float(&Min)[4], float(&Max)[4])
+{
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		Min[i] = +1.0e30f;
+		Max[i] = -1.0e30f;
+	}
+}
+
+inline void GrowBounds(float(&Min)[4], float(&Max)[4], const float(&OtherMin)[4], const float(&OtherMax)[4])
+{
+#if BVH_BUILD_SSE
+	_mm_store_ps(Min, _mm_min_ps(_mm_load_ps(Min), _mm_load_ps(OtherMin)));
+	_mm_store_ps(Max, _mm_max_ps(_mm_load_ps(Max), _mm_load_ps(OtherMax)));
+#else
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		Min[i] = std::min(Min[i], OtherMin[i]);
+		Max[i] = std::max(Max[i], OtherMax[i]);
+	}
+#endif
+}
+
+inline void ResetRangeBounds(RangeBounds* pBounds)
+{
+	ResetBounds(pBounds->Min, pBounds->Max);
+	ResetBounds(pBounds->CentroidMin, pBounds->CentroidMax);
+}
+
+inline void GrowRangeBounds(RangeBounds* pBounds, const RangeBounds& Other)
+{
+	GrowBounds(pBounds->Min, pBounds->Max, Other.Min, Other.Max);
+	GrowBounds(pBounds->CentroidMin, pBounds->CentroidMax, Other.CentroidMin, Other.CentroidMax);
+}
+
+inline void ResetBins(SAHBinSet* pBins, unsigned int BinCount)
+{
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		for (unsigned int Bin = 0; Bin < BinCount; Bin++)
+		{
+			ResetBounds(pBins->Bins[Axis][Bin].Min, pBins->Bins[Axis][Bin].Max);
+			pBins->Bins[Axis][Bin].PrimitiveCount = 0;
+		}
+	}
+}
+
+inline void MergeBins(SAHBinSet* pBins, const SAHBinSet& Other, unsigned int BinCount)
+{
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		for (unsigned int Bin = 0; Bin < BinCount; Bin++)
+		{
+			GrowBounds(pBins->Bins[Axis][Bin].Min, pBins->Bins[Axis][Bin].Max, Other.Bins[Axis][Bin].Min, Other.Bins[Axis][Bin].Max);
+			pBins->Bins[Axis][Bin].PrimitiveCount += Other.Bins[Axis][Bin].PrimitiveCount;
+		}
+	}
+}
+
+// Computes the bounds and centroid bounds of a range of primitives.
+inline void ComputeRangeBounds(const BVHBuildPrimitive* pPrimitives, unsigned int Count, RangeBounds* pBounds)
+{
+	ResetRangeBounds(pBounds);
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		const BVHBuildPrimitive& Primitive = pPrimitives[i];
+
+		GrowBounds(pBounds->Min, pBounds->Max, Primitive.Min, Primitive.Max);
+		GrowBounds(pBounds->CentroidMin, pBounds->CentroidMax, Primitive.Centroid, Primitive.Centroid);
+	}
+}
+
+// Computes which bin a primitive's centroid falls into, along all three axes at once.
+inline void GetBinIndices(const BVHBuildPrimitive& Primitive, const float(&CentroidMin)[4], const float(&BinScale)[4], float MaxBin, int(&BinIndices)[4])
+{
+#if BVH_BUILD_SSE
+	__m128 Bin = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Primitive.Centroid), _mm_load_ps(CentroidMin)), _mm_load_ps(BinScale));
+	Bin = _mm_min_ps(_mm_max_ps(Bin, _mm_setzero_ps()), _mm_set1_ps(MaxBin));
+
+	_mm_storeu_si128((__m128i*)BinIndices, _mm_cvttps_epi32(Bin));
+#else
+	for (unsigned int Axis = 0; Axis < 4; Axis++)
+	{
+		float Bin = (Primitive.Centroid[Axis] - CentroidMin[Axis]) * BinScale[Axis];
+		BinIndices[Axis] = (int)std::min(std::max(Bin, 0.0f), MaxBin);
+	}
+#endif
+}
+
+// Drops a range of primitives into the bins of every axis.
+inline void BinPrimitives
+(
+	const BVHBuildPrimitive* pPrimitives,
+	unsigned int Count,
+	const float(&CentroidMin)[4],
+	const float(&BinScale)[4],
+	unsigned int BinCount,
+	SAHBinSet* pBins
+)
+{
+	alignas(16) int BinIndices[4];
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		const BVHBuildPrimitive& Primitive = pPrimitives[i];
+
+		GetBinIndices(Primitive, CentroidMin, BinScale, (float)(BinCount - 1), BinIndices);
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			SAHBin& Bin = pBins->Bins[Axis][BinIndices[Axis]];
+
+			GrowBounds(Bin.Min, Bin.Max, Primitive.Min, Primitive.Max);
+			Bin.PrimitiveCount++;
+		}
+	}
+}
+
+// Wide node tests. (See IntersectBVH8NodeFunction.)
+unsigned int IntersectBVH8NodeScalar(const BVH8Ray& Ray, const BVH8Node& Node, float TMax, float* pEntries)
+{
+	unsigned int HitMask{ 0 };
+
+	for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+	{
+		float TEnter = Ray.TMin;
+		float TExit = TMax;
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			float TNear = (Node.Bounds[Ray.NearPlanes[Axis]][Slot] - Ray.Origin[Axis]) * Ray.InverseDirection[Axis];
+			float TFar = (Node.Bounds[Ray.FarPlanes[Axis]][Slot] - Ray.Origin[Axis]) * Ray.InverseDirection[Axis];
+
+			TEnter = TNear > TEnter ? TNear : TEnter;
+			TExit = TFar < TExit ? TFar : TExit;
+		}
+
+		pEntries[Slot] = TEnter;
+		HitMask |= (TEnter <= TExit ? 1U : 0U) << Slot;
+	}
+
+	return HitMask;
+}
+
+#if BVH_BUILD_SSE
+unsigned int IntersectBVH8NodeSSE(const BVH8Ray& Ray, const BVH8Node& Node, float TMax, float* pEntries)
+{
+	unsigned int HitMask{ 0 };
+
+	// Two halves of four children each.
+	for (unsigned int Half = 0; Half < BVH8Width; Half += 4)
+	{
+		__m128 TEnter = _mm_set1_ps(Ray.TMin);
+		__m128 TExit = _mm_set1_ps(TMax);
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			__m128 Origin = _mm_set1_ps(Ray.Origin[Axis]);
+			__m128 InverseDirection = _mm_set1_ps(Ray.InverseDirection[Axis]);
+
+			__m128 TNear = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(&(Node.Bounds[Ray.NearPlanes[Axis]][Half])), Origin), InverseDirection);
+			__m128 TFar = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(&(Node.Bounds[Ray.FarPlanes[Axis]][Half])), Origin), InverseDirection);
+
+			TEnter = _mm_max_ps(TEnter, TNear);
+			TExit = _mm_min_ps(TExit, TFar);
+		}
+
+		_mm_storeu_ps(pEntries + Half, TEnter);
+		HitMask |= (unsigned int)_mm_movemask_ps(_mm_cmple_ps(TEnter, TExit)) << Half;
+	}
+
+	return HitMask;
+}
+
+BVH_TARGET_AVX2 unsigned int IntersectBVH8NodeAVX2(const BVH8Ray& Ray, const BVH8Node& Node, float TMax, float* pEntries)
+{
+	__m256 TEnter = _mm256_set1_ps(Ray.TMin);
+	__m256 TExit = _mm256_set1_ps(TMax);
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		__m256 Origin = _mm256_set1_ps(Ray.Origin[Axis]);
+		__m256 InverseDirection = _mm256_set1_ps(Ray.InverseDirection[Axis]);
+
+		__m256 TNear = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(Node.Bounds[Ray.NearPlanes[Axis]]), Origin), InverseDirection);
+		__m256 TFar = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(Node.Bounds[Ray.FarPlanes[Axis]]), Origin), InverseDirection);
+
+		TEnter = _mm256_max_ps(TEnter, TNear);
+		TExit = _mm256_min_ps(TExit, TFar);
+	}
+
+	_mm256_storeu_ps(pEntries, TEnter);
+
+	return (unsigned int)_mm256_movemask_ps(_mm256_cmp_ps(TEnter, TExit, _CMP_LE_OQ));
+}
+#endif
+
+// Returns 2^Exponent, for the quantization frames.
+inline float GetQuantizationScale(int Exponent)
+{
+	unsigned int Bits = (unsigned int)(Exponent + 127) << 23;
+	float Scale{};
+
+	memcpy(&Scale, &Bits, sizeof(Scale));
+
+	return Scale;
+}
+
+// Quantized wide node tests. (See IntersectBVH8QuantizedNodeFunction.)
+// Each plane gets decoded exactly the way EncodeWideNodeBounds() checked it, Origin + Quantized * Scale, which always lies on or outside of the exact plane.
+// Rounding is monotonic from there on, so the distances can only come out wider than with the exact bounds, never narrower.
+unsigned int IntersectBVH8QuantizedNodeScalar(const BVH8Ray& Ray, const BVH8QuantizedNode& Node, float TMax, float* pEntries)
+{
+	float Scales[3];
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		Scales[Axis] = GetQuantizationScale(Node.Exponents[Axis]);
+	}
+
+	unsigned int HitMask{ 0 };
+
+	for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+	{
+		float TEnter = Ray.TMin;
+		float TExit = TMax;
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			float Near = Node.Origin[Axis] + ((float)Node.QuantizedBounds[Ray.NearPlanes[Axis]][Slot] * Scales[Axis]);
+			float Far = Node.Origin[Axis] + ((float)Node.QuantizedBounds[Ray.FarPlanes[Axis]][Slot] * Scales[Axis]);
+
+			float TNear = (Near - Ray.Origin[Axis]) * Ray.InverseDirection[Axis];
+			float TFar = (Far - Ray.Origin[Axis]) * Ray.InverseDirection[Axis];
+
+			TEnter = TNear > TEnter ? TNear : TEnter;
+			TExit = TFar < TExit ? TFar : TExit;
+		}
+
+		pEntries[Slot] = TEnter;
+		HitMask |= (TEnter <= TExit ? 1U : 0U) << Slot;
+	}
+
+	return HitMask & Node.ChildMask;
+}
+
+#if BVH_BUILD_SSE
+unsigned int IntersectBVH8QuantizedNodeSSE(const BVH8Ray& Ray, const BVH8QuantizedNode& Node, float TMax, float* pEntries)
+{
+	__m128 Scales[3];
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		Scales[Axis] = _mm_set1_ps(GetQuantizationScale(Node.Exponents[Axis]));
+	}
+
+	unsigned int HitMask{ 0 };
+
+	for (unsigned int Half = 0; Half < BVH8Width; Half += 4)
+	{
+		__m128 TEnter = _mm_set1_ps(Ray.TMin);
+		__m128 TExit = _mm_set1_ps(TMax);
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			int NearBytes{}, FarBytes{};
+			memcpy(&NearBytes, &(Node.QuantizedBounds[Ray.NearPlanes[Axis]][Half]), sizeof(int));
+			memcpy(&FarBytes, &(Node.QuantizedBounds[Ray.FarPlanes[Axis]][Half]), sizeof(int));
+
+			__m128i Zero = _mm_setzero_si128();
+			__m128 Near = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(NearBytes), Zero), Zero));
+			__m128 Far = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(FarBytes), Zero), Zero));
+
+			__m128 FrameOrigin = _mm_set1_ps(Node.Origin[Axis]);
+			__m128 Origin = _mm_set1_ps(Ray.Origin[Axis]);
+			__m128 InverseDirection = _mm_set1_ps(Ray.InverseDirection[Axis]);
+
+			__m128 TNear = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(FrameOrigin, _mm_mul_ps(Near, Scales[Axis])), Origin), InverseDirection);
+			__m128 TFar = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(FrameOrigin, _mm_mul_ps(Far, Scales[Axis])), Origin), InverseDirection);
+
+			TEnter = _mm_max_ps(TEnter, TNear);
+			TExit = _mm_min_ps(TExit, TFar);
+		}
+
+		_mm_storeu_ps(pEntries + Half, TEnter);
+		HitMask |= (unsigned int)_mm_movemask_ps(_mm_cmple_ps(TEnter, TExit)) << Half;
+	}
+
+	return HitMask & Node.ChildMask;
+}
+
+BVH_TARGET_AVX2 unsigned int IntersectBVH8QuantizedNodeAVX2(const BVH8Ray& Ray, const BVH8QuantizedNode& Node, float TMax, float* pEntries)
+{
+	__m256 TEnter = _mm256_set1_ps(Ray.TMin);
+	__m256 TExit = _mm256_set1_ps(TMax);
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		__m256 Scale = _mm256_set1_ps(GetQuantizationScale(Node.Exponents[Axis]));
+		__m256 FrameOrigin = _mm256_set1_ps(Node.Origin[Axis]);
+		__m256 Origin = _mm256_set1_ps(Ray.Origin[Axis]);
+		__m256 InverseDirection = _mm256_set1_ps(Ray.InverseDirection[Axis]);
+
+		__m256 Near = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)Node.QuantizedBounds[Ray.NearPlanes[Axis]])));
+		__m256 Far = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)Node.QuantizedBounds[Ray.FarPlanes[Axis]])));
+
+		__m256 TNear = _mm256_mul_ps(_mm256_sub_ps(_mm256_add_ps(FrameOrigin, _mm256_mul_ps(Near, Scale)), Origin), InverseDirection);
+		__m256 TFar = _mm256_mul_ps(_mm256_sub_ps(_mm256_add_ps(FrameOrigin, _mm256_mul_ps(Far, Scale)), Origin), InverseDirection);
+
+		TEnter = _mm256_max_ps(TEnter, TNear);
+		TExit = _mm256_min_ps(TExit, TFar);
+	}
+
+	_mm256_storeu_ps(pEntries, TEnter);
+
+	return (unsigned int)_mm256_movemask_ps(_mm256_cmp_ps(TEnter, TExit, _CMP_LE_OQ)) & Node.ChildMask;
+}
+#endif
+
+// Picks the wide node tests for the sphere kernels' instruction set, so that --isa covers both.
+inline void GetIntersectBVH8NodeFunctions(IntersectBVH8NodeFunction* pIntersectNode, IntersectBVH8QuantizedNodeFunction* pIntersectQuantizedNode)
+{
+	*pIntersectNode = IntersectBVH8NodeScalar;
+	*pIntersectQuantizedNode = IntersectBVH8QuantizedNodeScalar;
+
+#if BVH_BUILD_SSE
+	if (GetSphereKernelISA() >= SPHERE_KERNEL_ISA_AVX2)
+	{
+		*pIntersectNode = IntersectBVH8NodeAVX2;
+		*pIntersectQuantizedNode = IntersectBVH8QuantizedNodeAVX2;
+	}
+	else if (GetSphereKernelISA() >= SPHERE_KERNEL_ISA_SSE)
+	{
+		*pIntersectNode = IntersectBVH8NodeSSE;
+		*pIntersectQuantizedNode = IntersectBVH8QuantizedNodeSSE;
+	}
+#endif
+}
+
+// Spreads the lower 10 bits of a value out to every third bit.
+inline unsigned int ExpandMortonBits(unsigned int Value)
+{
+	Value = (Value * 0x00010001U) & 0xFF0000FFU;
+	Value = (Value * 0x00000101U) & 0x0F00F00FU;
+	Value = (Value * 0x00000011U) & 0xC30C30C3U;
+	Value = (Value * 0x00000005U) & 0x49249249U;
+
+	return Value;
+}
+
+inline unsigned int CountLeadingZeros(unsigned int Value)
+{
+	if (Value == 0)
+	{
+		return 32;
+	}
+
+#if defined(_MSC_VER)
+	unsigned long Index{};
+	_BitScanReverse(&Index, Value);
+
+	return 31 - (unsigned int)Index;
+#else
+	return (unsigned int)__builtin_clz(Value);
+#endif
+}
+
+
+
+
+
+// CPUBVH class.
+CPUBVH::CPUBVH
+() :
+	InitConfig{},
+	Config{}
+{
+	this->Config.node_count = 0;
+	this->Config.ptr_intersect_wide_node = IntersectBVH8NodeScalar;
+	this->Config.ptr_intersect_quantized_node = IntersectBVH8QuantizedNodeScalar;
+	this->Config.depth = 0;
+	this->Config.sah_cost = 0.0f;
+	this->Config.sah_area_sum = 0.0;
+	this->Config.built_sah_cost = 0.0f;
+	this->Config.build_seconds = 0.0;
+	this->Config.update_seconds = 0.0;
+	this->Config.refit_count = 0;
+	this->Config.rebuild_count = 0;
+	this->Config.name = "CPUBVH";
+	this->Config.error_message = "CPUBVH.Initialize() failed.";
+
+	this->InitConfig.ptr_primitive_bounds = nullptr;
+	this->InitConfig.primitive_count = 0;
+	this->InitConfig.build_flags = BVH_BUILD_FLAG_PREFER_FAST_TRACE;
+	this->InitConfig.ptr_thread_pool = nullptr;
+	this->InitConfig.branching_factor = BVH8Width;
+	this->InitConfig.bin_count = 16;
+	this->InitConfig.max_leaf_size = 4;
+	this->InitConfig.traversal_cost = 1.0f;
+	this->InitConfig.intersection_cost = 1.0f;
+	this->InitConfig.rebuild_sah_ratio = 1.5f;
+}
+
+void CPUBVH::Initialize
+()
+{
+	auto StartTime = std::chrono::steady_clock::now();
+
+	const unsigned int PrimitiveCount = this->InitConfig.primitive_count;
+
+	this->Config.nodes.clear();
+	this->Config.wide_nodes.clear();
+	this->Config.quantized_nodes.clear();
+	this->Config.wide_sources.clear();
+	this->Config.wide_slots.clear();
+	this->Config.primitive_indices.resize(PrimitiveCount);
+	this->Config.node_count = 0;
+	this->Config.depth = 0;
+	this->Config.sah_cost = 0.0f;
+	this->Config.sah_area_sum = 0.0;
+	this->Config.node_parents.clear();
+	this->Config.primitive_leaves.clear();
+
+	if (PrimitiveCount == 0 || this->InitConfig.ptr_primitive_bounds == nullptr)
+	{
+		if (PrimitiveCount > 0)
+		{
+			fprintf(stderr, "%s: %s\n", this->Config.name, this->Config.error_message);
+		}
+
+		return;
+	}
+
+	// Pad the primitive bounds out for the builder, and precompute their centroids.
+	this->Config.build_primitives.resize(PrimitiveCount);
+
+	for (unsigned int i = 0; i < PrimitiveCount; i++)
+	{
+		const BVHBounds& Bounds = this->InitConfig.ptr_primitive_bounds[i];
+		BVHBuildPrimitive& Primitive = this->Config.build_primitives[i];
+
+		Primitive = BVHBuildPrimitive
+		{
+			{ Bounds.Min.x, Bounds.Min.y, Bounds.Min.z, 0.0f },
+			{ Bounds.Max.x, Bounds.Max.y, Bounds.Max.z, 0.0f },
+			{ (Bounds.Min.x + Bounds.Max.x) * 0.5f, (Bounds.Min.y + Bounds.Max.y) * 0.5f, (Bounds.Min.z + Bounds.Max.z) * 0.5f, 0.0f },
+			i
+		};
+
+		this->Config.primitive_indices[i] = i;
+	}
+
+	// A binary tree over N primitives never has more than 2N - 1 nodes. Nodes are handed out in pairs by an atomic counter, so subtrees can be built concurrently.
+	this->Config.nodes.resize(2 * (size_t)PrimitiveCount - 1);
+	this->Config.node_count = 1;
+
+	BVHBuildTask RootTask{ 0, 0, PrimitiveCount, 1 };
+
+	if ((this->InitConfig.build_flags & BVH_BUILD_FLAG_PREFER_FAST_BUILD) != 0 && (this->InitConfig.build_flags & BVH_BUILD_FLAG_PREFER_FAST_TRACE) == 0)
+	{
+		this->SortPrimitivesByMortonCode();
+
+		this->RunBuildTasks([this, RootTask]() { this->BuildLBVHSubtree(RootTask); });
+
+		this->RunBuildTasks([this]() { this->RefitSubtree(0, 0); });
+	}
+	else
+	{
+		this->RunBuildTasks([this, RootTask]() { this->BuildSAHSubtree(RootTask); });
+
+		for (unsigned int i = 0; i < PrimitiveCount; i++)
+		{
+			this->Config.primitive_indices[i] = this->Config.build_primitives[i].PrimitiveIndex;
+		}
+	}
+
+	this->Config.nodes.resize(this->Config.node_count);
+	this->Config.nodes.shrink_to_fit();
+
+	this->ComputeStatistics();
+
+	if (this->InitConfig.branching_factor >= BVH8Width)
+	{
+		this->CollapseToBVH8(this->Config.nodes.data());
+
+		// Only the wide hierarchy gets traced, so the binary one is just for refits.
+		if ((this->InitConfig.build_flags & BVH_BUILD_FLAG_MINIMIZE_MEMORY) != 0 && (this->InitConfig.build_flags & BVH_BUILD_FLAG_ALLOW_UPDATE) == 0)
+		{
+			this->Config.nodes = std::vector<BVHNode>{};
+		}
+	}
+
+	// Release the scratch memory.
+	this->Config.build_primitives = std::vector<BVHBuildPrimitive>{};
+	this->Config.morton_codes = std::vector<unsigned int>{};
+
+	this->Config.build_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+}
+
+bool CPUBVH::Update
+(
+	const unsigned int* pChangedPrimitives,
+	unsigned int ChangedPrimitiveCount
+)
+{
+	auto StartTime = std::chrono::steady_clock::now();
+
+	const unsigned int PrimitiveCount = this->InitConfig.primitive_count;
+
+	bool Rebuild =
+		(this->InitConfig.build_flags & BVH_BUILD_FLAG_ALLOW_UPDATE) == 0 ||
+		this->Config.nodes.empty() == true ||
+		this->Config.primitive_leaves.size() != PrimitiveCount;
+
+	if (Rebuild == false)
+	{
+		if (pChangedPrimitives == nullptr || ChangedPrimitiveCount > PrimitiveCount / BVHIncrementalRefitDivisor)
+		{
+			this->RunBuildTasks([this]() { this->Config.sah_area_sum = this->RefitSubtree(0, 0); });
+
+			this->EncodeAllWideNodeBounds();
+		}
+		else
+		{
+			// Walk up from the leaf of every primitive that moved, until a node's bounds come out the same as before.
+			for (unsigned int i = 0; i < ChangedPrimitiveCount; i++)
+			{
+				if (pChangedPrimitives[i] >= PrimitiveCount)
+				{
+					continue;
+				}
+
+				unsigned int NodeIndex = this->Config.primitive_leaves[pChangedPrimitives[i]];
+
+				while (true)
+				{
+					const BVHNode& Node = this->Config.nodes[NodeIndex];
+
+					float OldArea = GetSurfaceArea(Node);
+
+					if (this->RefitNode(NodeIndex) == false)
+					{
+						break;
+					}
+
+					this->Config.sah_area_sum += (double)this->GetNodeCost(Node) * (double)(GetSurfaceArea(Node) - OldArea);
+
+					if (this->Config.wide_slots.empty() == false && this->Config.wide_slots[NodeIndex] != ~0U)
+					{
+						unsigned int WideIndex = this->Config.wide_slots[NodeIndex] / BVH8Width;
+
+						this->EncodeWideNodeBounds(WideIndex, &(this->Config.wide_sources[(size_t)WideIndex * BVH8Width]));
+					}
+
+					if (NodeIndex == 0)
+					{
+						break;
+					}
+
+					NodeIndex = this->Config.node_parents[NodeIndex];
+				}
+			}
+		}
+
+		float RootArea = GetSurfaceArea(this->Config.nodes[0]);
+
+		if (RootArea > 0.0f)
+		{
+			this->Config.sah_cost = (float)(this->Config.sah_area_sum / (double)RootArea);
+		}
+
+		this->Config.refit_count++;
+
+		// The tree no longer fits the primitives well enough, so start over.
+		Rebuild = this->Config.sah_cost > this->Config.built_sah_cost * this->InitConfig.rebuild_sah_ratio;
+	}
+
+	if (Rebuild == true)
+	{
+		this->Initialize();
+		this->Config.rebuild_count++;
+	}
+
+	this->Config.update_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+	return Rebuild;
+}
+
+unsigned int CPUBVH::GetNodeCount
+() const
+{
+	return this->Config.node_count;
+}
+
+unsigned int CPUBVH::GetWideNodeCount
+() const
+{
+	return (unsigned int)(this->Config.wide_nodes.size() + this->Config.quantized_nodes.size());
+}
+
+bool CPUBVH::IsQuantized
+() const
+{
+	return this->Config.quantized_nodes.empty() == false;
+}
+
+size_t CPUBVH::GetMemoryByteSize
+() const
+{
+	return
+		(this->Config.nodes.capacity() * sizeof(BVHNode)) +
+		(this->Config.wide_nodes.capacity() * sizeof(BVH8Node)) +
+		(this->Config.quantized_nodes.capacity() * sizeof(BVH8QuantizedNode)) +
+		(this->Config.primitive_indices.capacity() * sizeof(unsigned int)) +
+		(this->Config.node_parents.capacity() * sizeof(unsigned int)) +
+		(this->Config.primitive_leaves.capacity() * sizeof(unsigned int)) +
+		(this->Config.wide_sources.capacity() * sizeof(unsigned int)) +
+		(this->Config.wide_slots.capacity() * sizeof(unsigned int));
+}
+
+unsigned int CPUBVH::GetDepth
+() const
+{
+	return this->Config.depth;
+}
+
+float CPUBVH::GetSAHCost
+() const
+{
+	return this->Config.sah_cost;
+}
+
+double CPUBVH::GetBuildSeconds
+() const
+{
+	return this->Config.build_seconds;
+}
+
+double CPUBVH::GetUpdateSeconds
+() const
+{
+	return this->Config.update_seconds;
+}
+
+unsigned int CPUBVH::GetRefitCount
+() const
+{
+	return this->Config.refit_count;
+}
+
+unsigned int CPUBVH::GetRebuildCount
+() const
+{
+	return this->Config.rebuild_count;
+}
+
+CPUBVH::~CPUBVH
+()
+{
+	// Nothing here, for now.
+}
+
+void CPUBVH::RunBuildTasks
+(
+	const std::function<void()>& Function
+)
+{
+	if (this->InitConfig.ptr_thread_pool != nullptr)
+	{
+		this->InitConfig.ptr_thread_pool->Run(Function);
+	}
+	else
+	{
+		Function();
+	}
+}
+
+bool CPUBVH::SpawnSubtree
+(
+	const BVHBuildTask& Task,
+	void (CPUBVH::*pBuildSubtree)(BVHBuildTask)
+)
+{
+	if (this->InitConfig.ptr_thread_pool == nullptr || Task.count < BVHParallelSubtreeThreshold)
+	{
+		return false;
+	}
+
+	this->InitConfig.ptr_thread_pool->Spawn([this, Task, pBuildSubtree]() { (this->*pBuildSubtree)(Task); });
+
+	return true;
+}
+
+void CPUBVH::BuildSAHSubtree
+(
+	BVHBuildTask RootTask
+)
+{
+	const unsigned int MaxBinCount = std::min(std::max(this->InitConfig.bin_count, 2U), BVHMaxBinCount);
+	const unsigned int MaxLeafSize = std::max(this->InitConfig.max_leaf_size, 1U);
+	std::vector<BVHBuildTask> Tasks{ RootTask };
+
+	SAHBinSet Bins{};
+	float RightAreas[BVHMaxBinCount]{};
+	unsigned int RightCounts[BVHMaxBinCount]{};
+
+	// Per-chunk results, for nodes big enough to bin in parallel.
+	std::vector<RangeBounds> ChunkBounds;
+	std::vector<SAHBinSet> ChunkBins;
+
+	while (Tasks.empty() == false)
+	{
+		BVHBuildTask Task = Tasks.back();
+		Tasks.pop_back();
+
+		BVHBuildPrimitive* pPrimitives = &(this->Config.build_primitives[Task.first]);
+
+		bool ParallelBinning = (this->InitConfig.ptr_thread_pool != nullptr) && (Task.count >= BVHParallelBinningThreshold);
+		unsigned int ChunkCount = (Task.count + BVHParallelBinningGrain - 1) / BVHParallelBinningGrain;
+
+		// Bounds of the node, and of its primitives' centroids, which the bins are laid over.
+		RangeBounds Bounds{};
+
+		if (ParallelBinning == true)
+		{
+			ChunkBounds.resize(ChunkCount);
+
+			this->InitConfig.ptr_thread_pool->ParallelFor
+			(
+				Task.count,
+				BVHParallelBinningGrain,
+				[&](unsigned int Begin, unsigned int End)
+				{
+					ComputeRangeBounds(pPrimitives + Begin, End - Begin, &(ChunkBounds[Begin / BVHParallelBinningGrain]));
+				}
+			);
+
+			ResetRangeBounds(&Bounds);
+
+			for (const RangeBounds& Chunk : ChunkBounds)
+			{
+				GrowRangeBounds(&Bounds, Chunk);
+			}
+		}
+		else
+		{
+			ComputeRangeBounds(pPrimitives, Task.count, &Bounds);
+		}
+
+		BVHNode& Node = this->Config.nodes[Task.node_index];
+		Node.MinX = Bounds.Min[0];
+		Node.MinY = Bounds.Min[1];
+		Node.MinZ = Bounds.Min[2];
+		Node.MaxX = Bounds.Max[0];
+		Node.MaxY = Bounds.Max[1];
+		Node.MaxZ = Bounds.Max[2];
+
+		bool ForceLeaf = (Task.count == 1) || (Task.depth >= BVHMaxDepth - 1);
+
+		// Small nodes don't need many bins, and resetting and sweeping them would cost more than the binning itself.
+		const unsigned int BinCount = std::min(MaxBinCount, std::max(Task.count, 4U));
+
+		// Bin the centroids along every axis in one pass.
+		alignas(16) float BinScale[4]{};
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			float Extent = Bounds.CentroidMax[Axis] - Bounds.CentroidMin[Axis];
+
+			BinScale[Axis] = Extent > 0.0f ? (float)BinCount / Extent : 0.0f;
+		}
+
+		if (ForceLeaf == false)
+		{
+			if (ParallelBinning == true)
+			{
+				ChunkBins.resize(ChunkCount);
+
+				this->InitConfig.ptr_thread_pool->ParallelFor
+				(
+					Task.count,
+					BVHParallelBinningGrain,
+					[&](unsigned int Begin, unsigned int End)
+					{
+						SAHBinSet& ChunkBinSet = ChunkBins[Begin / BVHParallelBinningGrain];
+
+						ResetBins(&ChunkBinSet, BinCount);
+						BinPrimitives(pPrimitives + Begin, End - Begin, Bounds.CentroidMin, BinScale, BinCount, &ChunkBinSet);
+					}
+				);
+
+				ResetBins(&Bins, BinCount);
+
+				for (const SAHBinSet& ChunkBinSet : ChunkBins)
+				{
+					MergeBins(&Bins, ChunkBinSet, BinCount);
+				}
+			}
+			else
+			{
+				ResetBins(&Bins, BinCount);
+				BinPrimitives(pPrimitives, Task.count, Bounds.CentroidMin, BinScale, BinCount, &Bins);
+			}
+		}
+
+		// Find the cheapest split plane over every axis.
+		float LeafCost = this->InitConfig.intersection_cost * (float)Task.count;
+		float NodeArea = GetSurfaceArea(Bounds.Min, Bounds.Max);
+		float BestCost = 1.0e30f;
+		unsigned int BestAxis = 0;
+		unsigned int BestBin = 0;
+
+		for (unsigned int Axis = 0; Axis < 3 && ForceLeaf == false; Axis++)
+		{
+			if (BinScale[Axis] == 0.0f)
+			{
+				continue;
+			}
+
+			// Sweep from the right, then from the left, to evaluate every plane between two bins.
+			alignas(16) float SweepMin[4], SweepMax[4];
+			unsigned int SweepCount{ 0 };
+
+			ResetBounds(SweepMin, SweepMax);
+
+			for (unsigned int Bin = BinCount - 1; Bin > 0; Bin--)
+			{
+				GrowBounds(SweepMin, SweepMax, Bins.Bins[Axis][Bin].Min, Bins.Bins[Axis][Bin].Max);
+				SweepCount += Bins.Bins[Axis][Bin].PrimitiveCount;
+				RightAreas[Bin] = GetSurfaceArea(SweepMin, SweepMax);
+				RightCounts[Bin] = SweepCount;
+			}
+
+			ResetBounds(SweepMin, SweepMax);
+			SweepCount = 0;
+
+			for (unsigned int Bin = 0; Bin < BinCount - 1; Bin++)
+			{
+				GrowBounds(SweepMin, SweepMax, Bins.Bins[Axis][Bin].Min, Bins.Bins[Axis][Bin].Max);
+				SweepCount += Bins.Bins[Axis][Bin].PrimitiveCount;
+
+				if (SweepCount == 0 || RightCounts[Bin + 1] == 0)
+				{
+					continue;
+				}
+
+				float Cost = this->InitConfig.traversal_cost + this->InitConfig.intersection_cost *
+					((GetSurfaceArea(SweepMin, SweepMax) * (float)SweepCount) + (RightAreas[Bin + 1] * (float)RightCounts[Bin + 1])) / NodeArea;
+
+				if (Cost < BestCost)
+				{
+					BestCost = Cost;
+					BestAxis = Axis;
+					BestBin = Bin;
+				}
+			}
+		}
+
+		if (ForceLeaf == true || (Task.count <= MaxLeafSize && LeafCost <= BestCost))
+		{
+			Node.LeftOrFirst = Task.first;
+			Node.PrimitiveCount = Task.count;
+			continue;
+		}
+
+		// Partition the primitives around the chosen plane, binning them the same way as above so that they land on the same side.
+		unsigned int LeftCount{ 0 };
+
+		if (BestCost < 1.0e30f)
+		{
+			BVHBuildPrimitive* pMiddle = std::partition
+			(
+				pPrimitives,
+				pPrimitives + Task.count,
+				[&](const BVHBuildPrimitive& Primitive)
+				{
+					alignas(16) int BinIndices[4];
+					GetBinIndices(Primitive, Bounds.CentroidMin, BinScale, (float)(BinCount - 1), BinIndices);
+
+					return (unsigned int)BinIndices[BestAxis] <= BestBin;
+				}
+			);
+
+			LeftCount = (unsigned int)(pMiddle - pPrimitives);
+		}
+
+		// Every centroid is in the same spot, so there is no plane to split on; just halve the list.
+		if (LeftCount == 0 || LeftCount == Task.count)
+		{
+			LeftCount = Task.count / 2;
+		}
+
+		unsigned int LeftIndex = this->Config.node_count.fetch_add(2);
+
+		Node.LeftOrFirst = LeftIndex;
+		Node.PrimitiveCount = 0;
+
+		BVHBuildTask RightTask{ LeftIndex + 1, Task.first + LeftCount, Task.count - LeftCount, Task.depth + 1 };
+		BVHBuildTask LeftTask{ LeftIndex, Task.first, LeftCount, Task.depth + 1 };
+
+		if (this->SpawnSubtree(RightTask, &CPUBVH::BuildSAHSubtree) == false)
+		{
+			Tasks.push_back(RightTask);
+		}
+
+		if (this->SpawnSubtree(LeftTask, &CPUBVH::BuildSAHSubtree) == false)
+		{
+			Tasks.push_back(LeftTask);
+		}
+	}
+}
+
+void CPUBVH::BuildLBVHSubtree
+(
+	BVHBuildTask RootTask
+)
+{
+	const unsigned int MaxLeafSize = std::max(this->InitConfig.max_leaf_size, 1U);
+	const unsigned int* pCodes = this->Config.morton_codes.data();
+
+	std::vector<BVHBuildTask> Tasks{ RootTask };
+
+	while (Tasks.empty() == false)
+	{
+		BVHBuildTask Task = Tasks.back();
+		Tasks.pop_back();
+
+		BVHNode& Node = this->Config.nodes[Task.node_index];
+
+		if (Task.count <= MaxLeafSize || Task.depth >= BVHMaxDepth - 1)
+		{
+			Node.LeftOrFirst = Task.first;
+			Node.PrimitiveCount = Task.count;
+			continue;
+		}
+
+		// Split where the highest bit that differs across the range flips. (Karras 2012)
+		unsigned int Last = Task.first + Task.count - 1;
+		unsigned int FirstCode = pCodes[Task.first];
+		unsigned int LeftCount = Task.count / 2;
+
+		if (FirstCode != pCodes[Last])
+		{
+			unsigned int CommonPrefix = CountLeadingZeros(FirstCode ^ pCodes[Last]);
+			unsigned int Split = Task.first;
+			unsigned int Step = Last - Task.first;
+
+			do
+			{
+				Step = (Step + 1) >> 1;
+
+				unsigned int NewSplit = Split + Step;
+
+				if (NewSplit < Last && CountLeadingZeros(FirstCode ^ pCodes[NewSplit]) > CommonPrefix)
+				{
+					Split = NewSplit;
+				}
+			}
+			while (Step > 1);
+
+			LeftCount = Split - Task.first + 1;
+		}
+
+		unsigned int LeftIndex = this->Config.node_count.fetch_add(2);
+
+		Node.LeftOrFirst = LeftIndex;
+		Node.PrimitiveCount = 0;
+
+		BVHBuildTask RightTask{ LeftIndex + 1, Task.first + LeftCount, Task.count - LeftCount, Task.depth + 1 };
+		BVHBuildTask LeftTask{ LeftIndex, Task.first, LeftCount, Task.depth + 1 };
+
+		if (this->SpawnSubtree(RightTask, &CPUBVH::BuildLBVHSubtree) == false)
+		{
+			Tasks.push_back(RightTask);
+		}
+
+		if (this->SpawnSubtree(LeftTask, &CPUBVH::BuildLBVHSubtree) == false)
+		{
+			Tasks.push_back(LeftTask);
+		}
+	}
+}
+
+void CPUBVH::SortPrimitivesByMortonCode
+()
+{
+	const unsigned int PrimitiveCount = this->InitConfig.primitive_count;
+	const BVHBuildPrimitive* pPrimitives = this->Config.build_primitives.data();
+
+	RangeBounds Bounds{};
+	ComputeRangeBounds(pPrimitives, PrimitiveCount, &Bounds);
+
+	// Quantize the centroids to 10 bits per axis, and interleave them.
+	float Scale[3]{};
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		float Extent = Bounds.CentroidMax[Axis] - Bounds.CentroidMin[Axis];
+
+		Scale[Axis] = Extent > 0.0f ? 1023.0f / Extent : 0.0f;
+	}
+
+	std::vector<unsigned long long> Keys(PrimitiveCount);
+
+	auto ComputeKeys = [&](unsigned int Begin, unsigned int End)
+	{
+		for (unsigned int i = Begin; i < End; i++)
+		{
+			unsigned int Code{ 0 };
+
+			for (unsigned int Axis = 0; Axis < 3; Axis++)
+			{
+				float Quantized = (pPrimitives[i].Centroid[Axis] - Bounds.CentroidMin[Axis]) * Scale[Axis];
+
+				Code |= ExpandMortonBits((unsigned int)std::min(std::max(Quantized, 0.0f), 1023.0f)) << (2 - Axis);
+			}
+
+			Keys[i] = ((unsigned long long)Code << 32) | i;
+		}
+	};
+
+	if (this->InitConfig.ptr_thread_pool != nullptr)
+	{
+		this->InitConfig.ptr_thread_pool->ParallelFor(PrimitiveCount, BVHParallelBinningGrain, ComputeKeys);
+	}
+	else
+	{
+		ComputeKeys(0, PrimitiveCount);
+	}
+
+	// Radix sort the 30-bit codes, 8 bits per pass.
+	std::vector<unsigned long long> SortedKeys(PrimitiveCount);
+
+	for (unsigned int Shift = 32; Shift < 64; Shift += 8)
+	{
+		unsigned int Offsets[256]{};
+
+		for (unsigned long long Key : Keys)
+		{
+			Offsets[(Key >> Shift) & 0xFF]++;
+		}
+
+		unsigned int Sum{ 0 };
+
+		for (unsigned int Digit = 0; Digit < 256; Digit++)
+		{
+			unsigned int Count = Offsets[Digit];
+			Offsets[Digit] = Sum;
+			Sum += Count;
+		}
+
+		for (unsigned long long Key : Keys)
+		{
+			SortedKeys[Offsets[(Key >> Shift) & 0xFF]++] = Key;
+		}
+
+		Keys.swap(SortedKeys);
+	}
+
+	this->Config.morton_codes.resize(PrimitiveCount);
+
+	for (unsigned int i = 0; i < PrimitiveCount; i++)
+	{
+		this->Config.morton_codes[i] = (unsigned int)(Keys[i] >> 32);
+		this->Config.primitive_indices[i] = (unsigned int)(Keys[i] & 0xFFFFFFFFU);
+	}
+}
+
+float CPUBVH::GetNodeCost
+(
+	const BVHNode& Node
+) const
+{
+	return Node.PrimitiveCount == 0 ? this->InitConfig.traversal_cost : this->InitConfig.intersection_cost * (float)Node.PrimitiveCount;
+}
+
+bool CPUBVH::RefitNode
+(
+	unsigned int NodeIndex
+)
+{
+	BVHNode& Node = this->Config.nodes[NodeIndex];
+
+	alignas(16) float Min[4], Max[4];
+	ResetBounds(Min, Max);
+
+	if (Node.PrimitiveCount > 0)
+	{
+		for (unsigned int i = 0; i < Node.PrimitiveCount; i++)
+		{
+			const BVHBounds& Bounds = this->InitConfig.ptr_primitive_bounds[this->Config.primitive_indices[Node.LeftOrFirst + i]];
+
+			alignas(16) float PrimitiveMin[4]{ Bounds.Min.x, Bounds.Min.y, Bounds.Min.z, 0.0f };
+			alignas(16) float PrimitiveMax[4]{ Bounds.Max.x, Bounds.Max.y, Bounds.Max.z, 0.0f };
+
+			GrowBounds(Min, Max, PrimitiveMin, PrimitiveMax);
+		}
+	}
+	else
+	{
+		for (unsigned int Child = Node.LeftOrFirst; Child < Node.LeftOrFirst + 2; Child++)
+		{
+			const BVHNode& ChildNode = this->Config.nodes[Child];
+
+			alignas(16) float ChildMin[4]{ ChildNode.MinX, ChildNode.MinY, ChildNode.MinZ, 0.0f };
+			alignas(16) float ChildMax[4]{ ChildNode.MaxX, ChildNode.MaxY, ChildNode.MaxZ, 0.0f };
+
+			GrowBounds(Min, Max, ChildMin, ChildMax);
+		}
+	}
+
+	bool Changed =
+		Node.MinX != Min[0] || Node.MinY != Min[1] || Node.MinZ != Min[2] ||
+		Node.MaxX != Max[0] || Node.MaxY != Max[1] || Node.MaxZ != Max[2];
+
+	Node.MinX = Min[0];
+	Node.MinY = Min[1];
+	Node.MinZ = Min[2];
+	Node.MaxX = Max[0];
+	Node.MaxY = Max[1];
+	Node.MaxZ = Max[2];
+
+	return Changed;
+}
+
+double CPUBVH::RefitSubtree
+(
+	unsigned int NodeIndex,
+	unsigned int Depth
+)
+{
+	const BVHNode& Node = this->Config.nodes[NodeIndex];
+
+	double AreaSum{ 0.0 };
+
+	if (Node.PrimitiveCount == 0)
+	{
+		const unsigned int LeftIndex = Node.LeftOrFirst;
+
+		bool Parallel =
+			(this->InitConfig.ptr_thread_pool != nullptr) &&
+			(Depth < BVHParallelRefitDepth) &&
+			(this->InitConfig.primitive_count >= BVHParallelSubtreeThreshold);
+
+		if (Parallel == true)
+		{
+			// Hand the left child to another worker, and do the right one here.
+			std::atomic<unsigned int> GroupCounter{ 0 };
+			double LeftAreaSum{ 0.0 };
+
+			this->InitConfig.ptr_thread_pool->Spawn([this, LeftIndex, Depth, &LeftAreaSum]() { LeftAreaSum = this->RefitSubtree(LeftIndex, Depth + 1); }, &GroupCounter);
+
+			AreaSum = this->RefitSubtree(LeftIndex + 1, Depth + 1);
+
+			this->InitConfig.ptr_thread_pool->Wait(&GroupCounter);
+
+			AreaSum += LeftAreaSum;
+		}
+		else
+		{
+			AreaSum = this->RefitSubtree(LeftIndex, Depth + 1) + this->RefitSubtree(LeftIndex + 1, Depth + 1);
+		}
+	}
+
+	this->RefitNode(NodeIndex);
+
+	return AreaSum + (double)this->GetNodeCost(Node) * (double)GetSurfaceArea(Node);
+}
+
+void CPUBVH::ComputeStatistics
+()
+{
+	const unsigned int NodeCount = (unsigned int)this->Config.nodes.size();
+
+	std::vector<unsigned int> Depths(NodeCount, 1);
+
+	float RootArea = GetSurfaceArea(this->Config.nodes[0]);
+	float CostSum{ 0.0f };
+
+	bool KeepParents = (this->InitConfig.build_flags & BVH_BUILD_FLAG_ALLOW_UPDATE) != 0;
+
+	if (KeepParents == true)
+	{
+		this->Config.node_parents.assign(NodeCount, 0);
+		this->Config.primitive_leaves.assign(this->InitConfig.primitive_count, 0);
+	}
+
+	this->Config.depth = 0;
+	this->Config.sah_area_sum = 0.0;
+
+	for (unsigned int i = 0; i < NodeCount; i++)
+	{
+		const BVHNode& Node = this->Config.nodes[i];
+
+		if (Node.PrimitiveCount == 0)
+		{
+			Depths[Node.LeftOrFirst] = Depths[i] + 1;
+			Depths[Node.LeftOrFirst + 1] = Depths[i] + 1;
+
+			if (KeepParents == true)
+			{
+				this->Config.node_parents[Node.LeftOrFirst] = i;
+				this->Config.node_parents[Node.LeftOrFirst + 1] = i;
+			}
+		}
+		else
+		{
+			this->Config.depth = std::max(this->Config.depth, Depths[i]);
+
+			if (KeepParents == true)
+			{
+				for (unsigned int j = 0; j < Node.PrimitiveCount; j++)
+				{
+					this->Config.primitive_leaves[this->Config.primitive_indices[Node.LeftOrFirst + j]] = i;
+				}
+			}
+		}
+
+		CostSum += this->GetNodeCost(Node);
+		this->Config.sah_area_sum += (double)this->GetNodeCost(Node) * (double)GetSurfaceArea(Node);
+	}
+
+	this->Config.sah_cost = RootArea > 0.0f ? (float)(this->Config.sah_area_sum / (double)RootArea) : CostSum;
+	this->Config.built_sah_cost = this->Config.sah_cost;
+}
+
+void CPUBVH::CollapseToBVH8
+(
+	const BVHNode* pNodes
+)
+{
+	const unsigned int NodeCount = this->Config.node_count;
+
+	bool Quantize = (this->InitConfig.build_flags & BVH_BUILD_FLAG_MINIMIZE_MEMORY) != 0;
+
+	for (unsigned int i = 0; i < NodeCount && Quantize == true; i++)
+	{
+		if (pNodes[i].PrimitiveCount > BVHQuantizedMaxLeafSize)
+		{
+			fprintf(stderr, "%s: A leaf has more than %u primitives, which quantized nodes can't hold; keeping full-precision ones.\n", this->Config.name, BVHQuantizedMaxLeafSize);
+			Quantize = false;
+		}
+	}
+
+	GetIntersectBVH8NodeFunctions(&(this->Config.ptr_intersect_wide_node), &(this->Config.ptr_intersect_quantized_node));
+
+	// Binary node behind every child slot, and the wide node or leaf each slot points to.
+	std::vector<unsigned int>& Sources = this->Config.wide_sources;
+	std::vector<unsigned int> Children;
+	std::vector<unsigned int> PrimitiveCounts;
+
+	// Binary nodes that wide nodes still have to be made for, in the order the wide nodes are numbered.
+	std::vector<unsigned int> Pending{ 0 };
+
+	for (size_t i = 0; i < Pending.size(); i++)
+	{
+		const BVHNode& Root = pNodes[Pending[i]];
+
+		// Open up the biggest interior child until there are 8 of them, or only leaves left.
+		unsigned int Slots[BVH8Width]{};
+		unsigned int SlotCount{ 0 };
+
+		if (Root.PrimitiveCount > 0)
+		{
+			Slots[SlotCount++] = Pending[i];
+		}
+		else
+		{
+			Slots[SlotCount++] = Root.LeftOrFirst;
+			Slots[SlotCount++] = Root.LeftOrFirst + 1;
+		}
+
+		while (SlotCount < BVH8Width)
+		{
+			unsigned int Largest = BVH8Width;
+			float LargestArea = -1.0f;
+
+			for (unsigned int Slot = 0; Slot < SlotCount; Slot++)
+			{
+				const BVHNode& SlotNode = pNodes[Slots[Slot]];
+
+				if (SlotNode.PrimitiveCount == 0 && GetSurfaceArea(SlotNode) > LargestArea)
+				{
+					Largest = Slot;
+					LargestArea = GetSurfaceArea(SlotNode);
+				}
+			}
+
+			if (Largest == BVH8Width)
+			{
+				break;
+			}
+
+			unsigned int Opened = Slots[Largest];
+
+			Slots[Largest] = pNodes[Opened].LeftOrFirst;
+			Slots[SlotCount++] = pNodes[Opened].LeftOrFirst + 1;
+		}
+
+		for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+		{
+			if (Slot >= SlotCount)
+			{
+				Sources.push_back(~0U);
+				Children.push_back(0);
+				PrimitiveCounts.push_back(0);
+				continue;
+			}
+
+			const BVHNode& SlotNode = pNodes[Slots[Slot]];
+
+			Sources.push_back(Slots[Slot]);
+
+			if (SlotNode.PrimitiveCount > 0)
+			{
+				Children.push_back(SlotNode.LeftOrFirst);
+				PrimitiveCounts.push_back(SlotNode.PrimitiveCount);
+			}
+			else
+			{
+				Children.push_back((unsigned int)Pending.size());
+				PrimitiveCounts.push_back(0);
+
+				Pending.push_back(Slots[Slot]);
+			}
+		}
+	}
+
+	const unsigned int WideNodeCount = (unsigned int)Pending.size();
+
+	if (Quantize == true)
+	{
+		this->Config.quantized_nodes.resize(WideNodeCount);
+	}
+	else
+	{
+		this->Config.wide_nodes.resize(WideNodeCount);
+	}
+
+	for (unsigned int i = 0; i < WideNodeCount; i++)
+	{
+		for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+		{
+			size_t Index = ((size_t)i * BVH8Width) + Slot;
+
+			if (Quantize == true)
+			{
+				this->Config.quantized_nodes[i].Children[Slot] = Children[Index];
+				this->Config.quantized_nodes[i].PrimitiveCounts[Slot] = (unsigned char)PrimitiveCounts[Index];
+			}
+			else
+			{
+				this->Config.wide_nodes[i].Children[Slot] = Children[Index];
+				this->Config.wide_nodes[i].PrimitiveCounts[Slot] = PrimitiveCounts[Index];
+			}
+		}
+	}
+
+	this->EncodeAllWideNodeBounds();
+
+	// Keep the links between the two hierarchies around for refits.
+	if ((this->InitConfig.build_flags & BVH_BUILD_FLAG_ALLOW_UPDATE) != 0)
+	{
+		this->Config.wide_slots.assign(NodeCount, ~0U);
+
+		for (size_t i = 0; i < Sources.size(); i++)
+		{
+			if (Sources[i] != ~0U)
+			{
+				this->Config.wide_slots[Sources[i]] = (unsigned int)i;
+			}
+		}
+
+		Sources.shrink_to_fit();
+	}
+	else
+	{
+		Sources = std::vector<unsigned int>{};
+	}
+}
+
+void CPUBVH::EncodeWideNodeBounds
+(
+	unsigned int WideIndex,
+	const unsigned int* pSources
+)
+{
+	const BVHNode* pNodes = this->Config.nodes.data();
+
+	if (this->Config.quantized_nodes.empty() == true)
+	{
+		BVH8Node& WideNode = this->Config.wide_nodes[WideIndex];
+
+		for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+		{
+			if (pSources[Slot] == ~0U)
+			{
+				// Inverted bounds, which every ray misses.
+				for (unsigned int Plane = 0; Plane < 3; Plane++)
+				{
+					WideNode.Bounds[Plane][Slot] = +1.0e30f;
+					WideNode.Bounds[Plane + 3][Slot] = -1.0e30f;
+				}
+
+				continue;
+			}
+
+			const BVHNode& Node = pNodes[pSources[Slot]];
+
+			WideNode.Bounds[0][Slot] = Node.MinX;
+			WideNode.Bounds[1][Slot] = Node.MinY;
+			WideNode.Bounds[2][Slot] = Node.MinZ;
+			WideNode.Bounds[3][Slot] = Node.MaxX;
+			WideNode.Bounds[4][Slot] = Node.MaxY;
+			WideNode.Bounds[5][Slot] = Node.MaxZ;
+		}
+
+		return;
+	}
+
+	BVH8QuantizedNode& QuantizedNode = this->Config.quantized_nodes[WideIndex];
+
+	// The frame is the union of the children's bounds.
+	float Min[3]{ +1.0e30f, +1.0e30f, +1.0e30f };
+	float Max[3]{ -1.0e30f, -1.0e30f, -1.0e30f };
+
+	QuantizedNode.ChildMask = 0;
+
+	for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+	{
+		if (pSources[Slot] == ~0U)
+		{
+			continue;
+		}
+
+		const BVHNode& Node = pNodes[pSources[Slot]];
+
+		Min[0] = std::min(Min[0], Node.MinX);
+		Min[1] = std::min(Min[1], Node.MinY);
+		Min[2] = std::min(Min[2], Node.MinZ);
+		Max[0] = std::max(Max[0], Node.MaxX);
+		Max[1] = std::max(Max[1], Node.MaxY);
+		Max[2] = std::max(Max[2], Node.MaxZ);
+
+		QuantizedNode.ChildMask |= (unsigned char)(1U << Slot);
+	}
+
+	// Smallest power-of-two step that spans the frame in 255 of them.
+	float Scales[3]{};
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		QuantizedNode.Origin[Axis] = Min[Axis];
+
+		int Exponent{ -126 };
+		float Extent = Max[Axis] - Min[Axis];
+
+		if (Extent > 0.0f)
+		{
+			std::frexp(Extent / 255.0f, &Exponent);
+			Exponent = std::max(Exponent, -126);
+		}
+
+		while (Exponent < 127 && Min[Axis] + (255.0f * GetQuantizationScale(Exponent)) < Max[Axis])
+		{
+			Exponent++;
+		}
+
+		QuantizedNode.Exponents[Axis] = (signed char)Exponent;
+		Scales[Axis] = GetQuantizationScale(Exponent);
+	}
+
+	for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+	{
+		if (pSources[Slot] == ~0U)
+		{
+			for (unsigned int Axis = 0; Axis < 3; Axis++)
+			{
+				QuantizedNode.QuantizedBounds[Axis][Slot] = 255;
+				QuantizedNode.QuantizedBounds[Axis + 3][Slot] = 0;
+			}
+
+			continue;
+		}
+
+		const BVHNode& Node = pNodes[pSources[Slot]];
+
+		float ChildMin[3]{ Node.MinX, Node.MinY, Node.MinZ };
+		float ChildMax[3]{ Node.MaxX, Node.MaxY, Node.MaxZ };
+
+		// Round outwards, and step out further wherever the decoded plane still falls short of the exact one.
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			const float Origin = QuantizedNode.Origin[Axis];
+
+			int Low = (int)std::floor((ChildMin[Axis] - Origin) / Scales[Axis]);
+			int High = (int)std::ceil((ChildMax[Axis] - Origin) / Scales[Axis]);
+
+			Low = std::min(std::max(Low, 0), 255);
+			High = std::min(std::max(High, 0), 255);
+
+			while (Low > 0 && Origin + ((float)Low * Scales[Axis]) > ChildMin[Axis])
+			{
+				Low--;
+			}
+
+			while (High < 255 && Origin + ((float)High * Scales[Axis]) < ChildMax[Axis])
+			{
+				High++;
+			}
+
+			QuantizedNode.QuantizedBounds[Axis][Slot] = (unsigned char)Low;
+			QuantizedNode.QuantizedBounds[Axis + 3][Slot] = (unsigned char)High;
+		}
+	}
+}
+
+void CPUBVH::EncodeAllWideNodeBounds
+()
+{
+	const unsigned int WideNodeCount = this->GetWideNodeCount();
+
+	if (this->Config.wide_sources.size() != (size_t)WideNodeCount * BVH8Width)
+	{
+		return;
+	}
+
+	auto EncodeRange = [this](unsigned int Begin, unsigned int End)
+	{
+		for (unsigned int i = Begin; i < End; i++)
+		{
+			this->EncodeWideNodeBounds(i, &(this->Config.wide_sources[(size_t)i * BVH8Width]));
+		}
+	};
+
+	if (this->InitConfig.ptr_thread_pool != nullptr)
+	{
+		this->InitConfig.ptr_thread_pool->ParallelFor(WideNodeCount, BVHParallelBinningGrain, EncodeRange);
+	}
+	else
+	{
+		EncodeRange(0, WideNodeCount);
+	}
+}
@@ -0,0 +1,972 @@
+// CPUBVH.hpp - Bounding volume hierarchy over axis-aligned boxes, built with the surface area heuristic, for the CPU rendering path.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#include "CPUShaderStuff.hpp"
+#include "CPUWorkStealingPool.hpp"
+
+// Build flags, matching the D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS values.
+enum BVH_BUILD_FLAG : unsigned int
+{
+	BVH_BUILD_FLAG_NONE = 0x00,
+	BVH_BUILD_FLAG_ALLOW_UPDATE = 0x01,
+	BVH_BUILD_FLAG_PREFER_FAST_TRACE = 0x04,
+	BVH_BUILD_FLAG_PREFER_FAST_BUILD = 0x08,
+	BVH_BUILD_FLAG_MINIMIZE_MEMORY = 0x10,
+	BVH_BUILD_FLAG_PERFORM_UPDATE = 0x20
+};
+
+// Axis-aligned bounding box.
+struct BVHBounds
+{
+	Float3 Min;
+	Float3 Max;
+};
+
+// A node of the hierarchy, 32 bytes so that two share a cache line.
+struct BVHNode
+{
+	// Bounds of everything below this node.
+	float MinX, MinY, MinZ;
+
+	// Interior nodes: index of the left child, with the right child right after it. Leaves: first entry in the primitive index list.
+	unsigned int LeftOrFirst;
+
+	float MaxX, MaxY, MaxZ;
+
+	// Number of primitives in a leaf, or 0 for an interior node.
+	unsigned int PrimitiveCount;
+};
+
+// Maximum depth of the hierarchy, which bounds the traversal stack.
+const unsigned int BVHMaxDepth{ 64 };
+
+// Number of children of a node of the wide hierarchy.
+const unsigned int BVH8Width{ 8 };
+
+// Most wide nodes the traversal may have on its stack: up to 7 siblings left over per level.
+const unsigned int BVH8MaxStackSize{ BVHMaxDepth * (BVH8Width - 1) + 1 };
+
+// Marks a traversal stack entry as a leaf child, stored as node index * 8 + child slot.
+const unsigned int BVH8LeafFlag{ 0x80000000U };
+
+// A node of the 8-wide hierarchy that the binary one gets collapsed into, with the bounds of its children laid out SoA, so that one AVX2 register holds the same plane of all eight.
+struct alignas(64) BVH8Node
+{
+	// Child bounds, as MinX, MinY, MinZ, MaxX, MaxY, MaxZ. Empty slots have inverted bounds, which every ray misses.
+	float Bounds[6][BVH8Width];
+
+	// Interior children: index of their wide node. Leaves: first entry in the primitive index list.
+	unsigned int Children[BVH8Width];
+
+	// Number of primitives in a leaf child, or 0 for an interior one.
+	unsigned int PrimitiveCounts[BVH8Width];
+};
+
+// A node of the 8-wide hierarchy with the bounds of its children quantized to 8 bits per plane, relative to the node's own bounds, for BVH_BUILD_FLAG_MINIMIZE_MEMORY. 112 bytes, rather than 256.
+struct alignas(16) BVH8QuantizedNode
+{
+	// Frame the children are quantized in: Plane = Origin + Quantized * 2^Exponent, per axis.
+	float Origin[3];
+	signed char Exponents[3];
+
+	// Bit per child slot in use.
+	unsigned char ChildMask;
+
+	// Child bounds, as MinX, MinY, MinZ, MaxX, MaxY, MaxZ, rounded outwards so that the decoded planes never cover less than the exact ones.
+	unsigned char QuantizedBounds[6][BVH8Width];
+
+	// Interior children: index of their wide node. Leaves: first entry in the primitive index list.
+	unsigned int Children[BVH8Width];
+
+	// Number of primitives in a leaf child, or 0 for an interior one.
+	unsigned char PrimitiveCounts[BVH8Width];
+};
+
+// Precomputed per-ray values for the wide node tests.
+struct BVH8Ray
+{
+	// Each plane is then a subtract and a multiply away: t = (Plane - Origin) * InverseDirection, rounded the same way as in IntersectBVHNode().
+	float Origin[3];
+	float InverseDirection[3];
+
+	// Rows of BVH8Node::Bounds the ray enters and leaves each slab through, picked by the sign of its direction.
+	unsigned int NearPlanes[3];
+	unsigned int FarPlanes[3];
+
+	float TMin;
+};
+
+// Tests a ray against all of a wide node's children. Returns a bit mask of the ones hit within [TMin, TMax], and writes their entry distances to pEntries.
+typedef unsigned int (*IntersectBVH8NodeFunction)(const BVH8Ray& Ray, const BVH8Node& Node, float TMax, float* pEntries);
+typedef unsigned int (*IntersectBVH8QuantizedNodeFunction)(const BVH8Ray& Ray, const BVH8QuantizedNode& Node, float TMax, float* pEntries);
+
+// Bounds of a packet of rays whose directions share their signs, for testing the wide nodes against every ray of it at once, with interval arithmetic.
+// The entry distance of the packet is then never farther than any of its rays' entries, and its exit never nearer than any of their exits, so a node it misses is missed by all of them. (The frustum of the packet, without its planes.)
+struct BVH8PacketFrustum
+{
+	// Ranges of the origins and of the inverse directions of the rays, per axis.
+	float MinOrigin[3];
+	float MaxOrigin[3];
+	float MinInverseDirection[3];
+	float MaxInverseDirection[3];
+
+	// Rows of BVH8Node::Bounds the rays enter and leave each slab through, the same for all of them.
+	unsigned int NearPlanes[3];
+	unsigned int FarPlanes[3];
+
+	// Nearest TMin of the rays.
+	float TMin;
+};
+
+// Fills out the bounds of a packet of rays. Returns false if their directions don't all share their signs, or have zero components, in which case the packet has to be traced one ray at a time.
+inline bool GetBVH8PacketFrustum(const Float3* pOrigins, const Float3* pDirections, const float* pTMins, unsigned int RayCount, BVH8PacketFrustum* pFrustum)
+{
+	if (RayCount == 0)
+	{
+		return false;
+	}
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		pFrustum->MinOrigin[Axis] = +std::numeric_limits<float>::infinity();
+		pFrustum->MaxOrigin[Axis] = -std::numeric_limits<float>::infinity();
+		pFrustum->MinInverseDirection[Axis] = +std::numeric_limits<float>::infinity();
+		pFrustum->MaxInverseDirection[Axis] = -std::numeric_limits<float>::infinity();
+	}
+
+	pFrustum->TMin = +std::numeric_limits<float>::infinity();
+
+	const float FirstDirection[3]{ pDirections[0].x, pDirections[0].y, pDirections[0].z };
+
+	for (unsigned int i = 0; i < RayCount; i++)
+	{
+		float Origin[3]{ pOrigins[i].x, pOrigins[i].y, pOrigins[i].z };
+		float Direction[3]{ pDirections[i].x, pDirections[i].y, pDirections[i].z };
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			if (Direction[Axis] == 0.0f || (Direction[Axis] < 0.0f) != (FirstDirection[Axis] < 0.0f))
+			{
+				return false;
+			}
+
+			float InverseDirection = 1.0f / Direction[Axis];
+
+			pFrustum->MinOrigin[Axis] = Origin[Axis] < pFrustum->MinOrigin[Axis] ? Origin[Axis] : pFrustum->MinOrigin[Axis];
+			pFrustum->MaxOrigin[Axis] = Origin[Axis] > pFrustum->MaxOrigin[Axis] ? Origin[Axis] : pFrustum->MaxOrigin[Axis];
+			pFrustum->MinInverseDirection[Axis] = InverseDirection < pFrustum->MinInverseDirection[Axis] ? InverseDirection : pFrustum->MinInverseDirection[Axis];
+			pFrustum->MaxInverseDirection[Axis] = InverseDirection > pFrustum->MaxInverseDirection[Axis] ? InverseDirection : pFrustum->MaxInverseDirection[Axis];
+		}
+
+		pFrustum->TMin = pTMins[i] < pFrustum->TMin ? pTMins[i] : pFrustum->TMin;
+	}
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		pFrustum->NearPlanes[Axis] = pFrustum->MinInverseDirection[Axis] < 0.0f ? Axis + 3 : Axis;
+		pFrustum->FarPlanes[Axis] = pFrustum->MinInverseDirection[Axis] < 0.0f ? Axis : Axis + 3;
+	}
+
+	return true;
+}
+
+// Tests a packet of rays against all of a wide node's children. Returns a bit mask of the ones any of the rays may hit within [TMin, TMax], and writes the packet's entry distances to pEntries.
+inline unsigned int IntersectBVH8NodePacket(const BVH8PacketFrustum& Frustum, const BVH8Node& Node, float TMax, float* pEntries)
+{
+	unsigned int HitMask{ 0 };
+
+	for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+	{
+		float TEnter = Frustum.TMin;
+		float TExit = TMax;
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			// t = (Plane - Origin) * InverseDirection is monotonic in both, so its extremes over the packet are among the products of the ranges' ends. Rounding is monotonic too, so this holds for the rounded t of every ray.
+			float NearLow = Node.Bounds[Frustum.NearPlanes[Axis]][Slot] - Frustum.MaxOrigin[Axis];
+			float NearHigh = Node.Bounds[Frustum.NearPlanes[Axis]][Slot] - Frustum.MinOrigin[Axis];
+			float FarLow = Node.Bounds[Frustum.FarPlanes[Axis]][Slot] - Frustum.MaxOrigin[Axis];
+			float FarHigh = Node.Bounds[Frustum.FarPlanes[Axis]][Slot] - Frustum.MinOrigin[Axis];
+
+			float TNear = std::min(std::min(NearLow * Frustum.MinInverseDirection[Axis], NearLow * Frustum.MaxInverseDirection[Axis]), std::min(NearHigh * Frustum.MinInverseDirection[Axis], NearHigh * Frustum.MaxInverseDirection[Axis]));
+			float TFar = std::max(std::max(FarLow * Frustum.MinInverseDirection[Axis], FarLow * Frustum.MaxInverseDirection[Axis]), std::max(FarHigh * Frustum.MinInverseDirection[Axis], FarHigh * Frustum.MaxInverseDirection[Axis]));
+
+			TEnter = TNear > TEnter ? TNear : TEnter;
+			TExit = TFar < TExit ? TFar : TExit;
+		}
+
+		pEntries[Slot] = TEnter;
+		HitMask |= (TEnter <= TExit ? 1U : 0U) << Slot;
+	}
+
+	return HitMask;
+}
+
+// Bounds and centroid of a primitive, padded out to SSE registers for the builder. The binned builder partitions these directly, to keep its passes sequential.
+struct alignas(64) BVHBuildPrimitive
+{
+	float Min[4];
+	float Max[4];
+	float Centroid[4];
+	unsigned int PrimitiveIndex;
+};
+
+// A node waiting to be built, covering primitive_indices[first, first + count).
+struct BVHBuildTask
+{
+	unsigned int node_index;
+	unsigned int first;
+	unsigned int count;
+	unsigned int depth;
+};
+
+// Precomputed per-ray values for the box tests.
+struct BVHRay
+{
+	Float3 Origin;
+	Float3 InverseDirection;
+	float TMin;
+};
+
+// Tests a ray against a node's bounds with the slab method. Returns the entry distance, or +infinity if it misses within [TMin, TMax].
+inline float IntersectBVHNode(const BVHRay& Ray, const BVHNode& Node, float TMax)
+{
+	float tx0 = (Node.MinX - Ray.Origin.x) * Ray.InverseDirection.x;
+	float tx1 = (Node.MaxX - Ray.Origin.x) * Ray.InverseDirection.x;
+	float ty0 = (Node.MinY - Ray.Origin.y) * Ray.InverseDirection.y;
+	float ty1 = (Node.MaxY - Ray.Origin.y) * Ray.InverseDirection.y;
+	float tz0 = (Node.MinZ - Ray.Origin.z) * Ray.InverseDirection.z;
+	float tz1 = (Node.MaxZ - Ray.Origin.z) * Ray.InverseDirection.z;
+
+	float TEnter = Ray.TMin;
+	TEnter = (tx0 < tx1 ? tx0 : tx1) > TEnter ? (tx0 < tx1 ? tx0 : tx1) : TEnter;
+	TEnter = (ty0 < ty1 ? ty0 : ty1) > TEnter ? (ty0 < ty1 ? ty0 : ty1) : TEnter;
+	TEnter = (tz0 < tz1 ? tz0 : tz1) > TEnter ? (tz0 < tz1 ? tz0 : tz1) : TEnter;
+
+	float TExit = TMax;
+	TExit = (tx0 > tx1 ? tx0 : tx1) < TExit ? (tx0 > tx1 ? tx0 : tx1) : TExit;
+	TExit = (ty0 > ty1 ? ty0 : ty1) < TExit ? (ty0 > ty1 ? ty0 : ty1) : TExit;
+	TExit = (tz0 > tz1 ? tz0 : tz1) < TExit ? (tz0 > tz1 ? tz0 : tz1) : TExit;
+
+	return TEnter <= TExit ? TEnter : std::numeric_limits<float>::infinity();
+}
+
+// Config data for this class.
+struct CPUBVHConfig
+{
+	// Nodes, with the root at index 0.
+	std::vector<BVHNode> nodes;
+
+	// Nodes of the 8-wide hierarchy, with the root at index 0, if InitConfig.branching_factor asks for one.
+	std::vector<BVH8Node> wide_nodes;
+
+	// Nodes of the 8-wide hierarchy, quantized, in place of wide_nodes with BVH_BUILD_FLAG_MINIMIZE_MEMORY.
+	std::vector<BVH8QuantizedNode> quantized_nodes;
+
+	// Binary node behind every child slot of every wide node (node index * 8 + slot), or ~0 for empty slots, and the other way around, so that refits can keep the wide nodes up to date.
+	// Only kept with BVH_BUILD_FLAG_ALLOW_UPDATE.
+	std::vector<unsigned int> wide_sources;
+	std::vector<unsigned int> wide_slots;
+
+	// Wide node tests for the instruction set in use. (See GetSphereKernelISA().)
+	IntersectBVH8NodeFunction ptr_intersect_wide_node;
+	IntersectBVH8QuantizedNodeFunction ptr_intersect_quantized_node;
+
+	// Primitive indices, referenced by the leaves.
+	std::vector<unsigned int> primitive_indices;
+
+	// Number of nodes handed out so far, during a build.
+	std::atomic<unsigned int> node_count;
+
+	// Primitive bounds and centroids, during a build. (Kept in primitive_indices order by the binned builder.)
+	std::vector<BVHBuildPrimitive> build_primitives;
+
+	// Morton codes of the primitive centroids, sorted along with primitive_indices, during a fast build.
+	std::vector<unsigned int> morton_codes;
+
+	// Depth of the deepest leaf.
+	unsigned int depth;
+
+	// SAH cost of the hierarchy, relative to the root's surface area.
+	float sah_cost;
+
+	// Sum of every node's cost times its surface area, which refits keep up to date to recompute sah_cost from.
+	double sah_area_sum;
+
+	// SAH cost right after the last build, which refits are measured against.
+	float built_sah_cost;
+
+	// Parent of every node, and the leaf holding every primitive, for refitting only what moved. Only kept with BVH_BUILD_FLAG_ALLOW_UPDATE.
+	std::vector<unsigned int> node_parents;
+	std::vector<unsigned int> primitive_leaves;
+
+	// Wall-clock duration of the last build, and of the last update.
+	double build_seconds;
+	double update_seconds;
+
+	// Number of updates that refitted the hierarchy, and that rebuilt it instead.
+	unsigned int refit_count;
+	unsigned int rebuild_count;
+
+	// Label for this class.
+	const char* name;
+
+	// Error message for initialization.
+	const char* error_message;
+};
+
+// Populate this before calling the initializer function.
+struct CPUBVHInitConfig
+{
+	// Bounds of the primitives to build over.
+	const BVHBounds* ptr_primitive_bounds;
+	unsigned int primitive_count;
+
+	// BVH_BUILD_FLAG_PREFER_FAST_TRACE builds with the binned surface area heuristic.
+	// BVH_BUILD_FLAG_PREFER_FAST_BUILD sorts the primitives along a Morton curve and splits it up instead (LBVH), which is much quicker but traces slower.
+	unsigned int build_flags;
+
+	// Pool to build subtrees in parallel on. Builds on the calling thread alone if nullptr.
+	CPUWorkStealingPool* ptr_thread_pool;
+
+	// 2 to trace the binary hierarchy as built, or 8 to collapse it into an 8-wide one first, whose nodes are tested with SIMD.
+	unsigned int branching_factor;
+
+	// Number of SAH bins per axis.
+	unsigned int bin_count;
+
+	// Leaves never hold more than this many primitives.
+	unsigned int max_leaf_size;
+
+	// Relative SAH costs of visiting a node and of intersecting a primitive.
+	float traversal_cost;
+	float intersection_cost;
+
+	// Update() rebuilds from scratch once refitting has grown the SAH cost past this multiple of its cost after the last build.
+	float rebuild_sah_ratio;
+};
+
+// Bounding volume hierarchy over a set of boxes, with closest-hit and any-hit traversal.
+class CPUBVH
+{
+public:
+	// Constructor.
+	CPUBVH();
+
+	// Populate this before calling the initializer function.
+	CPUBVHInitConfig InitConfig;
+
+	// Initializes the instance of this class.
+	// Builds the hierarchy top-down, with the method picked by InitConfig.build_flags.
+	void Initialize();
+
+	// Equivalent of a build with BVH_BUILD_FLAG_PERFORM_UPDATE. Refits the node bounds to the current primitive bounds, keeping the tree as it is.
+	// Only the paths above the primitives listed in pChangedPrimitives get refitted, or every node, in parallel, if it is nullptr.
+	// Rebuilds from scratch instead if the SAH cost has drifted past InitConfig.rebuild_sah_ratio, or if the last build didn't have BVH_BUILD_FLAG_ALLOW_UPDATE. Returns true if it rebuilt.
+	bool Update(const unsigned int* pChangedPrimitives, unsigned int ChangedPrimitiveCount);
+
+	// Visits the leaves front-to-back, skipping any node farther away than *pTMax, which IntersectPrimitive may shrink as it finds closer hits.
+	// IntersectPrimitive(PrimitiveIndex, pTMax) returns true to end the traversal early.
+	template<typename IntersectPrimitiveFunction>
+	void TraverseClosestHit(Float3 Origin, Float3 Direction, float TMin, float* pTMax, IntersectPrimitiveFunction&& IntersectPrimitive) const;
+
+	// Visits the leaves in whatever order is cheapest, until IntersectPrimitive(PrimitiveIndex, pTMax) returns true. For occlusion and first-hit rays.
+	template<typename IntersectPrimitiveFunction>
+	void TraverseAnyHit(Float3 Origin, Float3 Direction, float TMin, float* pTMax, IntersectPrimitiveFunction&& IntersectPrimitive) const;
+
+	// Visits the leaves any ray of a packet may hit, front-to-back by the packet's entry distance, skipping any node farther away than *pMaxTMax: the farthest of the rays' closest hits so far, which IntersectPrimitive(PrimitiveIndex, pMaxTMax) keeps up to date.
+	// IntersectPrimitive returns true to end the traversal early. Only the 8-wide hierarchy with full-precision nodes can be traced this way; returns false without visiting anything for the others.
+	template<typename IntersectPrimitiveFunction>
+	bool TraverseClosestHitPacket(const BVH8PacketFrustum& Frustum, float* pMaxTMax, IntersectPrimitiveFunction&& IntersectPrimitive) const;
+
+	// Returns the number of nodes.
+	unsigned int GetNodeCount() const;
+
+	// Returns the number of nodes of the 8-wide hierarchy, or 0 if the binary one gets traced.
+	unsigned int GetWideNodeCount() const;
+
+	// Returns whether the 8-wide hierarchy has quantized nodes.
+	bool IsQuantized() const;
+
+	// Returns the memory held onto by the hierarchy, in bytes.
+	size_t GetMemoryByteSize() const;
+
+	// Returns the depth of the deepest leaf.
+	unsigned int GetDepth() const;
+
+	// Returns the SAH cost of the hierarchy.
+	float GetSAHCost() const;
+
+	// Returns the duration of the last build, in seconds.
+	double GetBuildSeconds() const;
+
+	// Returns the duration of the last Update() call, in seconds.
+	double GetUpdateSeconds() const;
+
+	// Returns the number of Update() calls that refitted the hierarchy, and that rebuilt it.
+	unsigned int GetRefitCount() const;
+	unsigned int GetRebuildCount() const;
+
+	// Destructor.
+	~CPUBVH();
+
+protected:
+	// Config data for this object.
+	CPUBVHConfig Config;
+
+	// Sets up the per-ray values for the box tests.
+	static BVHRay GetBVHRay(Float3 Origin, Float3 Direction, float TMin);
+	static BVH8Ray GetBVH8Ray(Float3 Origin, Float3 Direction, float TMin);
+
+	// Traversals of the binary and of the 8-wide hierarchy. (See TraverseClosestHit() and TraverseAnyHit().)
+	template<typename IntersectPrimitiveFunction>
+	void TraverseClosestHitBVH2(Float3 Origin, Float3 Direction, float TMin, float* pTMax, IntersectPrimitiveFunction& IntersectPrimitive) const;
+
+	template<typename WideNodeType, typename IntersectPrimitiveFunction>
+	void TraverseClosestHitBVH8
+	(
+		const WideNodeType* pNodes,
+		unsigned int (*pIntersectNode)(const BVH8Ray&, const WideNodeType&, float, float*),
+		Float3 Origin,
+		Float3 Direction,
+		float TMin,
+		float* pTMax,
+		IntersectPrimitiveFunction& IntersectPrimitive
+	) const;
+
+	template<typename IntersectPrimitiveFunction>
+	void TraverseAnyHitBVH2(Float3 Origin, Float3 Direction, float TMin, float* pTMax, IntersectPrimitiveFunction& IntersectPrimitive) const;
+
+	template<typename WideNodeType, typename IntersectPrimitiveFunction>
+	void TraverseAnyHitBVH8
+	(
+		const WideNodeType* pNodes,
+		unsigned int (*pIntersectNode)(const BVH8Ray&, const WideNodeType&, float, float*),
+		Float3 Origin,
+		Float3 Direction,
+		float TMin,
+		float* pTMax,
+		IntersectPrimitiveFunction& IntersectPrimitive
+	) const;
+
+	// Runs Function on the thread pool if there is one, or on the calling thread if not.
+	void RunBuildTasks(const std::function<void()>& Function);
+
+	// Queues a subtree to be built on another worker if it's big enough to be worth it. Returns false if the caller should build it itself.
+	bool SpawnSubtree(const BVHBuildTask& Task, void (CPUBVH::*pBuildSubtree)(BVHBuildTask));
+
+	// Builds a subtree with the binned surface area heuristic.
+	void BuildSAHSubtree(BVHBuildTask Task);
+
+	// Builds a subtree by splitting the Morton-sorted primitives where their codes first differ.
+	void BuildLBVHSubtree(BVHBuildTask Task);
+
+	// Sorts the primitives along a Morton curve through their centroids.
+	void SortPrimitivesByMortonCode();
+
+	// Returns the SAH cost of a node, before weighting by its surface area.
+	float GetNodeCost(const BVHNode& Node) const;
+
+	// Recomputes the bounds of a node from its children, or from its primitives. Returns true if they changed.
+	bool RefitNode(unsigned int NodeIndex);
+
+	// Recomputes the bounds of every node of a subtree, bottom-up, with the top levels split across the thread pool. Returns the subtree's sum of node cost times surface area.
+	double RefitSubtree(unsigned int NodeIndex, unsigned int Depth);
+
+	// Computes the depth and SAH cost of the hierarchy, and the parent links for updates.
+	void ComputeStatistics();
+
+	// Collapses the binary hierarchy into an 8-wide one, top-down, by repeatedly opening up the child with the largest surface area.
+	// Quantizes the wide nodes with BVH_BUILD_FLAG_MINIMIZE_MEMORY.
+	void CollapseToBVH8(const BVHNode* pNodes);
+
+	// Writes the bounds of a wide node's children, from the binary nodes behind them.
+	void EncodeWideNodeBounds(unsigned int WideIndex, const unsigned int* pSources);
+
+	// Brings every wide node up to date with the binary nodes, after a full refit.
+	void EncodeAllWideNodeBounds();
+
+};
+
+inline BVHRay CPUBVH::GetBVHRay
+(
+	Float3 Origin,
+	Float3 Direction,
+	float TMin
+)
+{
+	BVHRay Ray{};
+	Ray.Origin = Origin;
+	Ray.InverseDirection = Float3{ 1.0f / Direction.x, 1.0f / Direction.y, 1.0f / Direction.z };
+	Ray.TMin = TMin;
+
+	return Ray;
+}
+
+inline BVH8Ray CPUBVH::GetBVH8Ray
+(
+	Float3 Origin,
+	Float3 Direction,
+	float TMin
+)
+{
+	BVH8Ray Ray{};
+	Ray.InverseDirection[0] = 1.0f / Direction.x;
+	Ray.InverseDirection[1] = 1.0f / Direction.y;
+	Ray.InverseDirection[2] = 1.0f / Direction.z;
+	Ray.Origin[0] = Origin.x;
+	Ray.Origin[1] = Origin.y;
+	Ray.Origin[2] = Origin.z;
+
+	for (unsigned int Axis = 0; Axis < 3; Axis++)
+	{
+		Ray.NearPlanes[Axis] = Ray.InverseDirection[Axis] < 0.0f ? Axis + 3 : Axis;
+		Ray.FarPlanes[Axis] = Ray.InverseDirection[Axis] < 0.0f ? Axis : Axis + 3;
+	}
+
+	Ray.TMin = TMin;
+
+	return Ray;
+}
+
+template<typename IntersectPrimitiveFunction>
+inline void CPUBVH::TraverseClosestHit
+(
+	Float3 Origin,
+	Float3 Direction,
+	float TMin,
+	float* pTMax,
+	IntersectPrimitiveFunction&& IntersectPrimitive
+) const
+{
+	if (this->Config.quantized_nodes.empty() == false)
+	{
+		this->TraverseClosestHitBVH8(this->Config.quantized_nodes.data(), this->Config.ptr_intersect_quantized_node, Origin, Direction, TMin, pTMax, IntersectPrimitive);
+	}
+	else if (this->Config.wide_nodes.empty() == false)
+	{
+		this->TraverseClosestHitBVH8(this->Config.wide_nodes.data(), this->Config.ptr_intersect_wide_node, Origin, Direction, TMin, pTMax, IntersectPrimitive);
+	}
+	else
+	{
+		this->TraverseClosestHitBVH2(Origin, Direction, TMin, pTMax, IntersectPrimitive);
+	}
+}
+
+template<typename IntersectPrimitiveFunction>
+inline void CPUBVH::TraverseAnyHit
+(
+	Float3 Origin,
+	Float3 Direction,
+	float TMin,
+	float* pTMax,
+	IntersectPrimitiveFunction&& IntersectPrimitive
+) const
+{
+	if (this->Config.quantized_nodes.empty() == false)
+	{
+		this->TraverseAnyHitBVH8(this->Config.quantized_nodes.data(), this->Config.ptr_intersect_quantized_node, Origin, Direction, TMin, pTMax, IntersectPrimitive);
+	}
+	else if (this->Config.wide_nodes.empty() == false)
+	{
+		this->TraverseAnyHitBVH8(this->Config.wide_nodes.data(), this->Config.ptr_intersect_wide_node, Origin, Direction, TMin, pTMax, IntersectPrimitive);
+	}
+	else
+	{
+		this->TraverseAnyHitBVH2(Origin, Direction, TMin, pTMax, IntersectPrimitive);
+	}
+}
+
+template<typename IntersectPrimitiveFunction>
+inline bool CPUBVH::TraverseClosestHitPacket
+(
+	const BVH8PacketFrustum& Frustum,
+	float* pMaxTMax,
+	IntersectPrimitiveFunction&& IntersectPrimitive
+) const
+{
+	if (this->Config.wide_nodes.empty() == true)
+	{
+		return false;
+	}
+
+	const BVH8Node* pNodes = this->Config.wide_nodes.data();
+
+	// Stack of nodes and leaves yet to visit, along with the packet's entry distances, as in TraverseClosestHitBVH8().
+	unsigned int NodeStack[BVH8MaxStackSize];
+	float EntryStack[BVH8MaxStackSize];
+	unsigned int StackSize{ 0 };
+
+	NodeStack[StackSize] = 0;
+	EntryStack[StackSize] = Frustum.TMin;
+	StackSize++;
+
+	while (StackSize > 0)
+	{
+		StackSize--;
+
+		if (EntryStack[StackSize] > *pMaxTMax)
+		{
+			continue;
+		}
+
+		unsigned int Entry = NodeStack[StackSize];
+
+		if ((Entry & BVH8LeafFlag) != 0)
+		{
+			const BVH8Node& LeafParent = pNodes[(Entry & ~BVH8LeafFlag) / BVH8Width];
+			const unsigned int Slot = Entry % BVH8Width;
+
+			for (unsigned int i = 0; i < LeafParent.PrimitiveCounts[Slot]; i++)
+			{
+				if (IntersectPrimitive(this->Config.primitive_indices[LeafParent.Children[Slot] + i], pMaxTMax) == true)
+				{
+					return true;
+				}
+			}
+
+			continue;
+		}
+
+		const BVH8Node& Node = pNodes[Entry];
+
+		alignas(32) float ChildEntries[BVH8Width];
+		unsigned int HitMask = IntersectBVH8NodePacket(Frustum, Node, *pMaxTMax, ChildEntries);
+
+		unsigned int HitChildren[BVH8Width];
+		float HitEntries[BVH8Width];
+		unsigned int HitCount{ 0 };
+
+		for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+		{
+			if ((HitMask & (1U << Slot)) == 0)
+			{
+				continue;
+			}
+
+			unsigned int Child = Node.PrimitiveCounts[Slot] > 0 ? BVH8LeafFlag | ((Entry * BVH8Width) + Slot) : Node.Children[Slot];
+			float ChildEntry = ChildEntries[Slot];
+
+			unsigned int i = HitCount++;
+
+			while (i > 0 && HitEntries[i - 1] < ChildEntry)
+			{
+				HitChildren[i] = HitChildren[i - 1];
+				HitEntries[i] = HitEntries[i - 1];
+				i--;
+			}
+
+			HitChildren[i] = Child;
+			HitEntries[i] = ChildEntry;
+		}
+
+		for (unsigned int i = 0; i < HitCount; i++)
+		{
+			NodeStack[StackSize] = HitChildren[i];
+			EntryStack[StackSize] = HitEntries[i];
+			StackSize++;
+		}
+	}
+
+	return true;
+}
+
+template<typename IntersectPrimitiveFunction>
+inline void CPUBVH::TraverseClosestHitBVH2
+(
+	Float3 Origin,
+	Float3 Direction,
+	float TMin,
+	float* pTMax,
+	IntersectPrimitiveFunction& IntersectPrimitive
+) const
+{
+	if (this->Config.nodes.empty() == true)
+	{
+		return;
+	}
+
+	BVHRay Ray = GetBVHRay(Origin, Direction, TMin);
+
+	const BVHNode* pNodes = this->Config.nodes.data();
+
+	// Stack of nodes yet to visit, along with their entry distances.
+	unsigned int NodeStack[BVHMaxDepth];
+	float EntryStack[BVHMaxDepth];
+	unsigned int StackSize{ 0 };
+
+	float RootEntry = IntersectBVHNode(Ray, pNodes[0], *pTMax);
+
+	if (RootEntry > *pTMax)
+	{
+		return;
+	}
+
+	NodeStack[StackSize] = 0;
+	EntryStack[StackSize] = RootEntry;
+	StackSize++;
+
+	while (StackSize > 0)
+	{
+		StackSize--;
+
+		// Skip nodes that got farther away than the closest hit since they were pushed.
+		if (EntryStack[StackSize] > *pTMax)
+		{
+			continue;
+		}
+
+		const BVHNode* pNode = &(pNodes[NodeStack[StackSize]]);
+
+		while (pNode->PrimitiveCount == 0)
+		{
+			const BVHNode* pLeft = &(pNodes[pNode->LeftOrFirst]);
+			const BVHNode* pRight = pLeft + 1;
+
+			float LeftEntry = IntersectBVHNode(Ray, *pLeft, *pTMax);
+			float RightEntry = IntersectBVHNode(Ray, *pRight, *pTMax);
+
+			if (LeftEntry > RightEntry)
+			{
+				float SwapEntry = LeftEntry;
+				LeftEntry = RightEntry;
+				RightEntry = SwapEntry;
+
+				const BVHNode* pSwapNode = pLeft;
+				pLeft = pRight;
+				pRight = pSwapNode;
+			}
+
+			if (LeftEntry > *pTMax)
+			{
+				pNode = nullptr;
+				break;
+			}
+
+			// Descend into the nearer child right away, and come back for the farther one.
+			if (RightEntry <= *pTMax)
+			{
+				NodeStack[StackSize] = (unsigned int)(pRight - pNodes);
+				EntryStack[StackSize] = RightEntry;
+				StackSize++;
+			}
+
+			pNode = pLeft;
+		}
+
+		if (pNode == nullptr)
+		{
+			continue;
+		}
+
+		for (unsigned int i = 0; i < pNode->PrimitiveCount; i++)
+		{
+			if (IntersectPrimitive(this->Config.primitive_indices[pNode->LeftOrFirst + i], pTMax) == true)
+			{
+				return;
+			}
+		}
+	}
+}
+
+template<typename WideNodeType, typename IntersectPrimitiveFunction>
+inline void CPUBVH::TraverseClosestHitBVH8
+(
+	const WideNodeType* pNodes,
+	unsigned int (*pIntersectNode)(const BVH8Ray&, const WideNodeType&, float, float*),
+	Float3 Origin,
+	Float3 Direction,
+	float TMin,
+	float* pTMax,
+	IntersectPrimitiveFunction& IntersectPrimitive
+) const
+{
+	BVH8Ray Ray = GetBVH8Ray(Origin, Direction, TMin);
+
+	// Stack of nodes and leaves yet to visit, along with their entry distances.
+	unsigned int NodeStack[BVH8MaxStackSize];
+	float EntryStack[BVH8MaxStackSize];
+	unsigned int StackSize{ 0 };
+
+	NodeStack[StackSize] = 0;
+	EntryStack[StackSize] = TMin;
+	StackSize++;
+
+	while (StackSize > 0)
+	{
+		StackSize--;
+
+		// Skip entries that got farther away than the closest hit since they were pushed.
+		if (EntryStack[StackSize] > *pTMax)
+		{
+			continue;
+		}
+
+		unsigned int Entry = NodeStack[StackSize];
+
+		if ((Entry & BVH8LeafFlag) != 0)
+		{
+			const WideNodeType& LeafParent = pNodes[(Entry & ~BVH8LeafFlag) / BVH8Width];
+			const unsigned int Slot = Entry % BVH8Width;
+
+			for (unsigned int i = 0; i < LeafParent.PrimitiveCounts[Slot]; i++)
+			{
+				if (IntersectPrimitive(this->Config.primitive_indices[LeafParent.Children[Slot] + i], pTMax) == true)
+				{
+					return;
+				}
+			}
+
+			continue;
+		}
+
+		const WideNodeType& Node = pNodes[Entry];
+
+		alignas(32) float ChildEntries[BVH8Width];
+		unsigned int HitMask = pIntersectNode(Ray, Node, *pTMax, ChildEntries);
+
+		// Sort the children that were hit far-to-near, so that the nearest one gets popped first.
+		unsigned int HitChildren[BVH8Width];
+		float HitEntries[BVH8Width];
+		unsigned int HitCount{ 0 };
+
+		for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+		{
+			if ((HitMask & (1U << Slot)) == 0)
+			{
+				continue;
+			}
+
+			unsigned int Child = Node.PrimitiveCounts[Slot] > 0 ? BVH8LeafFlag | ((Entry * BVH8Width) + Slot) : Node.Children[Slot];
+			float ChildEntry = ChildEntries[Slot];
+
+			unsigned int i = HitCount++;
+
+			while (i > 0 && HitEntries[i - 1] < ChildEntry)
+			{
+				HitChildren[i] = HitChildren[i - 1];
+				HitEntries[i] = HitEntries[i - 1];
+				i--;
+			}
+
+			HitChildren[i] = Child;
+			HitEntries[i] = ChildEntry;
+		}
+
+		for (unsigned int i = 0; i < HitCount; i++)
+		{
+			NodeStack[StackSize] = HitChildren[i];
+			EntryStack[StackSize] = HitEntries[i];
+			StackSize++;
+		}
+	}
+}
+
+template<typename IntersectPrimitiveFunction>
+inline void CPUBVH::TraverseAnyHitBVH2
+(
+	Float3 Origin,
+	Float3 Direction,
+	float TMin,
+	float* pTMax,
+	IntersectPrimitiveFunction& IntersectPrimitive
+) const
+{
+	if (this->Config.nodes.empty() == true)
+	{
+		return;
+	}
+
+	BVHRay Ray = GetBVHRay(Origin, Direction, TMin);
+
+	const BVHNode* pNodes = this->Config.nodes.data();
+
+	unsigned int NodeStack[BVHMaxDepth];
+	unsigned int StackSize{ 0 };
+
+	NodeStack[StackSize++] = 0;
+
+	while (StackSize > 0)
+	{
+		const BVHNode& Node = pNodes[NodeStack[--StackSize]];
+
+		if (IntersectBVHNode(Ray, Node, *pTMax) > *pTMax)
+		{
+			continue;
+		}
+
+		if (Node.PrimitiveCount == 0)
+		{
+			NodeStack[StackSize++] = Node.LeftOrFirst + 1;
+			NodeStack[StackSize++] = Node.LeftOrFirst;
+			continue;
+		}
+
+		for (unsigned int i = 0; i < Node.PrimitiveCount; i++)
+		{
+			if (IntersectPrimitive(this->Config.primitive_indices[Node.LeftOrFirst + i], pTMax) == true)
+			{
+				return;
+			}
+		}
+	}
+}
+
+template<typename WideNodeType, typename IntersectPrimitiveFunction>
+inline void CPUBVH::TraverseAnyHitBVH8
+(
+	const WideNodeType* pNodes,
+	unsigned int (*pIntersectNode)(const BVH8Ray&, const WideNodeType&, float, float*),
+	Float3 Origin,
+	Float3 Direction,
+	float TMin,
+	float* pTMax,
+	IntersectPrimitiveFunction& IntersectPrimitive
+) const
+{
+	BVH8Ray Ray = GetBVH8Ray(Origin, Direction, TMin);
+
+	unsigned int NodeStack[BVH8MaxStackSize];
+	unsigned int StackSize{ 0 };
+
+	NodeStack[StackSize++] = 0;
+
+	while (StackSize > 0)
+	{
+		const WideNodeType& Node = pNodes[NodeStack[--StackSize]];
+
+		alignas(32) float ChildEntries[BVH8Width];
+		unsigned int HitMask = pIntersectNode(Ray, Node, *pTMax, ChildEntries);
+
+		for (unsigned int Slot = 0; Slot < BVH8Width; Slot++)
+		{
+			if ((HitMask & (1U << Slot)) == 0)
+			{
+				continue;
+			}
+
+			if (Node.PrimitiveCounts[Slot] == 0)
+			{
+				NodeStack[StackSize++] = Node.Children[Slot];
+				continue;
+			}
+
+			for (unsigned int i = 0; i < Node.PrimitiveCounts[Slot]; i++)
+			{
+				if (IntersectPrimitive(this->Config.primitive_indices[Node.Children[Slot] + i], pTMax) == true)
+				{
+					return;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,538 @@
+// CPUBenchmarks.cpp - Benchmarks for the CPU backend's kernels and rendering features.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "CPUBenchmarks.hpp"
+#include "CPUSphereKernels.hpp"
+#include "CPUBVH.hpp"
+#include "CPURaytracer.hpp"
+
+// Results of one pass over the rays, for comparing the instruction sets against each other.
+struct SphereKernelResults
+{
+	std::vector<float> one_ray_t;
+	std::vector<unsigned int> one_ray_sphere;
+	std::vector<float> packet_t;
+	std::vector<unsigned int> packet_sphere;
+};
+
+// Relative tolerance between instruction sets. (The wider paths have different rounding, but should never pick a different sphere.)
+inline bool NearlyEqual(float a, float b)
+{
+	return std::fabs(a - b) <= 1.0e-4f * (1.0f + std::fabs(a));
+}
+
+bool BenchmarkSphereKernels
+(
+	unsigned int SphereCount,
+	unsigned int RayCount
+)
+{
+	// Random spheres in a 100x100x100 box, and random rays from inside of it.
+	std::mt19937 Generator{ 1234U };
+	std::uniform_real_distribution<float> Position{ -50.0f, 50.0f };
+	std::uniform_real_distribution<float> Size{ 0.5f, 4.0f };
+	std::uniform_real_distribution<float> Unit{ -1.0f, 1.0f };
+
+	std::vector<float> CenterX(SphereCount), CenterY(SphereCount), CenterZ(SphereCount), Radius(SphereCount);
+
+	for (unsigned int i = 0; i < SphereCount; i++)
+	{
+		CenterX[i] = Position(Generator);
+		CenterY[i] = Position(Generator);
+		CenterZ[i] = Position(Generator);
+		Radius[i] = Size(Generator);
+	}
+
+	SphereArraySoA Spheres{ CenterX.data(), CenterY.data(), CenterZ.data(), Radius.data(), SphereCount };
+
+	std::vector<Float3> Origins(RayCount), Directions(RayCount);
+
+	for (unsigned int i = 0; i < RayCount; i++)
+	{
+		Origins[i] = Float3{ Position(Generator), Position(Generator), Position(Generator) };
+		Directions[i] = Normalize(Float3{ Unit(Generator), Unit(Generator), Unit(Generator) + 0.001f });
+	}
+
+	SPHERE_KERNEL_ISA PreviousISA = GetSphereKernelISA();
+	SPHERE_KERNEL_ISA SupportedISA = GetSupportedSphereKernelISA();
+
+	SphereKernelResults ScalarResults{};
+	bool Succeeded{ true };
+
+	printf("Sphere kernels: %u rays against %u spheres.\n", RayCount, SphereCount);
+
+	for (unsigned int ISA = SPHERE_KERNEL_ISA_SCALAR; ISA <= (unsigned int)SupportedISA; ISA++)
+	{
+		SetSphereKernelISA((SPHERE_KERNEL_ISA)ISA);
+
+		SphereKernelResults Results{};
+		Results.one_ray_t.resize(RayCount);
+		Results.one_ray_sphere.resize(RayCount);
+		Results.packet_t.resize(RayCount);
+		Results.packet_sphere.resize(RayCount);
+
+		// One ray against every sphere.
+		auto StartTime = std::chrono::steady_clock::now();
+
+		for (unsigned int i = 0; i < RayCount; i++)
+		{
+			SphereIntersection Hit{};
+
+			if (IntersectRaySpheres(Origins[i], Directions[i], 0.0f, 10000.0f, Spheres, &Hit) == true)
+			{
+				Results.one_ray_t[i] = Hit.T;
+				Results.one_ray_sphere[i] = Hit.SphereIndex;
+			}
+			else
+			{
+				Results.one_ray_t[i] = 10000.0f;
+				Results.one_ray_sphere[i] = ~0U;
+			}
+		}
+
+		double OneRaySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+		// Packets of rays against one sphere at a time.
+		StartTime = std::chrono::steady_clock::now();
+
+		for (unsigned int First = 0; First < RayCount; First += SphereKernelMaxPacketSize)
+		{
+			unsigned int PacketSize = RayCount - First < SphereKernelMaxPacketSize ? RayCount - First : SphereKernelMaxPacketSize;
+
+			SphereRayPacket Packet{};
+
+			for (unsigned int i = 0; i < PacketSize; i++)
+			{
+				Packet.OriginX[i] = Origins[First + i].x;
+				Packet.OriginY[i] = Origins[First + i].y;
+				Packet.OriginZ[i] = Origins[First + i].z;
+				Packet.DirectionX[i] = Directions[First + i].x;
+				Packet.DirectionY[i] = Directions[First + i].y;
+				Packet.DirectionZ[i] = Directions[First + i].z;
+				Packet.TMin[i] = 0.0f;
+				Packet.T[i] = 10000.0f;
+				Packet.SphereIndex[i] = ~0U;
+			}
+
+			for (unsigned int j = 0; j < SphereCount; j++)
+			{
+				IntersectRayPacketSphere(&Packet, PacketSize, Float3{ CenterX[j], CenterY[j], CenterZ[j] }, Radius[j], j);
+			}
+
+			for (unsigned int i = 0; i < PacketSize; i++)
+			{
+				Results.packet_t[First + i] = Packet.T[i];
+				Results.packet_sphere[First + i] = Packet.SphereIndex[i];
+			}
+		}
+
+		double PacketSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+		double TestCount = (double)RayCount * (double)SphereCount;
+
+		printf
+		(
+			"  %-8s one ray x spheres: %8.2f Mtests/s, ray packet x sphere: %8.2f Mtests/s.\n",
+			GetSphereKernelISAName((SPHERE_KERNEL_ISA)ISA),
+			TestCount / OneRaySeconds / 1.0e6,
+			TestCount / PacketSeconds / 1.0e6
+		);
+
+		if (ISA == SPHERE_KERNEL_ISA_SCALAR)
+		{
+			ScalarResults = Results;
+			continue;
+		}
+
+		// Compare against the scalar kernels.
+		unsigned int MismatchCount{ 0U };
+
+		for (unsigned int i = 0; i < RayCount; i++)
+		{
+			if (Results.one_ray_sphere[i] != ScalarResults.one_ray_sphere[i] || NearlyEqual(Results.one_ray_t[i], ScalarResults.one_ray_t[i]) == false)
+			{
+				MismatchCount++;
+			}
+
+			if (Results.packet_sphere[i] != ScalarResults.packet_sphere[i] || NearlyEqual(Results.packet_t[i], ScalarResults.packet_t[i]) == false)
+			{
+				MismatchCount++;
+			}
+		}
+
+		if (MismatchCount > 0)
+		{
+			fprintf(stderr, "  %s: %u results differ from the scalar kernels.\n", GetSphereKernelISAName((SPHERE_KERNEL_ISA)ISA), MismatchCount);
+			Succeeded = false;
+		}
+	}
+
+	SetSphereKernelISA(PreviousISA);
+
+	return Succeeded;
+}
+
+bool BenchmarkBVHLayouts
+(
+	unsigned int SphereCount,
+	unsigned int RayCount
+)
+{
+	// Random spheres spread out over a wide, flat box, like the scattered scene, and random rays looking down into it from above.
+	const float Extent = 10.0f + std::sqrt((float)SphereCount);
+
+	std::mt19937 Generator{ 1234U };
+	std::uniform_real_distribution<float> Horizontal{ -Extent, Extent };
+	std::uniform_real_distribution<float> Vertical{ 0.0f, 10.0f };
+	std::uniform_real_distribution<float> Above{ 10.0f, 20.0f };
+	std::uniform_real_distribution<float> Size{ 0.2f, 0.6f };
+	std::uniform_real_distribution<float> Unit{ -1.0f, 1.0f };
+
+	std::vector<Float3> Centers(SphereCount);
+	std::vector<float> Radii(SphereCount);
+	std::vector<BVHBounds> Bounds(SphereCount);
+
+	for (unsigned int i = 0; i < SphereCount; i++)
+	{
+		Centers[i] = Float3{ Horizontal(Generator), Vertical(Generator), Horizontal(Generator) };
+		Radii[i] = Size(Generator);
+		Bounds[i] = BVHBounds{ Centers[i] - Float3{ Radii[i], Radii[i], Radii[i] }, Centers[i] + Float3{ Radii[i], Radii[i], Radii[i] } };
+	}
+
+	std::vector<Float3> Origins(RayCount), Directions(RayCount);
+
+	for (unsigned int i = 0; i < RayCount; i++)
+	{
+		Origins[i] = Float3{ Horizontal(Generator), Above(Generator), Horizontal(Generator) };
+		Directions[i] = Normalize(Float3{ Unit(Generator), -0.2f - std::fabs(Unit(Generator)), Unit(Generator) + 0.001f });
+	}
+
+	struct Layout
+	{
+		const char* name;
+		unsigned int branching_factor;
+		unsigned int build_flags;
+	};
+
+	const Layout Layouts[]
+	{
+		{ "Binary", 2, BVH_BUILD_FLAG_PREFER_FAST_TRACE },
+		{ "8-wide", 8, BVH_BUILD_FLAG_PREFER_FAST_TRACE },
+		{ "8-wide quantized", 8, BVH_BUILD_FLAG_PREFER_FAST_TRACE | BVH_BUILD_FLAG_MINIMIZE_MEMORY }
+	};
+
+	std::vector<unsigned int> BinaryHits{};
+	bool Succeeded{ true };
+
+	printf("BVH layouts: %u rays against %u spheres.\n", RayCount, SphereCount);
+
+	for (const Layout& CurrentLayout : Layouts)
+	{
+		CPUBVH BVH{};
+		BVH.InitConfig.ptr_primitive_bounds = Bounds.data();
+		BVH.InitConfig.primitive_count = SphereCount;
+		BVH.InitConfig.build_flags = CurrentLayout.build_flags;
+		BVH.InitConfig.branching_factor = CurrentLayout.branching_factor;
+		BVH.Initialize();
+
+		std::vector<unsigned int> Hits(RayCount, ~0U);
+
+		auto StartTime = std::chrono::steady_clock::now();
+
+		for (unsigned int i = 0; i < RayCount; i++)
+		{
+			const Float3 Origin = Origins[i];
+			const Float3 Direction = Directions[i];
+			float TMax{ 1.0e30f };
+
+			BVH.TraverseClosestHit
+			(
+				Origin,
+				Direction,
+				0.0f,
+				&TMax,
+				[&](unsigned int SphereIndex, float* pTMax)
+				{
+					Float3 Offset = Origin - Centers[SphereIndex];
+
+					float b = Dot(Offset, Direction);
+					float c = Dot(Offset, Offset) - (Radii[SphereIndex] * Radii[SphereIndex]);
+					float Discriminant = (b * b) - c;
+
+					if (Discriminant >= 0.0f)
+					{
+						float t = -b - std::sqrt(Discriminant);
+
+						if (t > 0.0f && t < *pTMax)
+						{
+							*pTMax = t;
+							Hits[i] = SphereIndex;
+						}
+					}
+
+					return false;
+				}
+			);
+		}
+
+		double TraceSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+		printf
+		(
+			"  %-17s built in %6.3f s, %8.2f MB (%6.1f bytes per sphere), %6.2f Mrays/s.\n",
+			CurrentLayout.name,
+			BVH.GetBuildSeconds(),
+			(double)BVH.GetMemoryByteSize() / (1024.0 * 1024.0),
+			(double)BVH.GetMemoryByteSize() / (double)SphereCount,
+			(double)RayCount / TraceSeconds / 1.0e6
+		);
+
+		if (BinaryHits.empty() == true)
+		{
+			BinaryHits = Hits;
+			continue;
+		}
+
+		unsigned int MismatchCount{ 0U };
+
+		for (unsigned int i = 0; i < RayCount; i++)
+		{
+			MismatchCount += Hits[i] != BinaryHits[i] ? 1U : 0U;
+		}
+
+		if (MismatchCount > 0)
+		{
+			fprintf(stderr, "  %s: %u closest hits differ from the binary hierarchy.\n", CurrentLayout.name, MismatchCount);
+			Succeeded = false;
+		}
+	}
+
+	return Succeeded;
+}
+
+bool BenchmarkRussianRoulette
+(
+	unsigned int PixelWidth,
+	unsigned int PixelHeight,
+	unsigned int RaysPerPixel,
+	unsigned int ScatteredSphereCount
+)
+{
+	InlineConstantBuffer Constants{};
+	GetDefaultSceneConstants(&Constants);
+	Constants.RaysPerPixel = RaysPerPixel;
+
+	std::vector<SceneInstanceDesc> Instances{};
+	std::vector<SceneMaterial> Materials{};
+	GetScatteredSceneInstances(&Instances, ScatteredSphereCount, 1234U);
+	SetScatteredSceneMaterials(&Instances, &Materials, 0.0f, 0.0f, 0.0f);
+
+	CPURaytracer Raytracer{};
+	Raytracer.InitConfig.pixel_width = PixelWidth;
+	Raytracer.InitConfig.pixel_height = PixelHeight;
+	Raytracer.InitConfig.ptr_inline_constant_buffer = &Constants;
+	Raytracer.InitConfig.ptr_instance_descs = Instances.data();
+	Raytracer.InitConfig.instance_count = (unsigned int)Instances.size();
+	Raytracer.InitConfig.ptr_materials = Materials.data();
+	Raytracer.InitConfig.acceleration_structure_build_flags = BVH_BUILD_FLAG_PREFER_FAST_TRACE;
+	Raytracer.InitConfig.acceleration_structure_branching_factor = BVH8Width;
+	Raytracer.Initialize();
+
+	// 0 is the fixed-depth mode, which every other image is compared against.
+	const unsigned int MinDepths[]{ 0, 8, 5, 3, 2, 1 };
+	const unsigned int ByteCount{ Raytracer.GetRenderTargetByteSize() };
+	const double PixelCount{ (double)PixelWidth * (double)PixelHeight };
+
+	std::vector<unsigned char> FixedDepthImage{};
+	double FixedDepthMean{ 0.0 };
+	double FixedDepthRaysPerPixel{ 0.0 };
+	bool Succeeded{ true };
+
+	printf("Russian roulette: %ux%u at %u paths per pixel, %u instances, paths of up to %u rays.\n", PixelWidth, PixelHeight, RaysPerPixel, (unsigned int)Instances.size(), Constants.MaxPathDepth);
+
+	for (unsigned int MinDepth : MinDepths)
+	{
+		Constants.RouletteMinDepth = MinDepth;
+
+		auto StartTime = std::chrono::steady_clock::now();
+
+		Raytracer.DispatchRays();
+
+		double RenderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+		// Mean of the image, and its RMS difference from the fixed-depth one, over every color channel.
+		const unsigned char* pImage = Raytracer.GetRenderTarget();
+		double Sum{ 0.0 };
+		double SquaredDifferenceSum{ 0.0 };
+
+		for (unsigned int i = 0; i < ByteCount; i++)
+		{
+			if ((i % 4) == 3)
+			{
+				continue;
+			}
+
+			Sum += (double)pImage[i];
+
+			if (FixedDepthImage.empty() == false)
+			{
+				double Difference = (double)pImage[i] - (double)FixedDepthImage[i];
+
+				SquaredDifferenceSum += Difference * Difference;
+			}
+		}
+
+		double Mean = Sum / (PixelCount * 3.0);
+		double TracedRaysPerPixel = (double)Raytracer.GetStatistics().trace_ray_count / PixelCount;
+
+		if (FixedDepthImage.empty() == true)
+		{
+			FixedDepthImage.assign(pImage, pImage + ByteCount);
+			FixedDepthMean = Mean;
+			FixedDepthRaysPerPixel = TracedRaysPerPixel;
+
+			printf("  Fixed depth:  %8.1f rays per pixel,                 %6.3f s, mean %6.2f.\n", TracedRaysPerPixel, RenderSeconds, Mean);
+			continue;
+		}
+
+		double MeanChange = 100.0 * (Mean - FixedDepthMean) / FixedDepthMean;
+
+		printf
+		(
+			"  Min depth %2u: %8.1f rays per pixel (%5.1f%% fewer), %6.3f s, mean %+6.2f%%, RMS difference %.2f.\n",
+			MinDepth,
+			TracedRaysPerPixel,
+			100.0 * (1.0 - (TracedRaysPerPixel / FixedDepthRaysPerPixel)),
+			RenderSeconds,
+			MeanChange,
+			std::sqrt(SquaredDifferenceSum / (PixelCount * 3.0))
+		);
+
+		if (std::fabs(MeanChange) > 1.0)
+		{
+			fprintf(stderr, "  Min depth %u changed the mean of the image by more than 1%%.\n", MinDepth);
+			Succeeded = false;
+		}
+	}
+
+	return Succeeded;
+}
+
+bool BenchmarkDenoiser
+(
+	unsigned int PixelWidth,
+	unsigned int PixelHeight,
+	unsigned int IterationCount
+)
+{
+	// One sample per pixel: discs facing the camera at a few depths, with their own albedos, over a sky gradient, plus uniform noise.
+	std::mt19937 Generator{ 1234U };
+	std::uniform_real_distribution<float> Noise{ -0.5f, 0.5f };
+
+	const size_t PixelCount{ (size_t)PixelWidth * PixelHeight };
+
+	std::vector<float> ColorSums(PixelCount * 4), GuideSums(PixelCount * 4), AlbedoSums(PixelCount * 4);
+
+	for (unsigned int y = 0; y < PixelHeight; y++)
+	{
+		for (unsigned int x = 0; x < PixelWidth; x++)
+		{
+			size_t i = ((size_t)y * PixelWidth + x) * 4;
+
+			float u = (float)x / (float)PixelWidth;
+			float v = (float)y / (float)PixelHeight;
+
+			unsigned int Disc = (unsigned int)(u * 4.0f);
+			float du = (u * 4.0f) - (float)Disc - 0.5f;
+			float dv = (v - 0.5f) * 2.0f;
+			bool Hit = (du * du) + (dv * dv * 0.25f) < 0.16f;
+
+			float Albedo = Hit == true ? 0.2f + (0.2f * (float)Disc) : 1.0f;
+			float Lighting = Hit == true ? 0.5f + dv * 0.25f : 1.0f - (0.5f * v);
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				ColorSums[i + Channel] = Albedo * std::fmax(Lighting + Noise(Generator), 0.0f);
+				AlbedoSums[i + Channel] = Albedo;
+			}
+
+			GuideSums[i + 0] = Hit == true ? du : 0.0f;
+			GuideSums[i + 1] = Hit == true ? dv * 0.5f : 0.0f;
+			GuideSums[i + 2] = Hit == true ? -0.7f : 0.0f;
+			GuideSums[i + 3] = Hit == true ? 2.0f + (float)Disc : 10000.0f;
+			AlbedoSums[i + 3] = 1.0f;
+		}
+	}
+
+	SPHERE_KERNEL_ISA PreviousISA = GetSphereKernelISA();
+	SPHERE_KERNEL_ISA SupportedISA = GetSupportedSphereKernelISA();
+
+	CPUWorkStealingPool ThreadPool{};
+	ThreadPool.Initialize();
+
+	CPUDenoiser Denoiser{};
+	Denoiser.InitConfig.pixel_width = PixelWidth;
+	Denoiser.InitConfig.pixel_height = PixelHeight;
+	Denoiser.InitConfig.iteration_count = IterationCount;
+	Denoiser.InitConfig.ptr_thread_pool = &ThreadPool;
+	Denoiser.Initialize();
+
+	std::vector<unsigned char> ScalarImage{};
+	bool Succeeded{ true };
+
+	printf("Denoiser: %ux%u, %u a-trous passes, %u threads.\n", PixelWidth, PixelHeight, IterationCount, ThreadPool.GetThreadCount());
+
+	for (unsigned int ISA = SPHERE_KERNEL_ISA_SCALAR; ISA <= (unsigned int)SupportedISA; ISA++)
+	{
+		SetSphereKernelISA((SPHERE_KERNEL_ISA)ISA);
+
+		std::vector<unsigned char> Image(PixelCount * 4);
+
+		// Best of a few runs, since the first one also faults in the planes.
+		double BestSeconds{ 0.0 };
+
+		for (unsigned int Run = 0; Run < 3; Run++)
+		{
+			Denoiser.Denoise(ColorSums.data(), GuideSums.data(), AlbedoSums.data(), Image.data());
+
+			BestSeconds = Run == 0 ? Denoiser.GetDenoiseSeconds() : std::fmin(BestSeconds, Denoiser.GetDenoiseSeconds());
+		}
+
+		printf("  %-8s %8.2f ms, %8.2f Mpixels/s.\n", GetSphereKernelISAName((SPHERE_KERNEL_ISA)ISA), BestSeconds * 1000.0, (double)PixelCount / BestSeconds / 1.0e6);
+
+		if (ISA == SPHERE_KERNEL_ISA_SCALAR)
+		{
+			ScalarImage = Image;
+			continue;
+		}
+
+		// Compare against the scalar filter. (Only the rounding of the divisions differs.)
+		unsigned int MismatchCount{ 0U };
+
+		for (size_t i = 0; i < Image.size(); i++)
+		{
+			if (std::abs((int)Image[i] - (int)ScalarImage[i]) > 1)
+			{
+				MismatchCount++;
+			}
+		}
+
+		if (MismatchCount > 0)
+		{
+			fprintf(stderr, "  %s: %u channels differ from the scalar filter.\n", GetSphereKernelISAName((SPHERE_KERNEL_ISA)ISA), MismatchCount);
+			Succeeded = false;
+		}
+	}
+
+	SetSphereKernelISA(PreviousISA);
+
+	return Succeeded;
+}
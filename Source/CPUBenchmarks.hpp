@@ -0,0 +1,22 @@
+// CPUBenchmarks.hpp - Benchmarks for the CPU backend's kernels and rendering features.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+// Times the ray-sphere kernels with every supported instruction set, checking each one against the scalar results.
+// Returns false if any instruction set disagrees with the scalar kernels.
+bool BenchmarkSphereKernels(unsigned int SphereCount, unsigned int RayCount);
+
+// Builds a BVH over random spheres with each node layout (binary, 8-wide, 8-wide quantized), and reports the memory of each against how fast it traces.
+// Returns false if any layout finds different closest hits than the binary one.
+bool BenchmarkBVHLayouts(unsigned int SphereCount, unsigned int RayCount);
+
+// Renders the scene with fixed-depth paths, then with Russian roulette from a few minimum depths, and reports the rays per pixel each one traces against how far its image is from the fixed-depth one.
+// Returns false if any minimum depth changes the mean brightness of the image by more than 1%, which Russian roulette shouldn't.
+bool BenchmarkRussianRoulette(unsigned int PixelWidth, unsigned int PixelHeight, unsigned int RaysPerPixel, unsigned int ScatteredSphereCount);
+
+// Times the denoiser with every supported instruction set, on a noisy image of a few flat-shaded discs in front of a gradient.
+// Returns false if any instruction set's image differs from the scalar one by more than 1 in any channel.
+bool BenchmarkDenoiser(unsigned int PixelWidth, unsigned int PixelHeight, unsigned int IterationCount);
@@ -0,0 +1,1682 @@
+// CPUDXR.cpp - Software emulation of the DXR runtime (DispatchRays, TraceRay, shader tables), for the CPU rendering path.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include "CPUDXR.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+// Software emulation of the DXR runtime.
+namespace CPUDXR
+{
+	// Instances get copied over in parallel in chunks of this size.
+	const unsigned int InstanceCopyGrain{ 4096 };
+
+	// Queued rays get traced, shaded and handed to ForEachQueuedRay()'s function in batches of this size.
+	const unsigned int RayQueueBatchSize{ 256 };
+
+	// Queued rays get sorted by the cell of a grid of 2^RayQueueCellBits cells per axis over the scene that their origins are in.
+	const unsigned int RayQueueCellBits{ 4 };
+
+	// Outcome of an any-hit shader invocation.
+	enum ANY_HIT_STATUS
+	{
+		ANY_HIT_STATUS_ACCEPT = 0,
+		ANY_HIT_STATUS_IGNORE = 1,
+		ANY_HIT_STATUS_ACCEPT_AND_END_SEARCH = 2
+	};
+
+	// State of one TraceRay() call, backing the ray-related intrinsics.
+	struct RayState
+	{
+		// Arguments of the TraceRay() call.
+		RayDesc ray;
+		unsigned int ray_flags;
+		unsigned int ray_contribution_to_hit_group_index;
+		unsigned int multiplier_for_geometry_contribution_to_hit_group_index;
+		RayPayload* ptr_payload;
+
+		// Closest accepted distance so far. (RayTCurrent())
+		float t_current;
+
+		// Instance and hit group currently being intersected, or hit.
+		const Instance* ptr_instance;
+		unsigned int instance_index;
+		unsigned int hit_group_index;
+		unsigned int hit_kind;
+
+		// Committed (closest accepted) hit.
+		bool committed;
+		unsigned int committed_instance_index;
+		unsigned int committed_hit_group_index;
+		unsigned int committed_hit_kind;
+		IntersectionAttributes committed_attributes;
+
+		// Set when the traversal should stop after the current intersection shader.
+		bool end_search;
+
+		// Set by IgnoreHit() / AcceptHitAndEndSearch().
+		ANY_HIT_STATUS any_hit_status;
+	};
+
+	// State of one worker thread during DispatchRays().
+	struct DispatchState
+	{
+		const CPUDXRPipeline* ptr_pipeline;
+		DispatchStatistics* ptr_statistics;
+
+		// Statistics of every worker, and the pool, for the rays of TraceRayQueue().
+		std::vector<DispatchStatistics>* ptr_worker_statistics;
+		CPUWorkStealingPool* ptr_thread_pool;
+
+		UInt2 dispatch_rays_index;
+		UInt2 dispatch_rays_dimensions;
+		unsigned int recursion_depth;
+		unsigned int max_trace_recursion_depth;
+		RayState* ptr_current_ray;
+	};
+
+	thread_local DispatchState CurrentDispatch{};
+
+	// Buffers of one worker thread for TraceRayPacket(), kept around between calls.
+	struct PacketScratch
+	{
+		// Indices of the rays in each octant of directions, and of the rays that have to be traced one by one.
+		std::vector<unsigned int> octant_lanes[8];
+		std::vector<unsigned int> single_lanes;
+
+		// Rays of the packet being traced, for bounding it, and the same rays in lanes of 16 for the sphere kernels.
+		std::vector<Float3> origins;
+		std::vector<Float3> directions;
+		std::vector<float> t_mins;
+		std::vector<SphereRayPacket> sphere_packets;
+	};
+
+	thread_local PacketScratch CurrentPacketScratch{};
+
+	// Closest hit of a queued ray, kept between the traversal and the shading of the queue.
+	struct QueuedHit
+	{
+		bool committed;
+		unsigned int instance_index;
+		unsigned int hit_group_index;
+		unsigned int hit_kind;
+		float t;
+		IntersectionAttributes attributes;
+	};
+
+	// Buffers of the thread running a wavefront ray generation shader, for TraceRayQueue(), kept around between calls.
+	struct RayQueueScratch
+	{
+		// Sort key of each ray, and the first index of each key's rays in the sorted order.
+		std::vector<unsigned int> keys;
+		std::vector<unsigned int> bin_offsets;
+
+		// Rays in the sorted order, their closest hits, and the order they get shaded in.
+		std::vector<QueuedRay> sorted_rays;
+		std::vector<QueuedHit> hits;
+		std::vector<unsigned int> shading_order;
+	};
+
+	thread_local RayQueueScratch CurrentRayQueueScratch{};
+
+	// Interleaves the bits of a cell's coordinates, so that neighboring cells get neighboring keys.
+	inline unsigned int GetMortonCellKey(unsigned int x, unsigned int y, unsigned int z)
+	{
+		unsigned int Key{ 0 };
+
+		for (unsigned int Bit = 0; Bit < RayQueueCellBits; Bit++)
+		{
+			Key |= (((x >> Bit) & 1) << (3 * Bit + 0)) | (((y >> Bit) & 1) << (3 * Bit + 1)) | (((z >> Bit) & 1) << (3 * Bit + 2));
+		}
+
+		return Key;
+	}
+
+	// Stably sorts Count indices by their keys, which are below BinCount, into pOrder.
+	inline void CountingSort(const unsigned int* pKeys, unsigned int Count, unsigned int BinCount, std::vector<unsigned int>* pBinOffsets, unsigned int* pOrder)
+	{
+		std::vector<unsigned int>& BinOffsets = *pBinOffsets;
+
+		BinOffsets.assign(BinCount + 1, 0);
+
+		for (unsigned int i = 0; i < Count; i++)
+		{
+			BinOffsets[pKeys[i] + 1]++;
+		}
+
+		for (unsigned int Bin = 0; Bin < BinCount; Bin++)
+		{
+			BinOffsets[Bin + 1] += BinOffsets[Bin];
+		}
+
+		for (unsigned int i = 0; i < Count; i++)
+		{
+			pOrder[BinOffsets[pKeys[i]]++] = i;
+		}
+	}
+
+	// Tests a ray against an axis-aligned box with the slab method, within [TMin, TMax].
+	inline bool RayIntersectsAABB(Float3 Origin, Float3 Direction, const RaytracingAABB& Box, float TMin, float TMax)
+	{
+		float Origins[3]{ Origin.x, Origin.y, Origin.z };
+		float Directions[3]{ Direction.x, Direction.y, Direction.z };
+		float Mins[3]{ Box.MinX, Box.MinY, Box.MinZ };
+		float Maxs[3]{ Box.MaxX, Box.MaxY, Box.MaxZ };
+
+		for (unsigned int Axis = 0; Axis < 3; Axis++)
+		{
+			float InverseDirection = 1.0f / Directions[Axis];
+			float t0 = (Mins[Axis] - Origins[Axis]) * InverseDirection;
+			float t1 = (Maxs[Axis] - Origins[Axis]) * InverseDirection;
+
+			if (t0 > t1)
+			{
+				float Swap = t0;
+				t0 = t1;
+				t1 = Swap;
+			}
+
+			TMin = t0 > TMin ? t0 : TMin;
+			TMax = t1 < TMax ? t1 : TMax;
+
+			if (TMin > TMax)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// Returns the World-Space bounds of a bottom-level AABB placed with an instance transform.
+	inline BVHBounds GetInstanceBounds(const float(&ObjectToWorld)[3][4], const RaytracingAABB& Box)
+	{
+		BVHBounds Bounds{ Float3{ +1.0e30f, +1.0e30f, +1.0e30f }, Float3{ -1.0e30f, -1.0e30f, -1.0e30f } };
+
+		for (unsigned int Corner = 0; Corner < 8; Corner++)
+		{
+			Float3 ObjectCorner{ (Corner & 1) ? Box.MaxX : Box.MinX, (Corner & 2) ? Box.MaxY : Box.MinY, (Corner & 4) ? Box.MaxZ : Box.MinZ };
+			Float3 WorldCorner = TransformPoint3x4(ObjectToWorld, ObjectCorner);
+
+			Bounds.Min = Float3{ std::min(Bounds.Min.x, WorldCorner.x), std::min(Bounds.Min.y, WorldCorner.y), std::min(Bounds.Min.z, WorldCorner.z) };
+			Bounds.Max = Float3{ std::max(Bounds.Max.x, WorldCorner.x), std::max(Bounds.Max.y, WorldCorner.y), std::max(Bounds.Max.z, WorldCorner.z) };
+		}
+
+		return Bounds;
+	}
+
+	// Returns true if an instance transform only scales uniformly and translates, and the bottom-level AABB is a cube, along with the World-Space sphere inscribed in the AABB.
+	inline bool GetInstanceSphere(const float(&ObjectToWorld)[3][4], const RaytracingAABB& Box, Float3* pCenter, float* pRadius)
+	{
+		const float(&m)[3][4] = ObjectToWorld;
+
+		float Scale = m[0][0];
+
+		if (Scale <= 0.0f || m[1][1] != Scale || m[2][2] != Scale)
+		{
+			return false;
+		}
+
+		if (m[0][1] != 0.0f || m[0][2] != 0.0f || m[1][0] != 0.0f || m[1][2] != 0.0f || m[2][0] != 0.0f || m[2][1] != 0.0f)
+		{
+			return false;
+		}
+
+		float Extent = Box.MaxX - Box.MinX;
+
+		if (Box.MaxY - Box.MinY != Extent || Box.MaxZ - Box.MinZ != Extent)
+		{
+			return false;
+		}
+
+		*pCenter = TransformPoint3x4(ObjectToWorld, Float3{ 0.5f * (Box.MinX + Box.MaxX), 0.5f * (Box.MinY + Box.MaxY), 0.5f * (Box.MinZ + Box.MaxZ) });
+		*pRadius = Scale * 0.5f * Extent;
+
+		return true;
+	}
+
+	// Whether a candidate hit on an instance is treated as opaque, given the instance and ray flags.
+	inline bool IsOpaque(unsigned int InstanceFlags, unsigned int RayFlags)
+	{
+		if ((RayFlags & RAY_FLAG_FORCE_OPAQUE) != 0)
+		{
+			return true;
+		}
+
+		if ((RayFlags & RAY_FLAG_FORCE_NON_OPAQUE) != 0)
+		{
+			return false;
+		}
+
+		if ((InstanceFlags & INSTANCE_FLAG_FORCE_OPAQUE) != 0)
+		{
+			return true;
+		}
+
+		// The procedural geometry is built with D3D12_RAYTRACING_GEOMETRY_FLAG_NONE, so it is non-opaque by default.
+		return false;
+	}
+
+	// Position of a tile along the Z-order curve: the bits of its x and y, interleaved.
+	inline unsigned long long GetMortonTileKey(unsigned int x, unsigned int y)
+	{
+		unsigned long long Key{ 0 };
+
+		for (unsigned int Bit = 0; Bit < 32; Bit++)
+		{
+			Key |= (unsigned long long)((x >> Bit) & 1) << (2 * Bit);
+			Key |= (unsigned long long)((y >> Bit) & 1) << (2 * Bit + 1);
+		}
+
+		return Key;
+	}
+
+	// Position of a tile along the Hilbert curve filling a GridSize x GridSize grid, with GridSize a power of 2. Unlike the Z-order curve, it never jumps: consecutive tiles are always neighbors.
+	inline unsigned long long GetHilbertTileKey(unsigned int GridSize, unsigned int x, unsigned int y)
+	{
+		unsigned long long Key{ 0 };
+
+		for (unsigned int s = GridSize / 2; s > 0; s /= 2)
+		{
+			unsigned int rx = (x & s) != 0 ? 1 : 0;
+			unsigned int ry = (y & s) != 0 ? 1 : 0;
+
+			Key += (unsigned long long)s * s * ((3 * rx) ^ ry);
+
+			// Rotate the quadrant, so that the curve within it starts and ends next to its neighbors.
+			if (ry == 0)
+			{
+				if (rx == 1)
+				{
+					x = GridSize - 1 - x;
+					y = GridSize - 1 - y;
+				}
+
+				std::swap(x, y);
+			}
+		}
+
+		return Key;
+	}
+
+
+
+
+
+	// Intrinsics.
+	UInt2 DispatchRaysIndex()
+	{
+		return CurrentDispatch.dispatch_rays_index;
+	}
+
+	UInt2 DispatchRaysDimensions()
+	{
+		return CurrentDispatch.dispatch_rays_dimensions;
+	}
+
+	Float3 WorldRayOrigin()
+	{
+		return CurrentDispatch.ptr_current_ray->ray.Origin;
+	}
+
+	Float3 WorldRayDirection()
+	{
+		return CurrentDispatch.ptr_current_ray->ray.Direction;
+	}
+
+	Float3 ObjectRayOrigin()
+	{
+		return TransformPoint3x4(WorldToObject3x4(), WorldRayOrigin());
+	}
+
+	Float3 ObjectRayDirection()
+	{
+		return TransformVector3x4(WorldToObject3x4(), WorldRayDirection());
+	}
+
+	float RayTMin()
+	{
+		return CurrentDispatch.ptr_current_ray->ray.TMin;
+	}
+
+	float RayTCurrent()
+	{
+		return CurrentDispatch.ptr_current_ray->t_current;
+	}
+
+	unsigned int RayFlags()
+	{
+		return CurrentDispatch.ptr_current_ray->ray_flags;
+	}
+
+	unsigned int InstanceIndex()
+	{
+		return CurrentDispatch.ptr_current_ray->instance_index;
+	}
+
+	unsigned int InstanceID()
+	{
+		return CurrentDispatch.ptr_current_ray->ptr_instance->instance_desc.InstanceID;
+	}
+
+	unsigned int PrimitiveIndex()
+	{
+		// Every bottom-level acceleration structure holds a single AABB.
+		return 0;
+	}
+
+	unsigned int HitKind()
+	{
+		return CurrentDispatch.ptr_current_ray->hit_kind;
+	}
+
+	const float(&ObjectToWorld3x4())[3][4]
+	{
+		return CurrentDispatch.ptr_current_ray->ptr_instance->instance_desc.Transform;
+	}
+
+	const float(&WorldToObject3x4())[3][4]
+	{
+		return CurrentDispatch.ptr_current_ray->ptr_instance->world_to_object;
+	}
+
+	bool GetWorldSphere(Float3* pCenter, float* pRadius)
+	{
+		const WorldSphereArrays& Spheres = CurrentDispatch.ptr_pipeline->GetWorldSpheres();
+
+		const unsigned int i = CurrentDispatch.ptr_current_ray->instance_index;
+
+		if (Spheres.radius[i] <= 0.0f)
+		{
+			return false;
+		}
+
+		*pCenter = Float3{ Spheres.center_x[i], Spheres.center_y[i], Spheres.center_z[i] };
+		*pRadius = Spheres.radius[i];
+
+		return true;
+	}
+
+	SceneMaterial GetInstanceMaterial()
+	{
+		const WorldSphereArrays& Spheres = CurrentDispatch.ptr_pipeline->GetWorldSpheres();
+
+		const unsigned int i = CurrentDispatch.ptr_current_ray->instance_index;
+
+		SceneMaterial Material{};
+		Material.Albedo = SceneFloat3{ Spheres.albedo_x[i], Spheres.albedo_y[i], Spheres.albedo_z[i] };
+		Material.Roughness = Spheres.roughness[i];
+		Material.Emission = SceneFloat3{ Spheres.emission_x[i], Spheres.emission_y[i], Spheres.emission_z[i] };
+		Material.IndexOfRefraction = Spheres.index_of_refraction[i];
+
+		return Material;
+	}
+
+	bool ReportHit(float THit, unsigned int HitKind, const IntersectionAttributes& Attributes)
+	{
+		RayState& Ray = *(CurrentDispatch.ptr_current_ray);
+
+		if (THit < Ray.ray.TMin || THit > Ray.t_current)
+		{
+			return false;
+		}
+
+		const HitGroup& Group = CurrentDispatch.ptr_pipeline->InitConfig.hit_groups[Ray.hit_group_index];
+
+		// Non-opaque hits go through the any-hit shader first, which may ignore them.
+		if ((IsOpaque(Ray.ptr_instance->instance_desc.Flags, Ray.ray_flags) == false) && Group.any_hit_shader)
+		{
+			float PreviousTCurrent = Ray.t_current;
+
+			Ray.t_current = THit;
+			Ray.hit_kind = HitKind;
+			Ray.any_hit_status = ANY_HIT_STATUS_ACCEPT;
+
+			CurrentDispatch.ptr_statistics->any_hit_invocations[Ray.hit_group_index]++;
+
+			Group.any_hit_shader(*(Ray.ptr_payload), Attributes);
+
+			if (Ray.any_hit_status == ANY_HIT_STATUS_IGNORE)
+			{
+				Ray.t_current = PreviousTCurrent;
+				return false;
+			}
+
+			if (Ray.any_hit_status == ANY_HIT_STATUS_ACCEPT_AND_END_SEARCH)
+			{
+				Ray.end_search = true;
+			}
+		}
+
+		// Commit the hit.
+		Ray.t_current = THit;
+		Ray.committed = true;
+		Ray.committed_instance_index = Ray.instance_index;
+		Ray.committed_hit_group_index = Ray.hit_group_index;
+		Ray.committed_hit_kind = HitKind;
+		Ray.committed_attributes = Attributes;
+
+		if ((Ray.ray_flags & RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH) != 0)
+		{
+			Ray.end_search = true;
+		}
+
+		return true;
+	}
+
+	void IgnoreHit()
+	{
+		CurrentDispatch.ptr_current_ray->any_hit_status = ANY_HIT_STATUS_IGNORE;
+	}
+
+	void AcceptHitAndEndSearch()
+	{
+		CurrentDispatch.ptr_current_ray->any_hit_status = ANY_HIT_STATUS_ACCEPT_AND_END_SEARCH;
+	}
+
+	void TraceRay
+	(
+		unsigned int RayFlags,
+		unsigned int InstanceInclusionMask,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		const RayDesc& Ray,
+		RayPayload& Payload
+	)
+	{
+		CurrentDispatch.ptr_pipeline->TraceRay
+		(
+			RayFlags,
+			InstanceInclusionMask,
+			RayContributionToHitGroupIndex,
+			MultiplierForGeometryContributionToHitGroupIndex,
+			MissShaderIndex,
+			Ray,
+			Payload
+		);
+	}
+
+	void TraceRayPacket
+	(
+		unsigned int RayFlags,
+		unsigned int InstanceInclusionMask,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		const RayDesc* pRays,
+		const UInt2* pDispatchRaysIndices,
+		RayPayload* pPayloads,
+		unsigned int RayCount
+	)
+	{
+		CurrentDispatch.ptr_pipeline->TraceRayPacket
+		(
+			RayFlags,
+			InstanceInclusionMask,
+			RayContributionToHitGroupIndex,
+			MultiplierForGeometryContributionToHitGroupIndex,
+			MissShaderIndex,
+			pRays,
+			pDispatchRaysIndices,
+			pPayloads,
+			RayCount
+		);
+	}
+
+	void TraceRayQueue
+	(
+		unsigned int RayFlags,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		QueuedRay* pRays,
+		RayPayload* pPayloads,
+		unsigned int RayCount,
+		unsigned int PathDepth
+	)
+	{
+		CurrentDispatch.ptr_pipeline->TraceRayQueue
+		(
+			RayFlags,
+			RayContributionToHitGroupIndex,
+			MultiplierForGeometryContributionToHitGroupIndex,
+			MissShaderIndex,
+			pRays,
+			pPayloads,
+			RayCount,
+			PathDepth
+		);
+	}
+
+	void ForEachQueuedRay
+	(
+		unsigned int Count,
+		const std::function<void(unsigned int Begin, unsigned int End)>& Function
+	)
+	{
+		CurrentDispatch.ptr_thread_pool->ParallelFor(Count, RayQueueBatchSize, Function);
+	}
+
+
+
+
+
+	// CPUDXRPipeline class.
+	CPUDXRPipeline::CPUDXRPipeline
+	() :
+		InitConfig{},
+		Config{}
+	{
+		this->Config.thread_count = 0;
+		this->Config.packet_traceable = false;
+		this->Config.tile_origins_dimensions = UInt2{ 0, 0 };
+		this->Config.name = "CPUDXRPipeline";
+		this->Config.error_message = "CPUDXRPipeline.Initialize() failed.";
+
+		this->InitConfig.max_trace_recursion_depth = 1;
+		this->InitConfig.blas_aabb = RaytracingAABB{ -1.0f, -1.0f, -1.0f, +1.0f, +1.0f, +1.0f };
+		this->InitConfig.ptr_instance_descs = nullptr;
+		this->InitConfig.instance_count = 0;
+		this->InitConfig.ptr_materials = nullptr;
+		this->InitConfig.acceleration_structure_build_flags = BVH_BUILD_FLAG_PREFER_FAST_TRACE;
+		this->InitConfig.acceleration_structure_branching_factor = BVH8Width;
+		this->InitConfig.thread_count = 0;
+		this->InitConfig.tile_width = 16;
+		this->InitConfig.tile_height = 16;
+		this->InitConfig.tile_order = TILE_ORDER_HILBERT;
+		this->InitConfig.sort_queued_hits = true;
+	}
+
+	void CPUDXRPipeline::Initialize
+	()
+	{
+		FailCheck
+		(
+			((bool)(this->InitConfig.ray_generation_shader) || (bool)(this->InitConfig.ray_generation_tile_shader) || (bool)(this->InitConfig.ray_generation_wavefront_shader)) && (this->InitConfig.max_trace_recursion_depth <= 31) && (this->InitConfig.instance_count == 0 || this->InitConfig.ptr_materials != nullptr) && (this->InitConfig.tile_width > 0) && (this->InitConfig.tile_height > 0),
+			this->Config.error_message,
+			this->Config.name
+		);
+
+		// Decide on the number of worker threads.
+		this->Config.thread_count = this->InitConfig.thread_count;
+
+		if (this->Config.thread_count == 0)
+		{
+			this->Config.thread_count = std::thread::hardware_concurrency();
+		}
+
+		if (this->Config.thread_count == 0)
+		{
+			this->Config.thread_count = 1;
+		}
+
+		this->Config.thread_pool.InitConfig.thread_count = this->Config.thread_count;
+		this->Config.thread_pool.Initialize();
+
+		// Copy the instances and their materials, and precompute their World-to-Object transforms, World-Space bounds and World-Space spheres.
+		this->Config.instances.resize(this->InitConfig.instance_count);
+		this->Config.instance_bounds.resize(this->InitConfig.instance_count);
+
+		for (std::vector<float>* pArray : { &(this->Config.world_spheres.center_x), &(this->Config.world_spheres.center_y), &(this->Config.world_spheres.center_z), &(this->Config.world_spheres.radius),
+			&(this->Config.world_spheres.albedo_x), &(this->Config.world_spheres.albedo_y), &(this->Config.world_spheres.albedo_z), &(this->Config.world_spheres.roughness),
+			&(this->Config.world_spheres.emission_x), &(this->Config.world_spheres.emission_y), &(this->Config.world_spheres.emission_z), &(this->Config.world_spheres.index_of_refraction) })
+		{
+			pArray->resize(this->InitConfig.instance_count);
+		}
+
+		this->Config.thread_pool.ParallelFor
+		(
+			this->InitConfig.instance_count,
+			InstanceCopyGrain,
+			[this](unsigned int Begin, unsigned int End)
+			{
+				for (unsigned int i = Begin; i < End; i++)
+				{
+					this->CopyInstance(i, this->InitConfig.ptr_instance_descs[i]);
+					this->CopyMaterial(i, this->InitConfig.ptr_materials[i]);
+				}
+			}
+		);
+
+		// Build the top-level hierarchy, on every worker.
+
+		this->Config.acceleration_structure.InitConfig.ptr_primitive_bounds = this->Config.instance_bounds.data();
+		this->Config.acceleration_structure.InitConfig.primitive_count = this->InitConfig.instance_count;
+		this->Config.acceleration_structure.InitConfig.build_flags = this->InitConfig.acceleration_structure_build_flags;
+		this->Config.acceleration_structure.InitConfig.branching_factor = this->InitConfig.acceleration_structure_branching_factor;
+		this->Config.acceleration_structure.InitConfig.ptr_thread_pool = &(this->Config.thread_pool);
+		this->Config.acceleration_structure.Initialize();
+
+		this->UpdatePacketTraceable();
+		this->UpdateSceneBounds();
+	}
+
+	void CPUDXRPipeline::DispatchRays
+	(
+		unsigned int Width,
+		unsigned int Height
+	)
+	{
+		auto StartTime = std::chrono::steady_clock::now();
+
+		// Each worker counts into its own statistics, which are summed up afterwards.
+		std::vector<DispatchStatistics> WorkerStatistics(this->Config.thread_count);
+
+		for (DispatchStatistics& Statistics : WorkerStatistics)
+		{
+			Statistics.trace_ray_count = 0;
+			Statistics.packet_ray_count = 0;
+			Statistics.intersection_invocations.assign(this->InitConfig.hit_groups.size(), 0);
+			Statistics.any_hit_invocations.assign(this->InitConfig.hit_groups.size(), 0);
+			Statistics.closest_hit_invocations.assign(this->InitConfig.hit_groups.size(), 0);
+			Statistics.miss_invocations.assign(this->InitConfig.miss_shaders.size(), 0);
+			Statistics.path_counts.assign(this->InitConfig.hit_groups.size(), 0);
+			Statistics.path_ray_counts.assign(this->InitConfig.hit_groups.size(), 0);
+			Statistics.closest_hit_seconds.assign(this->InitConfig.hit_groups.size(), 0.0);
+			Statistics.miss_seconds = 0.0;
+			Statistics.dispatch_seconds = 0.0;
+		}
+
+		if (this->InitConfig.ray_generation_wavefront_shader)
+		{
+			// The shader is the root task of a single pool job, so that the workers stay in it from one TraceRayQueue() and ForEachQueuedRay() call to the next, instead of getting woken up and put back to sleep for every stage of every bounce.
+			// It counts its bounces into the first worker's statistics, wherever it runs, and the rays of its queues count into those of whichever worker traces them.
+			this->Config.thread_pool.Run([&]()
+			{
+				CurrentDispatch = DispatchState{};
+				CurrentDispatch.ptr_pipeline = this;
+				CurrentDispatch.ptr_statistics = &(WorkerStatistics[0]);
+				CurrentDispatch.ptr_worker_statistics = &WorkerStatistics;
+				CurrentDispatch.ptr_thread_pool = &(this->Config.thread_pool);
+				CurrentDispatch.dispatch_rays_dimensions = UInt2{ Width, Height };
+				CurrentDispatch.max_trace_recursion_depth = this->InitConfig.max_trace_recursion_depth;
+
+				this->InitConfig.ray_generation_wavefront_shader();
+
+				CurrentDispatch = DispatchState{};
+			});
+		}
+		else
+		{
+			this->DispatchTiles(Width, Height, &WorkerStatistics);
+		}
+
+		// Sum up the statistics. Only the first worker's hold the bounces of a wavefront dispatch.
+		this->Config.statistics = WorkerStatistics[0];
+
+		for (unsigned int i = 1; i < this->Config.thread_count; i++)
+		{
+			this->Config.statistics.trace_ray_count += WorkerStatistics[i].trace_ray_count;
+			this->Config.statistics.packet_ray_count += WorkerStatistics[i].packet_ray_count;
+
+			for (size_t j = 0; j < this->InitConfig.hit_groups.size(); j++)
+			{
+				this->Config.statistics.intersection_invocations[j] += WorkerStatistics[i].intersection_invocations[j];
+				this->Config.statistics.any_hit_invocations[j] += WorkerStatistics[i].any_hit_invocations[j];
+				this->Config.statistics.closest_hit_invocations[j] += WorkerStatistics[i].closest_hit_invocations[j];
+				this->Config.statistics.path_counts[j] += WorkerStatistics[i].path_counts[j];
+				this->Config.statistics.path_ray_counts[j] += WorkerStatistics[i].path_ray_counts[j];
+				this->Config.statistics.closest_hit_seconds[j] += WorkerStatistics[i].closest_hit_seconds[j];
+			}
+
+			this->Config.statistics.miss_seconds += WorkerStatistics[i].miss_seconds;
+
+			for (size_t j = 0; j < this->InitConfig.miss_shaders.size(); j++)
+			{
+				this->Config.statistics.miss_invocations[j] += WorkerStatistics[i].miss_invocations[j];
+			}
+		}
+
+		// Load balance, as seen by the pool. Every task is a single tile. (The tasks of a wavefront dispatch are batches of queued rays instead, so those get left out.)
+		this->Config.statistics.workers.clear();
+
+		if (!this->InitConfig.ray_generation_wavefront_shader)
+		{
+			const std::vector<PoolWorkerStatistics>& PoolStatistics = this->Config.thread_pool.GetStatistics();
+
+			this->Config.statistics.workers.resize(PoolStatistics.size());
+
+			for (size_t i = 0; i < PoolStatistics.size(); i++)
+			{
+				this->Config.statistics.workers[i].tile_count = PoolStatistics[i].tasks_executed;
+				this->Config.statistics.workers[i].stolen_tile_count = PoolStatistics[i].tasks_stolen;
+				this->Config.statistics.workers[i].busy_seconds = PoolStatistics[i].busy_seconds;
+				this->Config.statistics.workers[i].idle_seconds = PoolStatistics[i].idle_seconds;
+			}
+		}
+
+		this->Config.statistics.dispatch_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+	}
+
+	void CPUDXRPipeline::TraceRay
+	(
+		unsigned int RayFlags,
+		unsigned int InstanceInclusionMask,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		const RayDesc& Ray,
+		RayPayload& Payload
+	) const
+	{
+		if (CurrentDispatch.recursion_depth >= CurrentDispatch.max_trace_recursion_depth)
+		{
+			FailCheck(false, "TraceRay() exceeded MaxTraceRecursionDepth.", this->Config.name);
+			return;
+		}
+
+		RayState State{};
+		State.ray = Ray;
+		State.ray_flags = RayFlags;
+		State.ray_contribution_to_hit_group_index = RayContributionToHitGroupIndex;
+		State.multiplier_for_geometry_contribution_to_hit_group_index = MultiplierForGeometryContributionToHitGroupIndex;
+		State.ptr_payload = &Payload;
+		State.t_current = Ray.TMax;
+
+		RayState* pCallerRay = CurrentDispatch.ptr_current_ray;
+		CurrentDispatch.ptr_current_ray = &State;
+		CurrentDispatch.recursion_depth++;
+		CurrentDispatch.ptr_statistics->trace_ray_count++;
+
+		this->FindClosestHit(&State, InstanceInclusionMask);
+
+		this->InvokeClosestHitOrMiss(&State, MissShaderIndex);
+
+		CurrentDispatch.recursion_depth--;
+		CurrentDispatch.ptr_current_ray = pCallerRay;
+	}
+
+	void CPUDXRPipeline::FindClosestHit
+	(
+		RayState* pState,
+		unsigned int InstanceInclusionMask
+	) const
+	{
+		RayState& State = *pState;
+
+		const RayDesc& Ray = State.ray;
+		const unsigned int RayFlags = State.ray_flags;
+
+		// Invokes the intersection shader of an instance whose bounds the ray enters. Returns true once the search should end.
+		auto IntersectInstance = [&](unsigned int i, float* pTMax) -> bool
+		{
+			const Instance& CandidateInstance = this->Config.instances[i];
+
+			if ((CandidateInstance.instance_desc.InstanceMask & InstanceInclusionMask & 0xFF) == 0)
+			{
+				return false;
+			}
+
+			bool Opaque = IsOpaque(CandidateInstance.instance_desc.Flags, RayFlags);
+
+			if (((RayFlags & RAY_FLAG_CULL_OPAQUE) != 0 && Opaque) || ((RayFlags & RAY_FLAG_CULL_NON_OPAQUE) != 0 && !Opaque))
+			{
+				return false;
+			}
+
+			const float Radius = this->Config.world_spheres.radius[i];
+
+			if (Radius > 0.0f)
+			{
+				// Uniformly scaled instances get their AABB tested in World-Space, as the box around their sphere.
+				const float x = this->Config.world_spheres.center_x[i];
+				const float y = this->Config.world_spheres.center_y[i];
+				const float z = this->Config.world_spheres.center_z[i];
+
+				if (RayIntersectsAABB(Ray.Origin, Ray.Direction, RaytracingAABB{ x - Radius, y - Radius, z - Radius, x + Radius, y + Radius, z + Radius }, Ray.TMin, *pTMax) == false)
+				{
+					return false;
+				}
+			}
+			else
+			{
+				Float3 ObjectOrigin = TransformPoint3x4(CandidateInstance.world_to_object, Ray.Origin);
+				Float3 ObjectDirection = TransformVector3x4(CandidateInstance.world_to_object, Ray.Direction);
+
+				if (RayIntersectsAABB(ObjectOrigin, ObjectDirection, this->InitConfig.blas_aabb, Ray.TMin, *pTMax) == false)
+				{
+					return false;
+				}
+			}
+
+			// Hit group record = RayContribution + (GeometryMultiplier * GeometryIndex) + InstanceContribution. (One geometry per BLAS.)
+			State.ptr_instance = &CandidateInstance;
+			State.instance_index = i;
+			State.hit_group_index = State.ray_contribution_to_hit_group_index + CandidateInstance.instance_desc.InstanceContributionToHitGroupIndex;
+
+			if (State.hit_group_index >= this->InitConfig.hit_groups.size())
+			{
+				FailCheck(false, "Hit group index is outside of the hit group shader table.", this->Config.name);
+				return false;
+			}
+
+			CurrentDispatch.ptr_statistics->intersection_invocations[State.hit_group_index]++;
+
+			this->InitConfig.hit_groups[State.hit_group_index].intersection_shader();
+
+			return State.end_search;
+		};
+
+		// Walk the hierarchy; ReportHit() shrinks t_current, which prunes the nodes behind the closest hit.
+		// Rays that accept their first hit don't need the nodes in order, so they take the cheaper any-hit traversal.
+		if ((RayFlags & RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH) != 0)
+		{
+			this->Config.acceleration_structure.TraverseAnyHit(Ray.Origin, Ray.Direction, Ray.TMin, &(State.t_current), IntersectInstance);
+		}
+		else
+		{
+			this->Config.acceleration_structure.TraverseClosestHit(Ray.Origin, Ray.Direction, Ray.TMin, &(State.t_current), IntersectInstance);
+		}
+	}
+
+	void CPUDXRPipeline::TraceRayPacket
+	(
+		unsigned int RayFlags,
+		unsigned int InstanceInclusionMask,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		const RayDesc* pRays,
+		const UInt2* pDispatchRaysIndices,
+		RayPayload* pPayloads,
+		unsigned int RayCount
+	) const
+	{
+		UInt2 CallerDispatchRaysIndex = CurrentDispatch.dispatch_rays_index;
+
+		PacketScratch& Scratch = CurrentPacketScratch;
+
+		for (unsigned int Octant = 0; Octant < 8; Octant++)
+		{
+			Scratch.octant_lanes[Octant].clear();
+		}
+
+		Scratch.single_lanes.clear();
+
+		// Only opaque closest hits can be found for a whole packet at once: nothing else may get a say in which hit is the closest one.
+		const unsigned int UnsupportedRayFlags = RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH | RAY_FLAG_CULL_OPAQUE | RAY_FLAG_CULL_NON_OPAQUE;
+
+		bool Packetable = this->Config.packet_traceable == true && RayCount > 1 && (RayFlags & RAY_FLAG_FORCE_OPAQUE) != 0 && (RayFlags & UnsupportedRayFlags) == 0;
+
+		// Group the rays by the signs of their directions, which the packets' bounds rely on. Rays running along an axis plane go one by one.
+		for (unsigned int i = 0; i < RayCount; i++)
+		{
+			const Float3& Direction = pRays[i].Direction;
+
+			if (Packetable == false || Direction.x == 0.0f || Direction.y == 0.0f || Direction.z == 0.0f)
+			{
+				Scratch.single_lanes.push_back(i);
+				continue;
+			}
+
+			unsigned int Octant = (Direction.x < 0.0f ? 1 : 0) | (Direction.y < 0.0f ? 2 : 0) | (Direction.z < 0.0f ? 4 : 0);
+
+			Scratch.octant_lanes[Octant].push_back(i);
+		}
+
+		for (unsigned int Octant = 0; Octant < 8; Octant++)
+		{
+			const std::vector<unsigned int>& Lanes = Scratch.octant_lanes[Octant];
+
+			if (Lanes.size() > 1 && this->TracePacket(RayFlags, InstanceInclusionMask, RayContributionToHitGroupIndex, MultiplierForGeometryContributionToHitGroupIndex, MissShaderIndex, pRays, pDispatchRaysIndices, pPayloads, Lanes.data(), (unsigned int)Lanes.size()) == true)
+			{
+				continue;
+			}
+
+			Scratch.single_lanes.insert(Scratch.single_lanes.end(), Lanes.begin(), Lanes.end());
+		}
+
+		// Rays the packets couldn't take, in their original order.
+		std::sort(Scratch.single_lanes.begin(), Scratch.single_lanes.end());
+
+		for (unsigned int i : Scratch.single_lanes)
+		{
+			CurrentDispatch.dispatch_rays_index = pDispatchRaysIndices[i];
+
+			this->TraceRay(RayFlags, InstanceInclusionMask, RayContributionToHitGroupIndex, MultiplierForGeometryContributionToHitGroupIndex, MissShaderIndex, pRays[i], pPayloads[i]);
+		}
+
+		CurrentDispatch.dispatch_rays_index = CallerDispatchRaysIndex;
+	}
+
+	void CPUDXRPipeline::TraceRayQueue
+	(
+		unsigned int RayFlags,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		QueuedRay* pRays,
+		RayPayload* pPayloads,
+		unsigned int RayCount,
+		unsigned int PathDepth
+	) const
+	{
+		if (CurrentDispatch.ptr_worker_statistics == nullptr)
+		{
+			FailCheck(false, "TraceRayQueue() was called outside of a wavefront ray generation shader.", this->Config.name);
+			return;
+		}
+
+		if (CurrentDispatch.recursion_depth >= CurrentDispatch.max_trace_recursion_depth)
+		{
+			FailCheck(false, "TraceRayQueue() exceeded MaxTraceRecursionDepth.", this->Config.name);
+			return;
+		}
+
+		const DispatchState CallerDispatch = CurrentDispatch;
+
+		RayQueueScratch& Scratch = CurrentRayQueueScratch;
+
+		CPUWorkStealingPool& ThreadPool = *(CallerDispatch.ptr_thread_pool);
+
+		// Makes a worker's intrinsics behave as they would for a ray traced by the caller, counting into the worker's own statistics.
+		auto BeginQueuedRay = [&](RayState* pState, const QueuedRay& Ray, DispatchState* pWorkerDispatch)
+		{
+			*pWorkerDispatch = CurrentDispatch;
+
+			RayState& State = *pState;
+			State.ray = Ray.Ray;
+			State.ray_flags = RayFlags;
+			State.ray_contribution_to_hit_group_index = RayContributionToHitGroupIndex;
+			State.multiplier_for_geometry_contribution_to_hit_group_index = MultiplierForGeometryContributionToHitGroupIndex;
+			State.ptr_payload = &(pPayloads[Ray.PayloadIndex]);
+			State.t_current = Ray.Ray.TMax;
+
+			CurrentDispatch = CallerDispatch;
+			CurrentDispatch.ptr_statistics = &((*CallerDispatch.ptr_worker_statistics)[ThreadPool.GetCurrentWorkerIndex()]);
+			CurrentDispatch.dispatch_rays_index = Ray.DispatchIndex;
+			CurrentDispatch.ptr_current_ray = pState;
+			CurrentDispatch.recursion_depth++;
+		};
+
+		auto SortStartTime = std::chrono::steady_clock::now();
+
+		// Sort the rays by the octant of their directions, then by the cell their origins are in. Rays from the same place headed the same way visit the same nodes.
+		const BVHBounds& SceneBounds = this->Config.scene_bounds;
+		const unsigned int CellCount = 1U << RayQueueCellBits;
+
+		Float3 SceneExtent = SceneBounds.Max - SceneBounds.Min;
+		Float3 CellScale
+		{
+			SceneExtent.x > 0.0f ? (float)CellCount / SceneExtent.x : 0.0f,
+			SceneExtent.y > 0.0f ? (float)CellCount / SceneExtent.y : 0.0f,
+			SceneExtent.z > 0.0f ? (float)CellCount / SceneExtent.z : 0.0f
+		};
+
+		// The buffers only ever grow, so that the shrinking queues of the later bounces don't get them cleared out again for the next camera rays.
+		if (Scratch.keys.size() < RayCount)
+		{
+			Scratch.keys.resize(RayCount);
+			Scratch.sorted_rays.resize(RayCount);
+			Scratch.hits.resize(RayCount);
+			Scratch.shading_order.resize(RayCount);
+		}
+
+		ThreadPool.ParallelFor(RayCount, RayQueueBatchSize, [&](unsigned int Begin, unsigned int End)
+		{
+			for (unsigned int i = Begin; i < End; i++)
+			{
+				const RayDesc& Ray = pRays[i].Ray;
+
+				unsigned int Octant = (Ray.Direction.x < 0.0f ? 1 : 0) | (Ray.Direction.y < 0.0f ? 2 : 0) | (Ray.Direction.z < 0.0f ? 4 : 0);
+
+				Float3 Cell = (Ray.Origin - SceneBounds.Min) * CellScale;
+
+				unsigned int CellX = (unsigned int)std::min(std::max(Cell.x, 0.0f), (float)(CellCount - 1));
+				unsigned int CellY = (unsigned int)std::min(std::max(Cell.y, 0.0f), (float)(CellCount - 1));
+				unsigned int CellZ = (unsigned int)std::min(std::max(Cell.z, 0.0f), (float)(CellCount - 1));
+
+				Scratch.keys[i] = (Octant << (3 * RayQueueCellBits)) | GetMortonCellKey(CellX, CellY, CellZ);
+			}
+		});
+
+		CountingSort(Scratch.keys.data(), RayCount, 8U << (3 * RayQueueCellBits), &(Scratch.bin_offsets), Scratch.shading_order.data());
+
+		for (unsigned int i = 0; i < RayCount; i++)
+		{
+			Scratch.sorted_rays[i] = pRays[Scratch.shading_order[i]];
+		}
+
+		std::copy(Scratch.sorted_rays.begin(), Scratch.sorted_rays.begin() + RayCount, pRays);
+
+		auto TraceStartTime = std::chrono::steady_clock::now();
+
+		// Find every ray's closest hit, in batches of neighboring rays.
+		ThreadPool.ParallelFor(RayCount, RayQueueBatchSize, [&](unsigned int Begin, unsigned int End)
+		{
+			for (unsigned int i = Begin; i < End; i++)
+			{
+				RayState State{};
+				DispatchState WorkerDispatch{};
+
+				BeginQueuedRay(&State, pRays[i], &WorkerDispatch);
+
+				CurrentDispatch.ptr_statistics->trace_ray_count++;
+
+				this->FindClosestHit(&State, pRays[i].InstanceInclusionMask);
+
+				QueuedHit& Hit = Scratch.hits[i];
+				Hit.committed = State.committed;
+				Hit.instance_index = State.committed_instance_index;
+				Hit.hit_group_index = State.committed_hit_group_index;
+				Hit.hit_kind = State.committed_hit_kind;
+				Hit.t = State.t_current;
+				Hit.attributes = State.committed_attributes;
+
+				CurrentDispatch = WorkerDispatch;
+			}
+		});
+
+		auto ShadeStartTime = std::chrono::steady_clock::now();
+
+		// Runs the closest-hit or miss shaders of the rays in [Begin, End) of the shading order.
+		auto ShadeQueuedRays = [&](unsigned int Begin, unsigned int End)
+		{
+			for (unsigned int j = Begin; j < End; j++)
+			{
+				const unsigned int i = Scratch.shading_order[j];
+				const QueuedHit& Hit = Scratch.hits[i];
+
+				RayState State{};
+				DispatchState WorkerDispatch{};
+
+				BeginQueuedRay(&State, pRays[i], &WorkerDispatch);
+
+				State.t_current = Hit.t;
+				State.committed = Hit.committed;
+				State.committed_instance_index = Hit.instance_index;
+				State.committed_hit_group_index = Hit.hit_group_index;
+				State.committed_hit_kind = Hit.hit_kind;
+				State.committed_attributes = Hit.attributes;
+
+				this->InvokeClosestHitOrMiss(&State, MissShaderIndex);
+
+				CurrentDispatch = WorkerDispatch;
+			}
+		};
+
+		if (this->InitConfig.sort_queued_hits == true)
+		{
+			// Bin the hits by hit group, the misses last, and run each bin's shaders together: the same code, reading the same material, over and over.
+			const unsigned int MissBin = (unsigned int)this->InitConfig.hit_groups.size();
+
+			for (unsigned int i = 0; i < RayCount; i++)
+			{
+				Scratch.keys[i] = Scratch.hits[i].committed == true ? Scratch.hits[i].hit_group_index : MissBin;
+			}
+
+			CountingSort(Scratch.keys.data(), RayCount, MissBin + 1, &(Scratch.bin_offsets), Scratch.shading_order.data());
+
+			// The bins lie back to back in the shading order, so they all get shaded in one loop over it. Batches that straddle a bin's end get split there, so that each bin gets timed on the worker shading it.
+			// (The sort leaves each bin's offset at the end of its rays.)
+			ThreadPool.ParallelFor(RayCount, RayQueueBatchSize, [&](unsigned int Begin, unsigned int End)
+			{
+				DispatchStatistics& Statistics = (*CallerDispatch.ptr_worker_statistics)[ThreadPool.GetCurrentWorkerIndex()];
+
+				unsigned int Bin = (unsigned int)(std::upper_bound(Scratch.bin_offsets.begin(), Scratch.bin_offsets.begin() + MissBin + 1, Begin) - Scratch.bin_offsets.begin());
+
+				for (; Begin < End; Bin++)
+				{
+					const unsigned int BinEnd = std::min(Scratch.bin_offsets[Bin], End);
+
+					if (Begin == BinEnd)
+					{
+						continue;
+					}
+
+					auto BinStartTime = std::chrono::steady_clock::now();
+
+					ShadeQueuedRays(Begin, BinEnd);
+
+					double BinSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - BinStartTime).count();
+
+					if (Bin == MissBin)
+					{
+						Statistics.miss_seconds += BinSeconds;
+					}
+					else
+					{
+						Statistics.closest_hit_seconds[Bin] += BinSeconds;
+					}
+
+					Begin = BinEnd;
+				}
+			});
+		}
+		else
+		{
+			for (unsigned int i = 0; i < RayCount; i++)
+			{
+				Scratch.shading_order[i] = i;
+			}
+
+			ThreadPool.ParallelFor(RayCount, RayQueueBatchSize, ShadeQueuedRays);
+		}
+
+		auto EndTime = std::chrono::steady_clock::now();
+
+		// Rays of the bounce, counted on the caller's statistics.
+		std::vector<BounceStatistics>& Bounces = CallerDispatch.ptr_statistics->bounces;
+
+		if (PathDepth > 0)
+		{
+			if (Bounces.size() < PathDepth)
+			{
+				Bounces.resize(PathDepth, BounceStatistics{ 0, 0.0, 0.0, 0.0 });
+			}
+
+			BounceStatistics& Bounce = Bounces[PathDepth - 1];
+			Bounce.ray_count += RayCount;
+			Bounce.sort_seconds += std::chrono::duration<double>(TraceStartTime - SortStartTime).count();
+			Bounce.trace_seconds += std::chrono::duration<double>(ShadeStartTime - TraceStartTime).count();
+			Bounce.shade_seconds += std::chrono::duration<double>(EndTime - ShadeStartTime).count();
+		}
+	}
+
+	bool CPUDXRPipeline::UpdateInstances
+	(
+		const SceneInstanceDesc* pInstanceDescs,
+		const unsigned int* pChangedInstanceIndices,
+		unsigned int ChangedInstanceCount
+	)
+	{
+		const unsigned int InstanceCount = (unsigned int)this->Config.instances.size();
+
+		if (pChangedInstanceIndices == nullptr)
+		{
+			this->Config.thread_pool.ParallelFor
+			(
+				InstanceCount,
+				InstanceCopyGrain,
+				[this, pInstanceDescs](unsigned int Begin, unsigned int End)
+				{
+					for (unsigned int i = Begin; i < End; i++)
+					{
+						this->CopyInstance(i, pInstanceDescs[i]);
+					}
+				}
+			);
+		}
+		else
+		{
+			for (unsigned int i = 0; i < ChangedInstanceCount; i++)
+			{
+				unsigned int InstanceIndex = pChangedInstanceIndices[i];
+
+				if (InstanceIndex >= InstanceCount)
+				{
+					FailCheck(false, "UpdateInstances() was given an instance index that is out of range.", this->Config.name);
+					continue;
+				}
+
+				this->CopyInstance(InstanceIndex, pInstanceDescs[InstanceIndex]);
+			}
+		}
+
+		bool Rebuilt = this->Config.acceleration_structure.Update(pChangedInstanceIndices, ChangedInstanceCount);
+
+		this->UpdatePacketTraceable();
+		this->UpdateSceneBounds();
+
+		return Rebuilt;
+	}
+
+	const DispatchStatistics& CPUDXRPipeline::GetStatistics
+	()
+	{
+		return this->Config.statistics;
+	}
+
+	const CPUBVH& CPUDXRPipeline::GetAccelerationStructure
+	()
+	{
+		return this->Config.acceleration_structure;
+	}
+
+	CPUWorkStealingPool& CPUDXRPipeline::GetThreadPool
+	()
+	{
+		return this->Config.thread_pool;
+	}
+
+	const WorldSphereArrays& CPUDXRPipeline::GetWorldSpheres
+	() const
+	{
+		return this->Config.world_spheres;
+	}
+
+	CPUDXRPipeline::~CPUDXRPipeline
+	()
+	{
+		// Nothing here, for now.
+	}
+
+	void CPUDXRPipeline::CopyInstance
+	(
+		unsigned int InstanceIndex,
+		const SceneInstanceDesc& InstanceDesc
+	)
+	{
+		// Make sure the instance refers to a valid hit group record.
+		FailCheck
+		(
+			InstanceDesc.InstanceContributionToHitGroupIndex < this->InitConfig.hit_groups.size(),
+			"InstanceContributionToHitGroupIndex is outside of the hit group shader table.",
+			this->Config.name
+		);
+
+		Instance& Destination = this->Config.instances[InstanceIndex];
+		Destination.instance_desc = InstanceDesc;
+
+		InvertTransform3x4(Destination.instance_desc.Transform, Destination.world_to_object);
+
+		this->Config.instance_bounds[InstanceIndex] = GetInstanceBounds(Destination.instance_desc.Transform, this->InitConfig.blas_aabb);
+
+		Float3 Center{ 0.0f, 0.0f, 0.0f };
+		float Radius{ 0.0f };
+
+		GetInstanceSphere(Destination.instance_desc.Transform, this->InitConfig.blas_aabb, &Center, &Radius);
+
+		this->Config.world_spheres.center_x[InstanceIndex] = Center.x;
+		this->Config.world_spheres.center_y[InstanceIndex] = Center.y;
+		this->Config.world_spheres.center_z[InstanceIndex] = Center.z;
+		this->Config.world_spheres.radius[InstanceIndex] = Radius;
+	}
+
+	void CPUDXRPipeline::CopyMaterial
+	(
+		unsigned int InstanceIndex,
+		const SceneMaterial& Material
+	)
+	{
+		this->Config.world_spheres.albedo_x[InstanceIndex] = Material.Albedo.x;
+		this->Config.world_spheres.albedo_y[InstanceIndex] = Material.Albedo.y;
+		this->Config.world_spheres.albedo_z[InstanceIndex] = Material.Albedo.z;
+		this->Config.world_spheres.roughness[InstanceIndex] = Material.Roughness;
+		this->Config.world_spheres.emission_x[InstanceIndex] = Material.Emission.x;
+		this->Config.world_spheres.emission_y[InstanceIndex] = Material.Emission.y;
+		this->Config.world_spheres.emission_z[InstanceIndex] = Material.Emission.z;
+		this->Config.world_spheres.index_of_refraction[InstanceIndex] = Material.IndexOfRefraction;
+	}
+
+	void CPUDXRPipeline::UpdatePacketTraceable
+	()
+	{
+		const CPUBVH& AccelerationStructure = this->Config.acceleration_structure;
+
+		this->Config.packet_traceable = AccelerationStructure.GetWideNodeCount() > 0 && AccelerationStructure.IsQuantized() == false;
+
+		for (const HitGroup& Group : this->InitConfig.hit_groups)
+		{
+			this->Config.packet_traceable = this->Config.packet_traceable && Group.intersects_world_sphere;
+		}
+
+		for (float Radius : this->Config.world_spheres.radius)
+		{
+			this->Config.packet_traceable = this->Config.packet_traceable && Radius > 0.0f;
+		}
+	}
+
+	void CPUDXRPipeline::UpdateSceneBounds
+	()
+	{
+		BVHBounds& SceneBounds = this->Config.scene_bounds;
+
+		SceneBounds = BVHBounds{ Float3{ 0.0f, 0.0f, 0.0f }, Float3{ 0.0f, 0.0f, 0.0f } };
+
+		for (size_t i = 0; i < this->Config.instance_bounds.size(); i++)
+		{
+			const BVHBounds& Bounds = this->Config.instance_bounds[i];
+
+			SceneBounds.Min = i == 0 ? Bounds.Min : Float3{ std::min(SceneBounds.Min.x, Bounds.Min.x), std::min(SceneBounds.Min.y, Bounds.Min.y), std::min(SceneBounds.Min.z, Bounds.Min.z) };
+			SceneBounds.Max = i == 0 ? Bounds.Max : Float3{ std::max(SceneBounds.Max.x, Bounds.Max.x), std::max(SceneBounds.Max.y, Bounds.Max.y), std::max(SceneBounds.Max.z, Bounds.Max.z) };
+		}
+	}
+
+	bool CPUDXRPipeline::TracePacket
+	(
+		unsigned int RayFlags,
+		unsigned int InstanceInclusionMask,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		const RayDesc* pRays,
+		const UInt2* pDispatchRaysIndices,
+		RayPayload* pPayloads,
+		const unsigned int* pLanes,
+		unsigned int LaneCount
+	) const
+	{
+		if (CurrentDispatch.recursion_depth >= CurrentDispatch.max_trace_recursion_depth)
+		{
+			return false;
+		}
+
+		PacketScratch& Scratch = CurrentPacketScratch;
+
+		const unsigned int SpherePacketCount = (LaneCount + SphereKernelMaxPacketSize - 1) / SphereKernelMaxPacketSize;
+
+		Scratch.origins.resize(LaneCount);
+		Scratch.directions.resize(LaneCount);
+		Scratch.t_mins.resize(LaneCount);
+		Scratch.sphere_packets.resize(SpherePacketCount);
+
+		// Farthest of the rays' closest hits so far, which is as far as the packet needs to go.
+		float MaxTMax{ 0.0f };
+
+		for (unsigned int i = 0; i < LaneCount; i++)
+		{
+			const RayDesc& Ray = pRays[pLanes[i]];
+
+			Scratch.origins[i] = Ray.Origin;
+			Scratch.directions[i] = Ray.Direction;
+			Scratch.t_mins[i] = Ray.TMin;
+
+			SphereRayPacket& Packet = Scratch.sphere_packets[i / SphereKernelMaxPacketSize];
+			const unsigned int Lane = i % SphereKernelMaxPacketSize;
+
+			Packet.OriginX[Lane] = Ray.Origin.x;
+			Packet.OriginY[Lane] = Ray.Origin.y;
+			Packet.OriginZ[Lane] = Ray.Origin.z;
+			Packet.DirectionX[Lane] = Ray.Direction.x;
+			Packet.DirectionY[Lane] = Ray.Direction.y;
+			Packet.DirectionZ[Lane] = Ray.Direction.z;
+			Packet.TMin[Lane] = Ray.TMin;
+			Packet.T[Lane] = Ray.TMax;
+			Packet.SphereIndex[Lane] = ~0U;
+
+			MaxTMax = std::max(MaxTMax, Ray.TMax);
+		}
+
+		BVH8PacketFrustum Frustum{};
+
+		if (GetBVH8PacketFrustum(Scratch.origins.data(), Scratch.directions.data(), Scratch.t_mins.data(), LaneCount, &Frustum) == false)
+		{
+			return false;
+		}
+
+		// Intersects every ray of the packet with the sphere of an instance whose bounds the packet enters.
+		auto IntersectInstance = [&](unsigned int i, float* pMaxTMax) -> bool
+		{
+			if ((this->Config.instances[i].instance_desc.InstanceMask & InstanceInclusionMask & 0xFF) == 0)
+			{
+				return false;
+			}
+
+			Float3 Center{ this->Config.world_spheres.center_x[i], this->Config.world_spheres.center_y[i], this->Config.world_spheres.center_z[i] };
+			float Radius = this->Config.world_spheres.radius[i];
+
+			float NewMaxTMax{ 0.0f };
+
+			for (unsigned int j = 0; j < SpherePacketCount; j++)
+			{
+				SphereRayPacket& Packet = Scratch.sphere_packets[j];
+				const unsigned int PacketRayCount = std::min(LaneCount - (j * SphereKernelMaxPacketSize), SphereKernelMaxPacketSize);
+
+				IntersectRayPacketSphere(&Packet, PacketRayCount, Center, Radius, i);
+
+				for (unsigned int Lane = 0; Lane < PacketRayCount; Lane++)
+				{
+					NewMaxTMax = std::max(NewMaxTMax, Packet.T[Lane]);
+				}
+			}
+
+			*pMaxTMax = NewMaxTMax;
+
+			return false;
+		};
+
+		if (this->Config.acceleration_structure.TraverseClosestHitPacket(Frustum, &MaxTMax, IntersectInstance) == false)
+		{
+			return false;
+		}
+
+		// Commit each ray's closest hit, and invoke its shaders, as TraceRay() would have.
+		for (unsigned int i = 0; i < LaneCount; i++)
+		{
+			const unsigned int RayIndex = pLanes[i];
+			const RayDesc& Ray = pRays[RayIndex];
+
+			const SphereRayPacket& Packet = Scratch.sphere_packets[i / SphereKernelMaxPacketSize];
+			const unsigned int InstanceIndex = Packet.SphereIndex[i % SphereKernelMaxPacketSize];
+
+			CurrentDispatch.dispatch_rays_index = pDispatchRaysIndices[RayIndex];
+
+			RayState State{};
+			State.ray = Ray;
+			State.ray_flags = RayFlags;
+			State.ray_contribution_to_hit_group_index = RayContributionToHitGroupIndex;
+			State.multiplier_for_geometry_contribution_to_hit_group_index = MultiplierForGeometryContributionToHitGroupIndex;
+			State.ptr_payload = &(pPayloads[RayIndex]);
+			State.t_current = Ray.TMax;
+
+			if (InstanceIndex != ~0U)
+			{
+				// The hit gets redone the way the intersection shaders do it, for the exact distance and attributes they would have reported.
+				// The rare ray that the kernel's rounding put on the other side of TMin or TMax gets traced on its own instead.
+				Float3 Center{ this->Config.world_spheres.center_x[InstanceIndex], this->Config.world_spheres.center_y[InstanceIndex], this->Config.world_spheres.center_z[InstanceIndex] };
+				float THit{};
+				IntersectionAttributes Attributes{};
+
+				unsigned int HitGroupIndex = RayContributionToHitGroupIndex + this->Config.instances[InstanceIndex].instance_desc.InstanceContributionToHitGroupIndex;
+
+				if (GetWorldIntersection(Ray.Origin, Ray.Direction, Center, this->Config.world_spheres.radius[InstanceIndex], Ray.TMin, Ray.TMax, &THit, &Attributes) == false || HitGroupIndex >= this->InitConfig.hit_groups.size())
+				{
+					this->TraceRay(RayFlags, InstanceInclusionMask, RayContributionToHitGroupIndex, MultiplierForGeometryContributionToHitGroupIndex, MissShaderIndex, Ray, pPayloads[RayIndex]);
+					continue;
+				}
+
+				State.t_current = THit;
+				State.committed = true;
+				State.committed_instance_index = InstanceIndex;
+				State.committed_hit_group_index = HitGroupIndex;
+				State.committed_hit_kind = SphereHit;
+				State.committed_attributes = Attributes;
+			}
+
+			RayState* pCallerRay = CurrentDispatch.ptr_current_ray;
+			CurrentDispatch.ptr_current_ray = &State;
+			CurrentDispatch.recursion_depth++;
+			CurrentDispatch.ptr_statistics->trace_ray_count++;
+			CurrentDispatch.ptr_statistics->packet_ray_count++;
+
+			this->InvokeClosestHitOrMiss(&State, MissShaderIndex);
+
+			CurrentDispatch.recursion_depth--;
+			CurrentDispatch.ptr_current_ray = pCallerRay;
+		}
+
+		return true;
+	}
+
+	void CPUDXRPipeline::InvokeClosestHitOrMiss
+	(
+		RayState* pState,
+		unsigned int MissShaderIndex
+	) const
+	{
+		RayState& State = *pState;
+		RayPayload& Payload = *(State.ptr_payload);
+
+		// Tag paths with the hit group of their camera ray's hit (the payloads that haven't hit anything yet), and count each of their rays towards it.
+		if (Payload.IntersectionCount == 0)
+		{
+			Payload.PathHitGroupIndex = State.committed == true ? State.committed_hit_group_index : ~0U;
+
+			if (State.committed == true)
+			{
+				CurrentDispatch.ptr_statistics->path_counts[Payload.PathHitGroupIndex]++;
+			}
+		}
+
+		if (Payload.PathHitGroupIndex < this->InitConfig.hit_groups.size())
+		{
+			CurrentDispatch.ptr_statistics->path_ray_counts[Payload.PathHitGroupIndex]++;
+		}
+
+		if (State.committed == true)
+		{
+			if ((State.ray_flags & RAY_FLAG_SKIP_CLOSEST_HIT_SHADER) == 0)
+			{
+				const HitGroup& Group = this->InitConfig.hit_groups[State.committed_hit_group_index];
+
+				State.ptr_instance = &(this->Config.instances[State.committed_instance_index]);
+				State.instance_index = State.committed_instance_index;
+				State.hit_group_index = State.committed_hit_group_index;
+				State.hit_kind = State.committed_hit_kind;
+
+				CurrentDispatch.ptr_statistics->closest_hit_invocations[State.hit_group_index]++;
+
+				if (Group.closest_hit_shader)
+				{
+					Group.closest_hit_shader(*(State.ptr_payload), State.committed_attributes);
+				}
+			}
+		}
+		else if (MissShaderIndex >= this->InitConfig.miss_shaders.size())
+		{
+			FailCheck(false, "MissShaderIndex is outside of the miss shader table.", this->Config.name);
+		}
+		else
+		{
+			CurrentDispatch.ptr_statistics->miss_invocations[MissShaderIndex]++;
+
+			State.ptr_instance = nullptr;
+
+			this->InitConfig.miss_shaders[MissShaderIndex](*(State.ptr_payload));
+		}
+	}
+
+	void CPUDXRPipeline::UpdateTileOrigins
+	(
+		unsigned int Width,
+		unsigned int Height
+	)
+	{
+		if (this->Config.tile_origins.empty() == false && this->Config.tile_origins_dimensions.x == Width && this->Config.tile_origins_dimensions.y == Height)
+		{
+			return;
+		}
+
+		unsigned int TileCountX = (Width + this->InitConfig.tile_width - 1) / this->InitConfig.tile_width;
+		unsigned int TileCountY = (Height + this->InitConfig.tile_height - 1) / this->InitConfig.tile_height;
+
+		// The curves are laid over the smallest power-of-2 square grid that holds every tile, and the tiles outside of the image are skipped.
+		unsigned int GridSize{ 1 };
+
+		while (GridSize < TileCountX || GridSize < TileCountY)
+		{
+			GridSize *= 2;
+		}
+
+		std::vector<std::pair<unsigned long long, UInt2>> KeyedTiles;
+		KeyedTiles.reserve((size_t)TileCountX * TileCountY);
+
+		for (unsigned int y = 0; y < TileCountY; y++)
+		{
+			for (unsigned int x = 0; x < TileCountX; x++)
+			{
+				unsigned long long Key = (unsigned long long)y * TileCountX + x;
+
+				if (this->InitConfig.tile_order == TILE_ORDER_MORTON)
+				{
+					Key = GetMortonTileKey(x, y);
+				}
+				else if (this->InitConfig.tile_order == TILE_ORDER_HILBERT)
+				{
+					Key = GetHilbertTileKey(GridSize, x, y);
+				}
+
+				KeyedTiles.push_back(std::make_pair(Key, UInt2{ x * this->InitConfig.tile_width, y * this->InitConfig.tile_height }));
+			}
+		}
+
+		std::sort(KeyedTiles.begin(), KeyedTiles.end(), [](const std::pair<unsigned long long, UInt2>& a, const std::pair<unsigned long long, UInt2>& b) { return a.first < b.first; });
+
+		this->Config.tile_origins.resize(KeyedTiles.size());
+
+		for (size_t i = 0; i < KeyedTiles.size(); i++)
+		{
+			this->Config.tile_origins[i] = KeyedTiles[i].second;
+		}
+
+		this->Config.tile_origins_dimensions = UInt2{ Width, Height };
+	}
+
+	void CPUDXRPipeline::DispatchTiles
+	(
+		unsigned int Width,
+		unsigned int Height,
+		std::vector<DispatchStatistics>* pWorkerStatistics
+	)
+	{
+		std::vector<DispatchStatistics>& WorkerStatistics = *pWorkerStatistics;
+
+		// Tiles get dealt out in stretches along the tile order, and stolen one at a time by the workers that finish early: sky tiles take a single miss per sample, while the ones around the contact shadows bounce up to the recursion limit.
+		this->UpdateTileOrigins(Width, Height);
+
+		const std::vector<UInt2>& TileOrigins = this->Config.tile_origins;
+
+		this->Config.thread_pool.DistributedFor
+		(
+			(unsigned int)TileOrigins.size(),
+			1,
+			[&](unsigned int Begin, unsigned int End)
+			{
+				DispatchStatistics* pStatistics = &(WorkerStatistics[this->Config.thread_pool.GetCurrentWorkerIndex()]);
+
+				for (unsigned int i = Begin; i < End; i++)
+				{
+					this->DispatchTile(Width, Height, TileOrigins[i], pStatistics);
+				}
+			}
+		);
+	}
+
+	void CPUDXRPipeline::DispatchTile
+	(
+		unsigned int Width,
+		unsigned int Height,
+		UInt2 TileOrigin,
+		DispatchStatistics* pStatistics
+	) const
+	{
+		CurrentDispatch = DispatchState{};
+		CurrentDispatch.ptr_pipeline = this;
+		CurrentDispatch.ptr_statistics = pStatistics;
+		CurrentDispatch.dispatch_rays_dimensions = UInt2{ Width, Height };
+		CurrentDispatch.max_trace_recursion_depth = this->InitConfig.max_trace_recursion_depth;
+
+		unsigned int EndX = std::min(TileOrigin.x + this->InitConfig.tile_width, Width);
+		unsigned int EndY = std::min(TileOrigin.y + this->InitConfig.tile_height, Height);
+
+		if (this->InitConfig.ray_generation_tile_shader)
+		{
+			CurrentDispatch.dispatch_rays_index = TileOrigin;
+
+			this->InitConfig.ray_generation_tile_shader(TileOrigin, UInt2{ EndX, EndY });
+
+			CurrentDispatch = DispatchState{};
+
+			return;
+		}
+
+		for (unsigned int y = TileOrigin.y; y < EndY; y++)
+		{
+			for (unsigned int x = TileOrigin.x; x < EndX; x++)
+			{
+				CurrentDispatch.dispatch_rays_index = UInt2{ x, y };
+
+				this->InitConfig.ray_generation_shader();
+			}
+		}
+
+		CurrentDispatch = DispatchState{};
+	}
+}
@@ -0,0 +1,508 @@
+// CPUDXR.hpp - Software emulation of the DXR runtime (DispatchRays, TraceRay, shader tables), for the CPU rendering path.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#include "SceneDescription.hpp"
+#include "CPUShaderStuff.hpp"
+#include "CPUBVH.hpp"
+#include "CPUSphereKernels.hpp"
+#include "CPUWorkStealingPool.hpp"
+
+// Software emulation of the DXR runtime.
+namespace CPUDXR
+{
+	// Utility function, shared by every class of the CPU rendering path. Reports the error and exits, since the caller's state can't be relied on past a failed check.
+	inline void FailCheck
+	(
+		bool			succeeded,
+		const char*		error_message,
+		const char*		error_title
+	)
+	{
+		if (succeeded == false)
+		{
+			fprintf(stderr, "%s: %s\n", error_title, error_message);
+
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	// Ray flags, matching the HLSL RAY_FLAG values.
+	enum RAY_FLAG : unsigned int
+	{
+		RAY_FLAG_NONE = 0x00,
+		RAY_FLAG_FORCE_OPAQUE = 0x01,
+		RAY_FLAG_FORCE_NON_OPAQUE = 0x02,
+		RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH = 0x04,
+		RAY_FLAG_SKIP_CLOSEST_HIT_SHADER = 0x08,
+		RAY_FLAG_CULL_BACK_FACING_TRIANGLES = 0x10,
+		RAY_FLAG_CULL_FRONT_FACING_TRIANGLES = 0x20,
+		RAY_FLAG_CULL_OPAQUE = 0x40,
+		RAY_FLAG_CULL_NON_OPAQUE = 0x80
+	};
+
+	// Instance flags, matching D3D12_RAYTRACING_INSTANCE_FLAGS.
+	enum INSTANCE_FLAG : unsigned int
+	{
+		INSTANCE_FLAG_NONE = 0x0,
+		INSTANCE_FLAG_TRIANGLE_CULL_DISABLE = 0x1,
+		INSTANCE_FLAG_TRIANGLE_FRONT_COUNTERCLOCKWISE = 0x2,
+		INSTANCE_FLAG_FORCE_OPAQUE = 0x4,
+		INSTANCE_FLAG_FORCE_NON_OPAQUE = 0x8
+	};
+
+	// Order in which DispatchRays() deals out the tiles of the image to the worker threads. Each worker gets a contiguous stretch of it.
+	enum TILE_ORDER : unsigned int
+	{
+		TILE_ORDER_ROW_MAJOR = 0,
+		TILE_ORDER_MORTON = 1,
+		TILE_ORDER_HILBERT = 2
+	};
+
+	// Equivalent of HLSL's RayDesc.
+	struct RayDesc
+	{
+		Float3 Origin;
+		float TMin;
+		Float3 Direction;
+		float TMax;
+	};
+
+	// Equivalent of D3D12_RAYTRACING_AABB.
+	struct RaytracingAABB
+	{
+		float MinX, MinY, MinZ;
+		float MaxX, MaxY, MaxZ;
+	};
+
+	// Shader signatures. Shaders read the system values through the intrinsic functions below, as in HLSL.
+	using RayGenerationShader = std::function<void()>;
+	using RayGenerationTileShader = std::function<void(UInt2 FirstIndex, UInt2 EndIndex)>;
+	using RayGenerationWavefrontShader = std::function<void()>;
+	using IntersectionShader = std::function<void()>;
+	using AnyHitShader = std::function<void(RayPayload& Payload, const IntersectionAttributes& Attributes)>;
+	using ClosestHitShader = std::function<void(RayPayload& Payload, const IntersectionAttributes& Attributes)>;
+	using MissShader = std::function<void(RayPayload& Payload)>;
+
+	// Equivalent of a procedural-primitive D3D12_HIT_GROUP_DESC, and its shader table record.
+	struct HitGroup
+	{
+		// Label, for reporting statistics.
+		const char* name;
+
+		IntersectionShader intersection_shader;
+		AnyHitShader any_hit_shader;
+		ClosestHitShader closest_hit_shader;
+
+		// Not part of DXR: set if the intersection shader reports the near hit of the ray with the instance's World-Space sphere, and nothing else. (See GetWorldSphere().)
+		// Packets of rays only get traced together when every hit group is set, since they are intersected with the sphere kernels instead of the intersection shaders. (See TraceRayPacket().)
+		bool intersects_world_sphere;
+	};
+
+	// Not part of DXR: a ray waiting in the queue of a wavefront ray generation shader, along with what TraceRay() would take as arguments. (See TraceRayQueue().)
+	struct QueuedRay
+	{
+		RayDesc Ray;
+
+		// DispatchRaysIndex() of the ray's shaders.
+		UInt2 DispatchIndex;
+
+		unsigned int InstanceInclusionMask;
+
+		// Index of the ray's payload, which the queue leaves in place while it sorts the rays.
+		unsigned int PayloadIndex;
+	};
+
+	// Rays traced at one depth of their paths by the TraceRayQueue() calls of a dispatch, and the time each of its stages took.
+	struct BounceStatistics
+	{
+		unsigned long long ray_count;
+
+		// Sorting the rays, finding their closest hits, and running their closest-hit and miss shaders.
+		double sort_seconds;
+		double trace_seconds;
+		double shade_seconds;
+	};
+
+	// Load balance of one worker thread during DispatchRays().
+	struct DispatchWorkerStatistics
+	{
+		// Tiles traced, and how many of them were stolen from other workers.
+		unsigned long long tile_count;
+		unsigned long long stolen_tile_count;
+
+		// Time spent tracing tiles, and time spent looking for more of them, or waiting for the others to finish.
+		double busy_seconds;
+		double idle_seconds;
+	};
+
+	// Shader invocation counts collected during DispatchRays().
+	struct DispatchStatistics
+	{
+		// Number of TraceRay() calls, and rays of TraceRayPacket() calls.
+		unsigned long long trace_ray_count;
+
+		// Number of those rays that got traced along with the rest of their packet, instead of one by one.
+		unsigned long long packet_ray_count;
+
+		// Per hit group shader table record.
+		std::vector<unsigned long long> intersection_invocations;
+		std::vector<unsigned long long> any_hit_invocations;
+		std::vector<unsigned long long> closest_hit_invocations;
+
+		// Per miss shader table record.
+		std::vector<unsigned long long> miss_invocations;
+
+		// Per hit group: the camera rays whose closest hit was in it, which start paths on its material, and every ray traced along those paths, misses included, for their average length.
+		// Paths that continue from a first hit the ray generation shader cached, rather than traced, don't get counted. (See RayPayload::PathHitGroupIndex.)
+		std::vector<unsigned long long> path_counts;
+		std::vector<unsigned long long> path_ray_counts;
+
+		// Time the closest-hit shaders of each hit group, and the miss shaders, took to run, summed over the workers, when tracing wavefronts with their hits sorted by hit group.
+		std::vector<double> closest_hit_seconds;
+		double miss_seconds;
+
+		// Per worker thread, when tracing tiles.
+		std::vector<DispatchWorkerStatistics> workers;
+
+		// Per path depth (the first entry being the camera rays), when tracing wavefronts.
+		std::vector<BounceStatistics> bounces;
+
+		// Wall-clock duration of the dispatch.
+		double dispatch_seconds;
+	};
+
+	// An instance in the emulated top-level acceleration structure, along with its precomputed World-to-Object transform.
+	struct Instance
+	{
+		// The instance description, as supplied by the scene.
+		SceneInstanceDesc instance_desc;
+
+		// Equivalent of WorldToObject3x4().
+		float world_to_object[3][4];
+	};
+
+	// World-Space spheres inscribed in the instances' bottom-level AABBs, in structure-of-arrays layout, so that they can be intersected without going through the 3x4 transforms.
+	// Only instances that are uniformly scaled and translated get one; every other instance has a radius of 0.
+	// The materials of the instances are kept alongside them, in the same layout, every instance having one. (See GetInstanceMaterial().)
+	struct WorldSphereArrays
+	{
+		std::vector<float> center_x;
+		std::vector<float> center_y;
+		std::vector<float> center_z;
+		std::vector<float> radius;
+
+		std::vector<float> albedo_x;
+		std::vector<float> albedo_y;
+		std::vector<float> albedo_z;
+		std::vector<float> roughness;
+		std::vector<float> emission_x;
+		std::vector<float> emission_y;
+		std::vector<float> emission_z;
+		std::vector<float> index_of_refraction;
+	};
+
+	// Intrinsics, callable from within the shaders during DispatchRays().
+	UInt2 DispatchRaysIndex();
+	UInt2 DispatchRaysDimensions();
+
+	Float3 WorldRayOrigin();
+	Float3 WorldRayDirection();
+	Float3 ObjectRayOrigin();
+	Float3 ObjectRayDirection();
+	float RayTMin();
+	float RayTCurrent();
+	unsigned int RayFlags();
+
+	unsigned int InstanceIndex();
+	unsigned int InstanceID();
+	unsigned int PrimitiveIndex();
+	unsigned int HitKind();
+
+	const float(&ObjectToWorld3x4())[3][4];
+	const float(&WorldToObject3x4())[3][4];
+
+	// Not part of HLSL: returns true if the current instance is only uniformly scaled and translated, along with the World-Space sphere inscribed in its AABB.
+	// Callable from intersection, any-hit and closest-hit shaders, which can then work in World-Space instead of Object-Space.
+	bool GetWorldSphere(Float3* pCenter, float* pRadius);
+
+	// Not part of HLSL: returns the material of the current instance, gathered from the arrays kept alongside the World-Space spheres.
+	// Takes the place of the material table the DXR shaders index with InstanceIndex().
+	SceneMaterial GetInstanceMaterial();
+
+	// Intersection shader intrinsic. Returns true if the hit was accepted.
+	bool ReportHit(float THit, unsigned int HitKind, const IntersectionAttributes& Attributes);
+
+	// Any-hit shader intrinsics. Unlike in HLSL, these do not return from the shader, so return right after calling them.
+	void IgnoreHit();
+	void AcceptHitAndEndSearch();
+
+	// Traces a ray into the scene of the pipeline currently running DispatchRays().
+	void TraceRay
+	(
+		unsigned int RayFlags,
+		unsigned int InstanceInclusionMask,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		const RayDesc& Ray,
+		RayPayload& Payload
+	);
+
+	// Not part of HLSL: traces RayCount rays with the same flags and shader indices as TraceRay() would, one after the other, but walks the acceleration structure once for all of them where it can.
+	// Each ray's closest-hit or miss shader sees its own entry of pDispatchRaysIndices as DispatchRaysIndex(). Rays go through TraceRay() one by one instead when the pipeline isn't packet traceable (see HitGroup::intersects_world_sphere),
+	// or when the flags ask for anything but opaque closest hits: RAY_FLAG_FORCE_OPAQUE has to be set, and none of the culling flags nor RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH.
+	// Rays get grouped by the signs of their directions, and each group is traversed as one packet, as long as it holds more than one ray.
+	// NOTE: The intersection shaders are not invoked for the rays of a packet, nor counted in the statistics.
+	void TraceRayPacket
+	(
+		unsigned int RayFlags,
+		unsigned int InstanceInclusionMask,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		const RayDesc* pRays,
+		const UInt2* pDispatchRaysIndices,
+		RayPayload* pPayloads,
+		unsigned int RayCount
+	);
+
+	// Not part of HLSL: traces a queue of rays with the same flags and shader indices, in the manner of a wavefront path tracer, spread across every worker thread. Callable from a wavefront ray generation shader only.
+	// The rays get sorted by the octant of their directions, then by the cell of the scene their origins are in, so that rays headed through the same nodes get traced together. Then their closest hits get found in batches,
+	// and last, their closest-hit and miss shaders get run grouped by hit group (unless sort_queued_hits is off), so that each shader's code and data stay in the caches. pRays is left in the sorted order. PathDepth picks the BounceStatistics to count the rays in.
+	void TraceRayQueue
+	(
+		unsigned int RayFlags,
+		unsigned int RayContributionToHitGroupIndex,
+		unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+		unsigned int MissShaderIndex,
+		QueuedRay* pRays,
+		RayPayload* pPayloads,
+		unsigned int RayCount,
+		unsigned int PathDepth
+	);
+
+	// Not part of HLSL: calls Function(Begin, End) over [0, Count) on every worker thread, for a wavefront ray generation shader to create and continue the rays of its queue with.
+	// Function may not call any of the intrinsics.
+	void ForEachQueuedRay(unsigned int Count, const std::function<void(unsigned int Begin, unsigned int End)>& Function);
+
+	// State of one traced ray, backing the ray-related intrinsics.
+	struct RayState;
+
+
+
+
+
+	// Config data for this class.
+	struct CPUDXRPipelineConfig
+	{
+		// Local copy of the top-level acceleration structure's instances.
+		std::vector<Instance> instances;
+
+		// World-Space bounds of each instance's bottom-level AABB.
+		std::vector<BVHBounds> instance_bounds;
+
+		// World-Space sphere of each instance, where it has one.
+		WorldSphereArrays world_spheres;
+
+		// Bounds of every instance, for sorting queued rays by the cell their origins are in.
+		BVHBounds scene_bounds;
+
+		// Whether TraceRayPacket() can trace packets: every instance has a World-Space sphere, every hit group intersects it, and the hierarchy has full-precision 8-wide nodes.
+		bool packet_traceable;
+
+		// Equivalent of the top-level acceleration structure: a hierarchy over the instance bounds.
+		CPUBVH acceleration_structure;
+
+		// Number of worker threads actually used for dispatching rays.
+		unsigned int thread_count;
+
+		// Workers for building the acceleration structure, and for dispatching rays.
+		CPUWorkStealingPool thread_pool;
+
+		// Origins of the tiles of the last DispatchRays() call's dimensions, in the order they get dealt out in.
+		std::vector<UInt2> tile_origins;
+		UInt2 tile_origins_dimensions;
+
+		// Statistics of the last DispatchRays() call.
+		DispatchStatistics statistics;
+
+		// Label for this class.
+		const char* name;
+
+		// Error message for initialization.
+		const char* error_message;
+	};
+
+	// Populate this before calling the initializer function.
+	struct CPUDXRPipelineInitConfig
+	{
+		// Ray generation shader record.
+		RayGenerationShader ray_generation_shader;
+
+		// Not part of DXR: ray generation shader invoked once per tile instead, with the range of indices [FirstIndex, EndIndex) it covers, for tracing the tile's rays as packets. (See TraceRayPacket().)
+		// Takes the place of ray_generation_shader when set.
+		RayGenerationTileShader ray_generation_tile_shader;
+
+		// Not part of DXR: ray generation shader invoked only once for the whole dispatch, as the root task of a single job of the thread pool, which traces its rays in queues instead. (See TraceRayQueue().)
+		// Takes the place of both of the others when set.
+		RayGenerationWavefrontShader ray_generation_wavefront_shader;
+
+		// Hit group shader table, indexed the same way as on the GPU.
+		std::vector<HitGroup> hit_groups;
+
+		// Miss shader table, indexed by MissShaderIndex.
+		std::vector<MissShader> miss_shaders;
+
+		// Equivalent of D3D12_RAYTRACING_PIPELINE_CONFIG::MaxTraceRecursionDepth.
+		unsigned int max_trace_recursion_depth;
+
+		// Bounding box of the procedural geometry in the bottom-level acceleration structure, in Object-Space.
+		RaytracingAABB blas_aabb;
+
+		// Instance descriptions for the top-level acceleration structure.
+		const SceneInstanceDesc* ptr_instance_descs;
+		unsigned int instance_count;
+
+		// Not part of DXR: material of each instance, instance_count of them. (See GetInstanceMaterial().)
+		const SceneMaterial* ptr_materials;
+
+		// Equivalent of D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS::Flags for the top-level acceleration structure. (See BVH_BUILD_FLAG.)
+		// Include BVH_BUILD_FLAG_ALLOW_UPDATE to be able to refit it with UpdateInstances().
+		unsigned int acceleration_structure_build_flags;
+
+		// 2 to trace the top-level hierarchy as built, or 8 to collapse it into an 8-wide one. (See CPUBVHInitConfig::branching_factor.)
+		unsigned int acceleration_structure_branching_factor;
+
+		// Number of worker threads to dispatch with. Use 0 for one per hardware thread.
+		unsigned int thread_count;
+
+		// Size of the tiles DispatchRays() splits the image into, in pixels, and the order they get dealt out to the workers in. (See TILE_ORDER.)
+		unsigned int tile_width;
+		unsigned int tile_height;
+		unsigned int tile_order;
+
+		// Whether TraceRayQueue() runs the closest-hit shaders of each hit group together, and the miss shaders after them, as shader execution reordering would. Otherwise, they run in the order the rays got traced in.
+		bool sort_queued_hits;
+	};
+
+	// Emulates a raytracing pipeline state object, its shader tables and the scene it traces against.
+	class CPUDXRPipeline
+	{
+	public:
+		// Constructor.
+		CPUDXRPipeline();
+
+		// Populate this before calling the initializer function.
+		CPUDXRPipelineInitConfig InitConfig;
+
+		// Initializes the instance of this class.
+		void Initialize();
+
+		// Equivalent of rebuilding the top-level acceleration structure with BVH_BUILD_FLAG_PERFORM_UPDATE. pInstanceDescs holds all of the instances, in the same order as before.
+		// Only the instances listed in pChangedInstanceIndices are copied over and refitted, or all of them if it is nullptr. Returns true if the hierarchy got rebuilt instead of refitted. (See CPUBVH::Update().)
+		bool UpdateInstances(const SceneInstanceDesc* pInstanceDescs, const unsigned int* pChangedInstanceIndices, unsigned int ChangedInstanceCount);
+
+		// Invokes the ray generation shader once per (x, y) index, spread across every worker thread.
+		// The image is split into tiles, and each worker starts on its own stretch of them along the tile order, stealing tiles from the others once it runs out.
+		// A wavefront ray generation shader gets invoked once instead, and spreads its rays across the workers itself.
+		void DispatchRays(unsigned int Width, unsigned int Height);
+
+		// Traces a ray against the instances, invoking the intersection, any-hit, closest-hit and miss shaders. (See CPUDXR::TraceRay().)
+		void TraceRay
+		(
+			unsigned int RayFlags,
+			unsigned int InstanceInclusionMask,
+			unsigned int RayContributionToHitGroupIndex,
+			unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+			unsigned int MissShaderIndex,
+			const RayDesc& Ray,
+			RayPayload& Payload
+		) const;
+
+		// Traces a group of rays, as packets where possible. (See CPUDXR::TraceRayPacket().)
+		void TraceRayPacket
+		(
+			unsigned int RayFlags,
+			unsigned int InstanceInclusionMask,
+			unsigned int RayContributionToHitGroupIndex,
+			unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+			unsigned int MissShaderIndex,
+			const RayDesc* pRays,
+			const UInt2* pDispatchRaysIndices,
+			RayPayload* pPayloads,
+			unsigned int RayCount
+		) const;
+
+		// Traces a queue of rays, sorted, in batches. (See CPUDXR::TraceRayQueue().)
+		void TraceRayQueue
+		(
+			unsigned int RayFlags,
+			unsigned int RayContributionToHitGroupIndex,
+			unsigned int MultiplierForGeometryContributionToHitGroupIndex,
+			unsigned int MissShaderIndex,
+			QueuedRay* pRays,
+			RayPayload* pPayloads,
+			unsigned int RayCount,
+			unsigned int PathDepth
+		) const;
+
+		// Returns the statistics of the last DispatchRays() call.
+		const DispatchStatistics& GetStatistics();
+
+		// Returns the hierarchy built over the instances.
+		const CPUBVH& GetAccelerationStructure();
+
+		// Returns the World-Space spheres of the instances. (See GetWorldSphere().)
+		const WorldSphereArrays& GetWorldSpheres() const;
+
+		// Returns the worker threads, for running post-processing on them between dispatches.
+		CPUWorkStealingPool& GetThreadPool();
+
+		// Destructor.
+		~CPUDXRPipeline();
+
+	protected:
+		// Config data for this object.
+		CPUDXRPipelineConfig Config;
+
+		// Copies an instance description, and precomputes its World-to-Object transform, World-Space bounds and World-Space sphere.
+		void CopyInstance(unsigned int InstanceIndex, const SceneInstanceDesc& InstanceDesc);
+
+		// Copies the material of an instance into the arrays kept alongside the World-Space spheres.
+		void CopyMaterial(unsigned int InstanceIndex, const SceneMaterial& Material);
+
+		// Works out whether packets can be traced, after the instances or the hierarchy changed.
+		void UpdatePacketTraceable();
+
+		// Recomputes the bounds of every instance, after the instances changed.
+		void UpdateSceneBounds();
+
+		// Walks the hierarchy for the closest hit of a ray, invoking the intersection and any-hit shaders, and commits it to its state.
+		void FindClosestHit(RayState* pState, unsigned int InstanceInclusionMask) const;
+
+		// Traces rays of one packet, pLanes indexing them in pRays, pDispatchRaysIndices and pPayloads. Their directions have to share their signs. Returns false, having traced nothing, if the hierarchy can't be traversed with packets.
+		bool TracePacket(unsigned int RayFlags, unsigned int InstanceInclusionMask, unsigned int RayContributionToHitGroupIndex, unsigned int MultiplierForGeometryContributionToHitGroupIndex, unsigned int MissShaderIndex, const RayDesc* pRays, const UInt2* pDispatchRaysIndices, RayPayload* pPayloads, const unsigned int* pLanes, unsigned int LaneCount) const;
+
+		// Invokes the closest-hit shader of a ray's committed hit, or the miss shader if it has none, once its traversal is over.
+		void InvokeClosestHitOrMiss(RayState* pState, unsigned int MissShaderIndex) const;
+
+		// Lays out the tiles of an image of the given dimensions along the tile order, unless they already are.
+		void UpdateTileOrigins(unsigned int Width, unsigned int Height);
+
+		// Deals out the tiles of an image to the workers, each of them counting into its own statistics.
+		void DispatchTiles(unsigned int Width, unsigned int Height, std::vector<DispatchStatistics>* pWorkerStatistics);
+
+		// Runs the ray generation shader for the pixels of one tile, or the tile ray generation shader once for all of them.
+		void DispatchTile(unsigned int Width, unsigned int Height, UInt2 TileOrigin, DispatchStatistics* pStatistics) const;
+
+	};
+}
@@ -0,0 +1,654 @@
+// CPUDenoiser.cpp - Edge-avoiding à-trous wavelet denoiser, for filtering low-sample renders of the CPU backend.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include "CPUDenoiser.hpp"
+#include "CPUSphereKernels.hpp"
+#include "CPUDXR.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define DENOISER_SSE 1
+#include <immintrin.h>
+#else
+#define DENOISER_SSE 0
+#endif
+
+// GCC and Clang only emit AVX2 and AVX-512 instructions inside functions that are explicitly targeted at them.
+#if DENOISER_SSE && (defined(__GNUC__) || defined(__clang__))
+#define DENOISER_TARGET_AVX2 __attribute__((target("avx2")))
+#define DENOISER_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define DENOISER_TARGET_AVX2
+#define DENOISER_TARGET_AVX512
+#endif
+
+// Size of the tiles the passes get split into, in pixels. The width is a multiple of 16, so that every SIMD path runs whole vectors.
+const unsigned int DenoiserTileWidth{ 64 };
+const unsigned int DenoiserTileHeight{ 16 };
+
+// Number of taps of the 5x5 kernel.
+const unsigned int DenoiserTapCount{ 25 };
+
+// Albedos get clamped to at least this before dividing by them, so that black surfaces don't blow up their lighting.
+const float DenoiserMinAlbedo{ 0.001f };
+
+// Pixels closer than this (only ones that were never traced) get their depth differences measured against it.
+const float DenoiserMinDepth{ 0.000001f };
+
+// Smallest power of 2 FastExp() returns. Weights below it are as good as 0, and flooring them here keeps their products with the colors from going denormal, which is very slow.
+const float DenoiserMinExp2{ -64.0f };
+
+// Polynomial for 2^f over f in [-0.5, 0.5]: Taylor series of e^(f * ln 2), to the 4th order. (Relative error < 5e-5.)
+const float DenoiserExp2C1{ 0.693147181f };
+const float DenoiserExp2C2{ 0.240226507f };
+const float DenoiserExp2C3{ 0.0555041087f };
+const float DenoiserExp2C4{ 0.00961812911f };
+
+const float DenoiserLog2E{ 1.44269504f };
+
+// Everything one row of one à-trous pass needs: the planes to read and write, the taps, and the edge-stopping factors.
+struct AtrousPass
+{
+	const float* Color[3];
+	const float* Normal[3];
+	const float* Depth;
+	const float* Albedo[3];
+	float* Output[3];
+
+	// Offsets of the taps from the center pixel, in floats, and their B3-spline weights.
+	ptrdiff_t TapOffsets[DenoiserTapCount];
+	float TapWeights[DenoiserTapCount];
+
+	// Inverse squared sigmas of each guide. The depth one still gets divided by the center pixel's squared depth.
+	float ColorFactor;
+	float NormalFactor;
+	float DepthFactor;
+	float AlbedoFactor;
+};
+
+// Filters Count pixels of a row, starting at index First of the planes.
+typedef void (*AtrousRowKernel)(const AtrousPass& Pass, size_t First, unsigned int Count);
+
+// e^X for X <= 0, from the exponent bits and a polynomial for the fraction. (T is never positive, so truncating T - 0.5 rounds it.) Every SIMD path does the same operations in the same order.
+inline float FastExp(float X)
+{
+	float T = std::max(X * DenoiserLog2E, DenoiserMinExp2);
+	float Integer = (float)(int)(T - 0.5f);
+	float F = T - Integer;
+
+	float Polynomial = 1.0f + (F * (DenoiserExp2C1 + (F * (DenoiserExp2C2 + (F * (DenoiserExp2C3 + (F * DenoiserExp2C4)))))));
+
+	unsigned int Bits = (unsigned int)((int)Integer + 127) << 23;
+	float Scale{};
+	std::memcpy(&Scale, &Bits, sizeof(Scale));
+
+	return Polynomial * Scale;
+}
+
+void FilterAtrousRowScalar(const AtrousPass& Pass, size_t First, unsigned int Count)
+{
+	for (size_t i = First; i < First + Count; i++)
+	{
+		float DepthFactor = Pass.DepthFactor / std::max(Pass.Depth[i] * Pass.Depth[i], DenoiserMinDepth);
+
+		float WeightSum{ 0.0f };
+		float Sum[3]{ 0.0f, 0.0f, 0.0f };
+
+		for (unsigned int Tap = 0; Tap < DenoiserTapCount; Tap++)
+		{
+			size_t j = (size_t)((ptrdiff_t)i + Pass.TapOffsets[Tap]);
+
+			float ColorDistance{ 0.0f };
+			float NormalDistance{ 0.0f };
+			float AlbedoDistance{ 0.0f };
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				float ColorDelta = Pass.Color[Channel][j] - Pass.Color[Channel][i];
+				float NormalDelta = Pass.Normal[Channel][j] - Pass.Normal[Channel][i];
+				float AlbedoDelta = Pass.Albedo[Channel][j] - Pass.Albedo[Channel][i];
+
+				ColorDistance += ColorDelta * ColorDelta;
+				NormalDistance += NormalDelta * NormalDelta;
+				AlbedoDistance += AlbedoDelta * AlbedoDelta;
+			}
+
+			float DepthDelta = Pass.Depth[j] - Pass.Depth[i];
+
+			float Exponent = (ColorDistance * Pass.ColorFactor) + (NormalDistance * Pass.NormalFactor) + (DepthDelta * DepthDelta * DepthFactor) + (AlbedoDistance * Pass.AlbedoFactor);
+			float Weight = Pass.TapWeights[Tap] * FastExp(-Exponent);
+
+			WeightSum += Weight;
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				Sum[Channel] += Weight * Pass.Color[Channel][j];
+			}
+		}
+
+		// The center tap always has a weight of at least 9/64, so this never divides by 0.
+		for (unsigned int Channel = 0; Channel < 3; Channel++)
+		{
+			Pass.Output[Channel][i] = Sum[Channel] / WeightSum;
+		}
+	}
+}
+
+#if DENOISER_SSE
+
+// 4-wide FastExp().
+inline __m128 FastExpSSE(__m128 X)
+{
+	__m128 T = _mm_max_ps(_mm_mul_ps(X, _mm_set1_ps(DenoiserLog2E)), _mm_set1_ps(DenoiserMinExp2));
+	__m128i Integer = _mm_cvttps_epi32(_mm_sub_ps(T, _mm_set1_ps(0.5f)));
+	__m128 F = _mm_sub_ps(T, _mm_cvtepi32_ps(Integer));
+
+	__m128 Polynomial = _mm_add_ps(_mm_set1_ps(DenoiserExp2C3), _mm_mul_ps(F, _mm_set1_ps(DenoiserExp2C4)));
+	Polynomial = _mm_add_ps(_mm_set1_ps(DenoiserExp2C2), _mm_mul_ps(F, Polynomial));
+	Polynomial = _mm_add_ps(_mm_set1_ps(DenoiserExp2C1), _mm_mul_ps(F, Polynomial));
+	Polynomial = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(F, Polynomial));
+
+	__m128 Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(Integer, _mm_set1_epi32(127)), 23));
+
+	return _mm_mul_ps(Polynomial, Scale);
+}
+
+void FilterAtrousRowSSE(const AtrousPass& Pass, size_t First, unsigned int Count)
+{
+	for (size_t i = First; i < First + Count; i += 4)
+	{
+		__m128 Color[3]{ _mm_loadu_ps(Pass.Color[0] + i), _mm_loadu_ps(Pass.Color[1] + i), _mm_loadu_ps(Pass.Color[2] + i) };
+		__m128 Normal[3]{ _mm_loadu_ps(Pass.Normal[0] + i), _mm_loadu_ps(Pass.Normal[1] + i), _mm_loadu_ps(Pass.Normal[2] + i) };
+		__m128 Albedo[3]{ _mm_loadu_ps(Pass.Albedo[0] + i), _mm_loadu_ps(Pass.Albedo[1] + i), _mm_loadu_ps(Pass.Albedo[2] + i) };
+		__m128 Depth = _mm_loadu_ps(Pass.Depth + i);
+
+		__m128 DepthFactor = _mm_div_ps(_mm_set1_ps(Pass.DepthFactor), _mm_max_ps(_mm_mul_ps(Depth, Depth), _mm_set1_ps(DenoiserMinDepth)));
+
+		__m128 WeightSum = _mm_setzero_ps();
+		__m128 Sum[3]{ _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+
+		for (unsigned int Tap = 0; Tap < DenoiserTapCount; Tap++)
+		{
+			size_t j = (size_t)((ptrdiff_t)i + Pass.TapOffsets[Tap]);
+
+			__m128 TapColor[3]{ _mm_loadu_ps(Pass.Color[0] + j), _mm_loadu_ps(Pass.Color[1] + j), _mm_loadu_ps(Pass.Color[2] + j) };
+
+			__m128 ColorDistance = _mm_setzero_ps();
+			__m128 NormalDistance = _mm_setzero_ps();
+			__m128 AlbedoDistance = _mm_setzero_ps();
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				__m128 ColorDelta = _mm_sub_ps(TapColor[Channel], Color[Channel]);
+				__m128 NormalDelta = _mm_sub_ps(_mm_loadu_ps(Pass.Normal[Channel] + j), Normal[Channel]);
+				__m128 AlbedoDelta = _mm_sub_ps(_mm_loadu_ps(Pass.Albedo[Channel] + j), Albedo[Channel]);
+
+				ColorDistance = _mm_add_ps(ColorDistance, _mm_mul_ps(ColorDelta, ColorDelta));
+				NormalDistance = _mm_add_ps(NormalDistance, _mm_mul_ps(NormalDelta, NormalDelta));
+				AlbedoDistance = _mm_add_ps(AlbedoDistance, _mm_mul_ps(AlbedoDelta, AlbedoDelta));
+			}
+
+			__m128 DepthDelta = _mm_sub_ps(_mm_loadu_ps(Pass.Depth + j), Depth);
+
+			__m128 Exponent = _mm_mul_ps(ColorDistance, _mm_set1_ps(Pass.ColorFactor));
+			Exponent = _mm_add_ps(Exponent, _mm_mul_ps(NormalDistance, _mm_set1_ps(Pass.NormalFactor)));
+			Exponent = _mm_add_ps(Exponent, _mm_mul_ps(_mm_mul_ps(DepthDelta, DepthDelta), DepthFactor));
+			Exponent = _mm_add_ps(Exponent, _mm_mul_ps(AlbedoDistance, _mm_set1_ps(Pass.AlbedoFactor)));
+
+			__m128 Weight = _mm_mul_ps(_mm_set1_ps(Pass.TapWeights[Tap]), FastExpSSE(_mm_sub_ps(_mm_setzero_ps(), Exponent)));
+
+			WeightSum = _mm_add_ps(WeightSum, Weight);
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				Sum[Channel] = _mm_add_ps(Sum[Channel], _mm_mul_ps(Weight, TapColor[Channel]));
+			}
+		}
+
+		for (unsigned int Channel = 0; Channel < 3; Channel++)
+		{
+			_mm_storeu_ps(Pass.Output[Channel] + i, _mm_div_ps(Sum[Channel], WeightSum));
+		}
+	}
+}
+
+// 8-wide FastExp().
+DENOISER_TARGET_AVX2 inline __m256 FastExpAVX2(__m256 X)
+{
+	__m256 T = _mm256_max_ps(_mm256_mul_ps(X, _mm256_set1_ps(DenoiserLog2E)), _mm256_set1_ps(DenoiserMinExp2));
+	__m256i Integer = _mm256_cvttps_epi32(_mm256_sub_ps(T, _mm256_set1_ps(0.5f)));
+	__m256 F = _mm256_sub_ps(T, _mm256_cvtepi32_ps(Integer));
+
+	__m256 Polynomial = _mm256_add_ps(_mm256_set1_ps(DenoiserExp2C3), _mm256_mul_ps(F, _mm256_set1_ps(DenoiserExp2C4)));
+	Polynomial = _mm256_add_ps(_mm256_set1_ps(DenoiserExp2C2), _mm256_mul_ps(F, Polynomial));
+	Polynomial = _mm256_add_ps(_mm256_set1_ps(DenoiserExp2C1), _mm256_mul_ps(F, Polynomial));
+	Polynomial = _mm256_add_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(F, Polynomial));
+
+	__m256 Scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(Integer, _mm256_set1_epi32(127)), 23));
+
+	return _mm256_mul_ps(Polynomial, Scale);
+}
+
+DENOISER_TARGET_AVX2 void FilterAtrousRowAVX2(const AtrousPass& Pass, size_t First, unsigned int Count)
+{
+	for (size_t i = First; i < First + Count; i += 8)
+	{
+		__m256 Color[3]{ _mm256_loadu_ps(Pass.Color[0] + i), _mm256_loadu_ps(Pass.Color[1] + i), _mm256_loadu_ps(Pass.Color[2] + i) };
+		__m256 Normal[3]{ _mm256_loadu_ps(Pass.Normal[0] + i), _mm256_loadu_ps(Pass.Normal[1] + i), _mm256_loadu_ps(Pass.Normal[2] + i) };
+		__m256 Albedo[3]{ _mm256_loadu_ps(Pass.Albedo[0] + i), _mm256_loadu_ps(Pass.Albedo[1] + i), _mm256_loadu_ps(Pass.Albedo[2] + i) };
+		__m256 Depth = _mm256_loadu_ps(Pass.Depth + i);
+
+		__m256 DepthFactor = _mm256_div_ps(_mm256_set1_ps(Pass.DepthFactor), _mm256_max_ps(_mm256_mul_ps(Depth, Depth), _mm256_set1_ps(DenoiserMinDepth)));
+
+		__m256 WeightSum = _mm256_setzero_ps();
+		__m256 Sum[3]{ _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+		for (unsigned int Tap = 0; Tap < DenoiserTapCount; Tap++)
+		{
+			size_t j = (size_t)((ptrdiff_t)i + Pass.TapOffsets[Tap]);
+
+			__m256 TapColor[3]{ _mm256_loadu_ps(Pass.Color[0] + j), _mm256_loadu_ps(Pass.Color[1] + j), _mm256_loadu_ps(Pass.Color[2] + j) };
+
+			__m256 ColorDistance = _mm256_setzero_ps();
+			__m256 NormalDistance = _mm256_setzero_ps();
+			__m256 AlbedoDistance = _mm256_setzero_ps();
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				__m256 ColorDelta = _mm256_sub_ps(TapColor[Channel], Color[Channel]);
+				__m256 NormalDelta = _mm256_sub_ps(_mm256_loadu_ps(Pass.Normal[Channel] + j), Normal[Channel]);
+				__m256 AlbedoDelta = _mm256_sub_ps(_mm256_loadu_ps(Pass.Albedo[Channel] + j), Albedo[Channel]);
+
+				ColorDistance = _mm256_add_ps(ColorDistance, _mm256_mul_ps(ColorDelta, ColorDelta));
+				NormalDistance = _mm256_add_ps(NormalDistance, _mm256_mul_ps(NormalDelta, NormalDelta));
+				AlbedoDistance = _mm256_add_ps(AlbedoDistance, _mm256_mul_ps(AlbedoDelta, AlbedoDelta));
+			}
+
+			__m256 DepthDelta = _mm256_sub_ps(_mm256_loadu_ps(Pass.Depth + j), Depth);
+
+			__m256 Exponent = _mm256_mul_ps(ColorDistance, _mm256_set1_ps(Pass.ColorFactor));
+			Exponent = _mm256_add_ps(Exponent, _mm256_mul_ps(NormalDistance, _mm256_set1_ps(Pass.NormalFactor)));
+			Exponent = _mm256_add_ps(Exponent, _mm256_mul_ps(_mm256_mul_ps(DepthDelta, DepthDelta), DepthFactor));
+			Exponent = _mm256_add_ps(Exponent, _mm256_mul_ps(AlbedoDistance, _mm256_set1_ps(Pass.AlbedoFactor)));
+
+			__m256 Weight = _mm256_mul_ps(_mm256_set1_ps(Pass.TapWeights[Tap]), FastExpAVX2(_mm256_sub_ps(_mm256_setzero_ps(), Exponent)));
+
+			WeightSum = _mm256_add_ps(WeightSum, Weight);
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				Sum[Channel] = _mm256_add_ps(Sum[Channel], _mm256_mul_ps(Weight, TapColor[Channel]));
+			}
+		}
+
+		for (unsigned int Channel = 0; Channel < 3; Channel++)
+		{
+			_mm256_storeu_ps(Pass.Output[Channel] + i, _mm256_div_ps(Sum[Channel], WeightSum));
+		}
+	}
+}
+
+// 16-wide FastExp(). Truncates with a round and scales with scalef instead of going through the integer bits, which gives the same results, and evaluates the polynomial with FMAs, which round differently in the last bit. (Uses the zero-masked forms with every lane set, since GCC warns about the undefined source operand of the plain ones.)
+DENOISER_TARGET_AVX512 inline __m512 FastExpAVX512(__m512 X)
+{
+	__m512 T = _mm512_maskz_max_ps(0xFFFF, _mm512_mul_ps(X, _mm512_set1_ps(DenoiserLog2E)), _mm512_set1_ps(DenoiserMinExp2));
+	__m512 Integer = _mm512_maskz_roundscale_ps(0xFFFF, _mm512_sub_ps(T, _mm512_set1_ps(0.5f)), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+	__m512 F = _mm512_sub_ps(T, Integer);
+
+	__m512 Polynomial = _mm512_fmadd_ps(F, _mm512_set1_ps(DenoiserExp2C4), _mm512_set1_ps(DenoiserExp2C3));
+	Polynomial = _mm512_fmadd_ps(F, Polynomial, _mm512_set1_ps(DenoiserExp2C2));
+	Polynomial = _mm512_fmadd_ps(F, Polynomial, _mm512_set1_ps(DenoiserExp2C1));
+	Polynomial = _mm512_fmadd_ps(F, Polynomial, _mm512_set1_ps(1.0f));
+
+	return _mm512_maskz_scalef_ps(0xFFFF, Polynomial, Integer);
+}
+
+// Same as the AVX2 kernel, with the multiply-adds fused, since every AVX-512 CPU has FMA.
+DENOISER_TARGET_AVX512 void FilterAtrousRowAVX512(const AtrousPass& Pass, size_t First, unsigned int Count)
+{
+	for (size_t i = First; i < First + Count; i += 16)
+	{
+		__m512 Color[3]{ _mm512_loadu_ps(Pass.Color[0] + i), _mm512_loadu_ps(Pass.Color[1] + i), _mm512_loadu_ps(Pass.Color[2] + i) };
+		__m512 Normal[3]{ _mm512_loadu_ps(Pass.Normal[0] + i), _mm512_loadu_ps(Pass.Normal[1] + i), _mm512_loadu_ps(Pass.Normal[2] + i) };
+		__m512 Albedo[3]{ _mm512_loadu_ps(Pass.Albedo[0] + i), _mm512_loadu_ps(Pass.Albedo[1] + i), _mm512_loadu_ps(Pass.Albedo[2] + i) };
+		__m512 Depth = _mm512_loadu_ps(Pass.Depth + i);
+
+		__m512 DepthFactor = _mm512_div_ps(_mm512_set1_ps(Pass.DepthFactor), _mm512_maskz_max_ps(0xFFFF, _mm512_mul_ps(Depth, Depth), _mm512_set1_ps(DenoiserMinDepth)));
+
+		__m512 WeightSum = _mm512_setzero_ps();
+		__m512 Sum[3]{ _mm512_setzero_ps(), _mm512_setzero_ps(), _mm512_setzero_ps() };
+
+		for (unsigned int Tap = 0; Tap < DenoiserTapCount; Tap++)
+		{
+			size_t j = (size_t)((ptrdiff_t)i + Pass.TapOffsets[Tap]);
+
+			__m512 TapColor[3]{ _mm512_loadu_ps(Pass.Color[0] + j), _mm512_loadu_ps(Pass.Color[1] + j), _mm512_loadu_ps(Pass.Color[2] + j) };
+
+			__m512 ColorDistance = _mm512_setzero_ps();
+			__m512 NormalDistance = _mm512_setzero_ps();
+			__m512 AlbedoDistance = _mm512_setzero_ps();
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				__m512 ColorDelta = _mm512_sub_ps(TapColor[Channel], Color[Channel]);
+				__m512 NormalDelta = _mm512_sub_ps(_mm512_loadu_ps(Pass.Normal[Channel] + j), Normal[Channel]);
+				__m512 AlbedoDelta = _mm512_sub_ps(_mm512_loadu_ps(Pass.Albedo[Channel] + j), Albedo[Channel]);
+
+				ColorDistance = _mm512_fmadd_ps(ColorDelta, ColorDelta, ColorDistance);
+				NormalDistance = _mm512_fmadd_ps(NormalDelta, NormalDelta, NormalDistance);
+				AlbedoDistance = _mm512_fmadd_ps(AlbedoDelta, AlbedoDelta, AlbedoDistance);
+			}
+
+			__m512 DepthDelta = _mm512_sub_ps(_mm512_loadu_ps(Pass.Depth + j), Depth);
+
+			__m512 Exponent = _mm512_mul_ps(ColorDistance, _mm512_set1_ps(Pass.ColorFactor));
+			Exponent = _mm512_fmadd_ps(NormalDistance, _mm512_set1_ps(Pass.NormalFactor), Exponent);
+			Exponent = _mm512_fmadd_ps(_mm512_mul_ps(DepthDelta, DepthDelta), DepthFactor, Exponent);
+			Exponent = _mm512_fmadd_ps(AlbedoDistance, _mm512_set1_ps(Pass.AlbedoFactor), Exponent);
+
+			__m512 Weight = _mm512_mul_ps(_mm512_set1_ps(Pass.TapWeights[Tap]), FastExpAVX512(_mm512_sub_ps(_mm512_setzero_ps(), Exponent)));
+
+			WeightSum = _mm512_add_ps(WeightSum, Weight);
+
+			for (unsigned int Channel = 0; Channel < 3; Channel++)
+			{
+				Sum[Channel] = _mm512_fmadd_ps(Weight, TapColor[Channel], Sum[Channel]);
+			}
+		}
+
+		for (unsigned int Channel = 0; Channel < 3; Channel++)
+		{
+			_mm512_storeu_ps(Pass.Output[Channel] + i, _mm512_div_ps(Sum[Channel], WeightSum));
+		}
+	}
+}
+
+#endif
+
+// Picks the row kernel for the sphere kernels' instruction set.
+static AtrousRowKernel SelectAtrousRowKernel()
+{
+#if DENOISER_SSE
+	switch (GetSphereKernelISA())
+	{
+	case (SPHERE_KERNEL_ISA_AVX512):
+	{
+		return FilterAtrousRowAVX512;
+	}
+	case (SPHERE_KERNEL_ISA_AVX2):
+	{
+		return FilterAtrousRowAVX2;
+	}
+	case (SPHERE_KERNEL_ISA_SSE):
+	{
+		return FilterAtrousRowSSE;
+	}
+	default:
+	{
+		break;
+	}
+	}
+#endif
+
+	return FilterAtrousRowScalar;
+}
+
+
+
+
+
+CPUDenoiser::CPUDenoiser
+() :
+	InitConfig{},
+	Config{}
+{
+	this->Config.border = 0;
+	this->Config.stride = 0;
+	this->Config.denoise_seconds = 0.0;
+	this->Config.name = "CPUDenoiser";
+	this->Config.error_message = "CPUDenoiser.Initialize() failed.";
+
+	this->InitConfig.pixel_width = 0;
+	this->InitConfig.pixel_height = 0;
+	this->InitConfig.iteration_count = 3;
+	this->InitConfig.color_sigma = 0.25f;
+	this->InitConfig.normal_sigma = 0.5f;
+	this->InitConfig.depth_sigma = 0.02f;
+	this->InitConfig.albedo_sigma = 0.1f;
+	this->InitConfig.ptr_thread_pool = nullptr;
+}
+
+void CPUDenoiser::Initialize
+()
+{
+	CPUDXR::FailCheck
+	(
+		(this->InitConfig.pixel_width > 0) && (this->InitConfig.pixel_height > 0) && (this->InitConfig.iteration_count > 0) && (this->InitConfig.iteration_count <= 10),
+		this->Config.error_message,
+		this->Config.name
+	);
+
+	// The last pass reaches 2 * 2^(iteration_count - 1) pixels out, and the rows get rounded up to whole tiles, whose extra pixels land in the border.
+	unsigned int PaddedWidth = ((this->InitConfig.pixel_width + DenoiserTileWidth - 1) / DenoiserTileWidth) * DenoiserTileWidth;
+
+	this->Config.border = 1U << this->InitConfig.iteration_count;
+	this->Config.stride = PaddedWidth + (2 * this->Config.border);
+
+	size_t PlaneSize = (size_t)this->Config.stride * (this->InitConfig.pixel_height + (2 * this->Config.border));
+
+	for (unsigned int Channel = 0; Channel < 3; Channel++)
+	{
+		this->Config.color_planes[0][Channel].assign(PlaneSize, 0.0f);
+		this->Config.color_planes[1][Channel].assign(PlaneSize, 0.0f);
+		this->Config.normal_planes[Channel].assign(PlaneSize, 0.0f);
+		this->Config.albedo_planes[Channel].assign(PlaneSize, 0.0f);
+	}
+
+	this->Config.depth_plane.assign(PlaneSize, 0.0f);
+}
+
+void CPUDenoiser::Denoise
+(
+	const float* pColorSums,
+	const float* pGuideSums,
+	const float* pAlbedoSums,
+	unsigned char* pRenderTarget
+)
+{
+	auto StartTime = std::chrono::steady_clock::now();
+
+	unsigned int Width = this->InitConfig.pixel_width;
+	unsigned int Height = this->InitConfig.pixel_height;
+	unsigned int Border = this->Config.border;
+	size_t Stride = this->Config.stride;
+
+	unsigned int RowBandCount = (Height + DenoiserTileHeight - 1) / DenoiserTileHeight;
+
+	// Average the sums over each pixel's samples, and divide the albedo out of the color.
+	this->ForEachTile(RowBandCount, [&](unsigned int Begin, unsigned int End)
+	{
+		for (unsigned int y = Begin * DenoiserTileHeight; y < std::min(End * DenoiserTileHeight, Height); y++)
+		{
+			for (unsigned int x = 0; x < Width; x++)
+			{
+				const float* pColor = &(pColorSums[((size_t)y * Width + x) * 4]);
+				const float* pGuide = &(pGuideSums[((size_t)y * Width + x) * 4]);
+				const float* pAlbedo = &(pAlbedoSums[((size_t)y * Width + x) * 4]);
+
+				float InverseSampleCount = 1.0f / std::max(pAlbedo[3], 1.0f);
+
+				size_t i = (y + Border) * Stride + x + Border;
+
+				for (unsigned int Channel = 0; Channel < 3; Channel++)
+				{
+					float Albedo = pAlbedo[Channel] * InverseSampleCount;
+
+					this->Config.color_planes[0][Channel][i] = (pColor[Channel] * InverseSampleCount) / std::max(Albedo, DenoiserMinAlbedo);
+					this->Config.normal_planes[Channel][i] = pGuide[Channel] * InverseSampleCount;
+					this->Config.albedo_planes[Channel][i] = Albedo;
+				}
+
+				this->Config.depth_plane[i] = pGuide[3] * InverseSampleCount;
+			}
+		}
+	});
+
+	for (unsigned int Channel = 0; Channel < 3; Channel++)
+	{
+		this->FillBorder(this->Config.color_planes[0][Channel].data());
+		this->FillBorder(this->Config.normal_planes[Channel].data());
+		this->FillBorder(this->Config.albedo_planes[Channel].data());
+	}
+
+	this->FillBorder(this->Config.depth_plane.data());
+
+	// Run the passes, each one reading the output of the last.
+	AtrousRowKernel FilterRow = SelectAtrousRowKernel();
+
+	const float KernelWeights[5]{ 1.0f / 16.0f, 1.0f / 4.0f, 3.0f / 8.0f, 1.0f / 4.0f, 1.0f / 16.0f };
+
+	unsigned int TileColumnCount = (Width + DenoiserTileWidth - 1) / DenoiserTileWidth;
+
+	for (unsigned int Iteration = 0; Iteration < this->InitConfig.iteration_count; Iteration++)
+	{
+		unsigned int Source = Iteration % 2;
+		unsigned int Step = 1U << Iteration;
+
+		AtrousPass Pass{};
+
+		for (unsigned int Channel = 0; Channel < 3; Channel++)
+		{
+			Pass.Color[Channel] = this->Config.color_planes[Source][Channel].data();
+			Pass.Normal[Channel] = this->Config.normal_planes[Channel].data();
+			Pass.Albedo[Channel] = this->Config.albedo_planes[Channel].data();
+			Pass.Output[Channel] = this->Config.color_planes[1 - Source][Channel].data();
+		}
+
+		Pass.Depth = this->Config.depth_plane.data();
+
+		for (unsigned int Tap = 0; Tap < DenoiserTapCount; Tap++)
+		{
+			ptrdiff_t dx = ((ptrdiff_t)(Tap % 5) - 2) * Step;
+			ptrdiff_t dy = ((ptrdiff_t)(Tap / 5) - 2) * Step;
+
+			Pass.TapOffsets[Tap] = (dy * (ptrdiff_t)Stride) + dx;
+			Pass.TapWeights[Tap] = KernelWeights[Tap % 5] * KernelWeights[Tap / 5];
+		}
+
+		// Each pass smooths out some of the noise, so the color differences that count as edges shrink along with it.
+		float ColorSigma = this->InitConfig.color_sigma / (float)Step;
+		float DepthSigma = this->InitConfig.depth_sigma * (float)Step;
+
+		Pass.ColorFactor = 1.0f / (ColorSigma * ColorSigma);
+		Pass.NormalFactor = 1.0f / (this->InitConfig.normal_sigma * this->InitConfig.normal_sigma);
+		Pass.DepthFactor = 1.0f / (DepthSigma * DepthSigma);
+		Pass.AlbedoFactor = 1.0f / (this->InitConfig.albedo_sigma * this->InitConfig.albedo_sigma);
+
+		this->ForEachTile(TileColumnCount * RowBandCount, [&](unsigned int Begin, unsigned int End)
+		{
+			for (unsigned int Tile = Begin; Tile < End; Tile++)
+			{
+				unsigned int x = (Tile % TileColumnCount) * DenoiserTileWidth;
+				unsigned int FirstRow = (Tile / TileColumnCount) * DenoiserTileHeight;
+
+				for (unsigned int y = FirstRow; y < std::min(FirstRow + DenoiserTileHeight, Height); y++)
+				{
+					FilterRow(Pass, (y + Border) * Stride + x + Border, DenoiserTileWidth);
+				}
+			}
+		});
+
+		for (unsigned int Channel = 0; Channel < 3; Channel++)
+		{
+			this->FillBorder(Pass.Output[Channel]);
+		}
+	}
+
+	// Multiply the albedo back in, and convert to UNORM the same way StoreRenderTarget() does.
+	unsigned int Result = this->InitConfig.iteration_count % 2;
+
+	this->ForEachTile(RowBandCount, [&](unsigned int Begin, unsigned int End)
+	{
+		for (unsigned int y = Begin * DenoiserTileHeight; y < std::min(End * DenoiserTileHeight, Height); y++)
+		{
+			for (unsigned int x = 0; x < Width; x++)
+			{
+				size_t i = (y + Border) * Stride + x + Border;
+
+				unsigned char* pPixel = &(pRenderTarget[((size_t)y * Width + x) * 4]);
+
+				for (unsigned int Channel = 0; Channel < 3; Channel++)
+				{
+					float Color = this->Config.color_planes[Result][Channel][i] * std::max(this->Config.albedo_planes[Channel][i], DenoiserMinAlbedo);
+					float Saturated = Color < 0.0f ? 0.0f : (Color > 1.0f ? 1.0f : Color);
+
+					pPixel[Channel] = (unsigned char)(Saturated * 255.0f + 0.5f);
+				}
+
+				pPixel[3] = 0;
+			}
+		}
+	});
+
+	this->Config.denoise_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+}
+
+double CPUDenoiser::GetDenoiseSeconds
+() const
+{
+	return this->Config.denoise_seconds;
+}
+
+void CPUDenoiser::ForEachTile
+(
+	unsigned int Count,
+	const std::function<void(unsigned int Begin, unsigned int End)>& Function
+)
+{
+	if (this->InitConfig.ptr_thread_pool != nullptr)
+	{
+		this->InitConfig.ptr_thread_pool->ParallelFor(Count, 1, Function);
+	}
+	else
+	{
+		Function(0, Count);
+	}
+}
+
+void CPUDenoiser::FillBorder
+(
+	float* pPlane
+)
+{
+	unsigned int Width = this->InitConfig.pixel_width;
+	unsigned int Height = this->InitConfig.pixel_height;
+	unsigned int Border = this->Config.border;
+	size_t Stride = this->Config.stride;
+
+	// Extend each row to the left and the right, then copy the finished first and last rows up and down.
+	for (unsigned int y = Border; y < Height + Border; y++)
+	{
+		float* pRow = &(pPlane[y * Stride]);
+
+		std::fill(pRow, pRow + Border, pRow[Border]);
+		std::fill(pRow + Border + Width, pRow + Stride, pRow[Border + Width - 1]);
+	}
+
+	for (unsigned int y = 0; y < Border; y++)
+	{
+		std::memcpy(&(pPlane[y * Stride]), &(pPlane[Border * Stride]), Stride * sizeof(float));
+		std::memcpy(&(pPlane[(Height + Border + y) * Stride]), &(pPlane[(Height + Border - 1) * Stride]), Stride * sizeof(float));
+	}
+}
+
+CPUDenoiser::~CPUDenoiser
+()
+{
+	// Nothing here, for now.
+}
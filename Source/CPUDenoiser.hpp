@@ -0,0 +1,97 @@
+// CPUDenoiser.hpp - Edge-avoiding à-trous wavelet denoiser, for filtering low-sample renders of the CPU backend.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "CPUWorkStealingPool.hpp"
+
+// Config data for this class.
+struct CPUDenoiserConfig
+{
+	// Each image plane gets a border of this many pixels on every side, filled with copies of the edge pixels, so that the filter taps never need bounds checks.
+	unsigned int border;
+
+	// Distance, in floats, between two rows of a plane, border included.
+	unsigned int stride;
+
+	// Planes of the demodulated color (color divided by albedo), ping-ponged between the filter passes.
+	std::vector<float> color_planes[2][3];
+
+	// Planes of the guides: first-hit normal, depth and albedo, averaged over each pixel's samples.
+	std::vector<float> normal_planes[3];
+	std::vector<float> depth_plane;
+	std::vector<float> albedo_planes[3];
+
+	// Time the last Denoise() call took.
+	double denoise_seconds;
+
+	// Label for this class.
+	const char* name;
+
+	// Error message for initialization.
+	const char* error_message;
+};
+
+// Populate this before calling the initializer function.
+struct CPUDenoiserInitConfig
+{
+	// Desired number of pixels along each dimension.
+	unsigned int pixel_width;
+	unsigned int pixel_height;
+
+	// Number of à-trous passes. Pass i spaces its 5x5 taps 2^i pixels apart, so 3 passes cover 29x29 pixels, and 5 of them 125x125.
+	unsigned int iteration_count;
+
+	// Edge-stopping widths of each guide: a tap's weight drops by e once it differs from the center pixel by this much.
+	// The color one halves with each pass, as the noise it has to see past smooths out, and the depth one (relative to the center's depth) grows with the tap spacing.
+	float color_sigma;
+	float normal_sigma;
+	float depth_sigma;
+	float albedo_sigma;
+
+	// Pool to filter tiles of the image in parallel on. Filters on the calling thread alone if nullptr.
+	CPUWorkStealingPool* ptr_thread_pool;
+};
+
+// Filters a noisy image with the edge-avoiding à-trous wavelet transform (Dammertz et al., "Edge-Avoiding À-Trous Wavelet Transform for Fast Global Illumination Filtering").
+// The color gets divided by the first-hit albedo before filtering, and multiplied back after, so that the filter only has to smooth out the lighting.
+// Every plane is stored separately (SoA), so that 4 or 8 neighboring pixels load their taps with one instruction; the SIMD paths follow the sphere kernels' instruction set. (See SetSphereKernelISA().)
+class CPUDenoiser
+{
+public:
+	// Constructor.
+	CPUDenoiser();
+
+	// Populate this before calling the initializer function.
+	CPUDenoiserInitConfig InitConfig;
+
+	// Initializes the instance of this class.
+	// Allocates the planes.
+	void Initialize();
+
+	// Filters an image into an R8G8B8A8_UNORM render target. Each buffer holds per-pixel sums over the pixel's samples, in R32G32B32A32_FLOAT format:
+	// pColorSums has the colors (xyz), pGuideSums the first-hit normals (xyz) and depths (w), and pAlbedoSums the first-hit albedos (xyz) and the number of samples (w).
+	void Denoise(const float* pColorSums, const float* pGuideSums, const float* pAlbedoSums, unsigned char* pRenderTarget);
+
+	// Returns the time the last Denoise() call took.
+	double GetDenoiseSeconds() const;
+
+	// Destructor.
+	~CPUDenoiser();
+
+protected:
+	// Config data for this object.
+	CPUDenoiserConfig Config;
+
+	// Runs Function(Begin, End) over the tiles [0, Count), on the pool if there is one.
+	void ForEachTile(unsigned int Count, const std::function<void(unsigned int Begin, unsigned int End)>& Function);
+
+	// Fills the border of a plane with copies of its edge pixels.
+	void FillBorder(float* pPlane);
+
+};
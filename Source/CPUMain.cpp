@@ -0,0 +1,595 @@
+// CPUMain.cpp - Main source file for Spheres (CPU), the headless counterpart of Main.cpp.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "SceneDescription.hpp"
+#include "ProgressiveAccumulator.hpp"
+#include "CPURaytracer.hpp"
+#include "CPUSphereKernels.hpp"
+#include "CPUBenchmarks.hpp"
+
+// Writes an R8G8B8A8 image out as a binary PPM, dropping the alpha channel.
+inline bool WritePPM
+(
+	const char* pFileName,
+	const unsigned char* pRGBAData,
+	unsigned int PixelWidth,
+	unsigned int PixelHeight
+)
+{
+	FILE* pFile = fopen(pFileName, "wb");
+
+	if (pFile == nullptr)
+	{
+		return false;
+	}
+
+	fprintf(pFile, "P6\n%u %u\n255\n", PixelWidth, PixelHeight);
+
+	for (unsigned int i = 0; i < PixelWidth * PixelHeight; i++)
+	{
+		fwrite(&(pRGBAData[i * 4]), 1, 3, pFile);
+	}
+
+	fclose(pFile);
+
+	return true;
+}
+
+int main
+(
+	int argc,
+	char** argv
+)
+{
+	// Some general application values/parameters, overridable from the command line.
+	unsigned int PixelWidth{ 3840U };
+	unsigned int PixelHeight{ 2160U };
+	unsigned int RaysPerPixel{ 500U };
+	unsigned int SamplesPerPass{ 0U };
+	float AdaptiveThreshold{ 0.0f };
+	unsigned int ThreadCount{ 0U };
+	unsigned int TileSize{ 16U };
+	unsigned int TileOrder{ CPUDXR::TILE_ORDER_HILBERT };
+	bool PrintThreadStatistics{ false };
+	const char* pOutputFileName{ nullptr };
+	const char* pBenchmarkName{ nullptr };
+	unsigned int ScatteredSphereCount{ 0U };
+	unsigned int BuildFlags{ BVH_BUILD_FLAG_PREFER_FAST_TRACE };
+	unsigned int BranchingFactor{ BVH8Width };
+	bool MinimizeMemory{ false };
+	unsigned int FrameCount{ 1U };
+	unsigned int MovingSphereCount{ ~0U };
+	unsigned int RandomSeed{ 0U };
+	unsigned int SamplerType{ SamplerTypeSobol };
+	unsigned int RouletteMinDepth{ ~0U };
+	unsigned int DenoiserIterationCount{ 0U };
+	unsigned int PrimaryHitStrata{ 0U };
+	bool PacketTracing{ false };
+	unsigned int WavefrontSize{ 0U };
+	bool SortQueuedHits{ true };
+	float MetallicFraction{ 0.0f };
+	float DielectricFraction{ 0.0f };
+	float EmissiveFraction{ 0.0f };
+	float OrbitDegrees{ 0.0f };
+	float TemporalMinBlendFactor{ 0.0f };
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (strcmp(argv[i], "--width") == 0)
+		{
+			PixelWidth = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--height") == 0)
+		{
+			PixelHeight = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--spp") == 0)
+		{
+			RaysPerPixel = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--pass-spp") == 0)
+		{
+			SamplesPerPass = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--adaptive") == 0)
+		{
+			AdaptiveThreshold = (float)atof(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--threads") == 0)
+		{
+			ThreadCount = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--tile-size") == 0)
+		{
+			TileSize = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--tile-order") == 0)
+		{
+			TileOrder = strcmp(argv[i + 1], "rows") == 0 ? CPUDXR::TILE_ORDER_ROW_MAJOR : (strcmp(argv[i + 1], "morton") == 0 ? CPUDXR::TILE_ORDER_MORTON : CPUDXR::TILE_ORDER_HILBERT);
+		}
+		else if (strcmp(argv[i], "--thread-stats") == 0)
+		{
+			PrintThreadStatistics = atoi(argv[i + 1]) != 0;
+		}
+		else if (strcmp(argv[i], "--output") == 0)
+		{
+			pOutputFileName = argv[i + 1];
+		}
+		else if (strcmp(argv[i], "--spheres") == 0)
+		{
+			ScatteredSphereCount = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--build") == 0)
+		{
+			BuildFlags = strcmp(argv[i + 1], "fast_build") == 0 ? BVH_BUILD_FLAG_PREFER_FAST_BUILD : BVH_BUILD_FLAG_PREFER_FAST_TRACE;
+		}
+		else if (strcmp(argv[i], "--memory") == 0)
+		{
+			MinimizeMemory = strcmp(argv[i + 1], "minimal") == 0;
+		}
+		else if (strcmp(argv[i], "--bvh-width") == 0)
+		{
+			BranchingFactor = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--frames") == 0)
+		{
+			FrameCount = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--moving") == 0)
+		{
+			MovingSphereCount = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--seed") == 0)
+		{
+			RandomSeed = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--sampler") == 0)
+		{
+			SamplerType = strcmp(argv[i + 1], "random") == 0 ? SamplerTypeRandom : SamplerTypeSobol;
+		}
+		else if (strcmp(argv[i], "--roulette-depth") == 0)
+		{
+			RouletteMinDepth = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--orbit") == 0)
+		{
+			OrbitDegrees = (float)atof(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--temporal") == 0)
+		{
+			TemporalMinBlendFactor = (float)atof(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--primary-cache") == 0)
+		{
+			PrimaryHitStrata = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--packets") == 0)
+		{
+			PacketTracing = atoi(argv[i + 1]) != 0;
+		}
+		else if (strcmp(argv[i], "--wavefront") == 0)
+		{
+			WavefrontSize = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--sort-shading") == 0)
+		{
+			SortQueuedHits = atoi(argv[i + 1]) != 0;
+		}
+		else if (strcmp(argv[i], "--metallic") == 0)
+		{
+			MetallicFraction = (float)atof(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--dielectric") == 0)
+		{
+			DielectricFraction = (float)atof(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--emissive") == 0)
+		{
+			EmissiveFraction = (float)atof(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--denoise") == 0)
+		{
+			DenoiserIterationCount = (unsigned int)atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--benchmark") == 0)
+		{
+			pBenchmarkName = argv[i + 1];
+		}
+		else if (strcmp(argv[i], "--isa") == 0)
+		{
+			for (unsigned int ISA = SPHERE_KERNEL_ISA_SCALAR; ISA <= SPHERE_KERNEL_ISA_AVX512; ISA++)
+			{
+				if (strcmp(argv[i + 1], GetSphereKernelISAName((SPHERE_KERNEL_ISA)ISA)) == 0)
+				{
+					SetSphereKernelISA((SPHERE_KERNEL_ISA)ISA);
+				}
+			}
+		}
+	}
+
+	if (pBenchmarkName != nullptr)
+	{
+		if (strcmp(pBenchmarkName, "kernels") == 0)
+		{
+			return BenchmarkSphereKernels(1024U, 16384U) == true ? 0 : 1;
+		}
+
+		if (strcmp(pBenchmarkName, "bvh") == 0)
+		{
+			return BenchmarkBVHLayouts(ScatteredSphereCount > 0 ? ScatteredSphereCount : 1000000U, 1000000U) == true ? 0 : 1;
+		}
+
+		if (strcmp(pBenchmarkName, "roulette") == 0)
+		{
+			return BenchmarkRussianRoulette(PixelWidth, PixelHeight, RaysPerPixel, ScatteredSphereCount) == true ? 0 : 1;
+		}
+
+		if (strcmp(pBenchmarkName, "denoise") == 0)
+		{
+			return BenchmarkDenoiser(PixelWidth, PixelHeight, DenoiserIterationCount > 0 ? DenoiserIterationCount : 3U) == true ? 0 : 1;
+		}
+
+		fprintf(stderr, "Unknown benchmark %s.\n", pBenchmarkName);
+		return 1;
+	}
+
+	// Collection of scene and rendering constants, the same ones the DXR path passes as global inline root constants.
+	InlineConstantBuffer Constants{};
+	GetDefaultSceneConstants(&Constants);
+	Constants.RaysPerPixel = RaysPerPixel;
+	Constants.RandomSeed = RandomSeed;
+	Constants.SamplerType = SamplerType;
+	Constants.AdaptiveThreshold = AdaptiveThreshold;
+
+	if (RouletteMinDepth != ~0U)
+	{
+		Constants.RouletteMinDepth = RouletteMinDepth;
+	}
+
+	// Adaptive sampling only stops pixels in between passes, so it needs more than one of them.
+	if (AdaptiveThreshold > 0.0f && SamplesPerPass == 0)
+	{
+		SamplesPerPass = 4U;
+	}
+
+	// Instance descriptions, the same ones the DXR path builds its top-level acceleration structure from, and their materials.
+	std::vector<SceneInstanceDesc> Instances{};
+	std::vector<SceneMaterial> Materials{};
+	GetScatteredSceneInstances(&Instances, ScatteredSphereCount, 1234U);
+	SetScatteredSceneMaterials(&Instances, &Materials, MetallicFraction, DielectricFraction, EmissiveFraction);
+
+	// Animated frames move the scattered spheres around, and refit the acceleration structure instead of rebuilding it.
+	const std::vector<SceneInstanceDesc> RestInstances{ Instances };
+	std::vector<unsigned int> MovingInstanceIndices{};
+
+	MovingSphereCount = MovingSphereCount < ScatteredSphereCount ? MovingSphereCount : ScatteredSphereCount;
+	FrameCount = FrameCount > 0 ? FrameCount : 1;
+
+	for (unsigned int i = 0; i < MovingSphereCount; i++)
+	{
+		MovingInstanceIndices.push_back(DefaultSceneInstanceCount + i);
+	}
+
+	if (FrameCount > 1)
+	{
+		BuildFlags |= BVH_BUILD_FLAG_ALLOW_UPDATE;
+	}
+
+	if (MinimizeMemory == true)
+	{
+		BuildFlags |= BVH_BUILD_FLAG_MINIMIZE_MEMORY;
+	}
+
+	// CPU backend.
+	CPURaytracer Raytracer{};
+	Raytracer.InitConfig.pixel_width = PixelWidth;
+	Raytracer.InitConfig.pixel_height = PixelHeight;
+	Raytracer.InitConfig.thread_count = ThreadCount;
+	Raytracer.InitConfig.tile_width = TileSize;
+	Raytracer.InitConfig.tile_height = TileSize;
+	Raytracer.InitConfig.tile_order = TileOrder;
+	Raytracer.InitConfig.ptr_inline_constant_buffer = &Constants;
+	Raytracer.InitConfig.ptr_instance_descs = Instances.data();
+	Raytracer.InitConfig.instance_count = (unsigned int)Instances.size();
+	Raytracer.InitConfig.ptr_materials = Materials.data();
+	Raytracer.InitConfig.acceleration_structure_build_flags = BuildFlags;
+	Raytracer.InitConfig.acceleration_structure_branching_factor = BranchingFactor;
+	Raytracer.InitConfig.denoiser_iteration_count = DenoiserIterationCount;
+	Raytracer.InitConfig.primary_hit_strata = PrimaryHitStrata;
+	Raytracer.InitConfig.packet_tracing = PacketTracing;
+	Raytracer.InitConfig.wavefront_size = WavefrontSize;
+	Raytracer.InitConfig.sort_queued_hits = SortQueuedHits;
+	Raytracer.InitConfig.temporal_min_blend_factor = TemporalMinBlendFactor;
+	Raytracer.Initialize();
+
+	const CPUBVH& AccelerationStructure = Raytracer.GetAccelerationStructure();
+
+	// Progressive rendering, in passes of SamplesPerPass rays per pixel, up to RaysPerPixel of them. (All of them in one pass, by default.)
+	ProgressiveAccumulator Accumulator{};
+	Accumulator.InitConfig.samples_per_pass = SamplesPerPass;
+	Accumulator.InitConfig.target_sample_count = RaysPerPixel;
+	Accumulator.Initialize();
+
+	printf
+	(
+		"Built a %s BVH over %u instances in %.3f seconds: %u nodes (%u 8-wide%s), depth %u, SAH cost %.2f, %.2f MB.\n",
+		(BuildFlags & BVH_BUILD_FLAG_PREFER_FAST_BUILD) != 0 ? "fast-build (LBVH)" : "fast-trace (binned SAH)",
+		(unsigned int)Instances.size(),
+		AccelerationStructure.GetBuildSeconds(),
+		AccelerationStructure.GetNodeCount(),
+		AccelerationStructure.GetWideNodeCount(),
+		AccelerationStructure.IsQuantized() == true ? ", quantized" : "",
+		AccelerationStructure.GetDepth(),
+		AccelerationStructure.GetSAHCost(),
+		(double)AccelerationStructure.GetMemoryByteSize() / (1024.0 * 1024.0)
+	);
+
+	for (unsigned int Frame = 0; Frame < FrameCount; Frame++)
+	{
+		if (Frame > 0)
+		{
+			AnimateScatteredSceneInstances(RestInstances, MovingSphereCount, 0.1f * (float)Frame, &Instances);
+
+			bool Rebuilt = Raytracer.UpdateInstances(Instances.data(), MovingInstanceIndices.data(), (unsigned int)MovingInstanceIndices.size());
+
+			printf
+			(
+				"Frame %u: %s the BVH after moving %u instances in %.3f ms, SAH cost %.2f.\n",
+				Frame,
+				Rebuilt == true ? "rebuilt" : "refitted",
+				MovingSphereCount,
+				AccelerationStructure.GetUpdateSeconds() * 1000.0,
+				AccelerationStructure.GetSAHCost()
+			);
+
+			// Fly the camera around the scene.
+			if (OrbitDegrees != 0.0f)
+			{
+				Constants.CameraToWorld = GetDefaultCameraToWorld(OrbitDegrees * (float)Frame * 0.0174532925f);
+			}
+
+			// Frames blended together need samples of their own, rather than the same ones over again.
+			if (TemporalMinBlendFactor > 0.0f)
+			{
+				Constants.RandomSeed = RandomSeed + Frame;
+			}
+		}
+
+		// Time to dispatch some rays, starting over from the first sample since the scene has moved.
+		auto StartTime = std::chrono::steady_clock::now();
+		double FirstPassSeconds{ 0.0 };
+		unsigned long long CameraRayCount{ 0 };
+		unsigned int ActivePixelCount{ PixelWidth * PixelHeight };
+
+		Accumulator.Reset();
+
+		while (Accumulator.BeginPass(&Constants) == true)
+		{
+			CameraRayCount += (unsigned long long)ActivePixelCount * Constants.RaysPerPixel;
+
+			Raytracer.DispatchRays();
+
+			Accumulator.EndPass();
+
+			if (Accumulator.GetPassCount() == 1)
+			{
+				FirstPassSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+			}
+
+			// Adaptive sampling: no more passes are needed once every pixel has converged.
+			if (AdaptiveThreshold > 0.0f)
+			{
+				ActivePixelCount = (PixelWidth * PixelHeight) - Raytracer.GetConvergedPixelCount();
+
+				if (ActivePixelCount == 0)
+				{
+					break;
+				}
+			}
+		}
+
+		double ElapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+		if (Accumulator.GetPassCount() > 1)
+		{
+			printf
+			(
+				"Rendered %ux%u at %u rays per pixel in %.3f seconds, over %u passes. (First image after %.1f ms.)\n",
+				PixelWidth,
+				PixelHeight,
+				Accumulator.GetAccumulatedSampleCount(),
+				ElapsedSeconds,
+				Accumulator.GetPassCount(),
+				FirstPassSeconds * 1000.0
+			);
+		}
+		else
+		{
+			printf("Rendered %ux%u at %u rays per pixel in %.3f seconds.\n", PixelWidth, PixelHeight, RaysPerPixel, ElapsedSeconds);
+		}
+
+		if (AdaptiveThreshold > 0.0f)
+		{
+			printf
+			(
+				"Adaptive sampling traced %.1f rays per pixel on average, and stopped %.1f%% of the pixels before %u.\n",
+				(double)CameraRayCount / (double)(PixelWidth * PixelHeight),
+				100.0 * (double)((PixelWidth * PixelHeight) - ActivePixelCount) / (double)(PixelWidth * PixelHeight),
+				RaysPerPixel
+			);
+		}
+
+		// Blend the previous frames in, wherever they saw the same surfaces.
+		if (TemporalMinBlendFactor > 0.0f)
+		{
+			Raytracer.AccumulateHistory();
+
+			printf
+			(
+				"Reprojected the history of %.1f%% of the pixels in %.2f ms.\n",
+				100.0 * (double)Raytracer.GetTemporalAccumulator().GetReprojectedPixelCount() / (double)(PixelWidth * PixelHeight),
+				Raytracer.GetTemporalAccumulator().GetAccumulateSeconds() * 1000.0
+			);
+		}
+
+		// Filter the finished frame, for renders with too few samples per pixel to be clean on their own.
+		if (DenoiserIterationCount > 0)
+		{
+			Raytracer.Denoise();
+
+			printf("Denoised with %u a-trous passes in %.2f ms.\n", DenoiserIterationCount, Raytracer.GetDenoiser().GetDenoiseSeconds() * 1000.0);
+		}
+	}
+
+	if (FrameCount > 1)
+	{
+		printf("%u refits and %u rebuilds over %u frames.\n", AccelerationStructure.GetRefitCount(), AccelerationStructure.GetRebuildCount(), FrameCount);
+	}
+
+	// Report the shader invocations of the last pass, per hit group and miss shader.
+	const CPUDXR::DispatchStatistics& Statistics = Raytracer.GetStatistics();
+
+	printf
+	(
+		"%llu TraceRay() calls%s, %.2f Mrays/s.\n",
+		Statistics.trace_ray_count,
+		Accumulator.GetPassCount() > 1 ? " in the last pass" : "",
+		(double)Statistics.trace_ray_count / Statistics.dispatch_seconds / 1.0e6
+	);
+
+	if (Statistics.packet_ray_count > 0)
+	{
+		printf("  %llu of them traced in packets.\n", Statistics.packet_ray_count);
+	}
+
+	// Report the rays of each bounce of a wavefront pass, and where their time went.
+	for (size_t i = 0; i < Statistics.bounces.size(); i++)
+	{
+		const CPUDXR::BounceStatistics& Bounce = Statistics.bounces[i];
+
+		printf
+		(
+			"  Bounce %zu: %llu rays, sorted in %.2f ms, traced in %.2f ms (%.2f Mrays/s), shaded in %.2f ms.\n",
+			i + 1,
+			Bounce.ray_count,
+			Bounce.sort_seconds * 1000.0,
+			Bounce.trace_seconds * 1000.0,
+			Bounce.trace_seconds > 0.0 ? (double)Bounce.ray_count / Bounce.trace_seconds / 1.0e6 : 0.0,
+			Bounce.shade_seconds * 1000.0
+		);
+	}
+
+	for (size_t i = 0; i < Statistics.closest_hit_invocations.size(); i++)
+	{
+		printf
+		(
+			"  Hit group %zu: %llu intersection, %llu any-hit, %llu closest-hit invocations, %.2f Mhits/s.\n",
+			i,
+			Statistics.intersection_invocations[i],
+			Statistics.any_hit_invocations[i],
+			Statistics.closest_hit_invocations[i],
+			(double)Statistics.closest_hit_invocations[i] / Statistics.dispatch_seconds / 1.0e6
+		);
+	}
+
+	for (size_t i = 0; i < Statistics.miss_invocations.size(); i++)
+	{
+		printf("  Miss shader %zu: %llu invocations.\n", i, Statistics.miss_invocations[i]);
+	}
+
+	// Report the cost of each material: the paths whose camera ray hit it, how many rays they traced on average, and what share of the dispatch's rays went into them.
+	// (No rays per second: their rays are spread over the whole dispatch, and over every hit group they bounce off of.)
+	for (size_t i = 0; i < Statistics.path_counts.size(); i++)
+	{
+		if (Statistics.path_counts[i] > 0)
+		{
+			printf
+			(
+				"  Hit group %zu: %llu paths start on it, %.2f rays per path, %.1f%% of the dispatch's rays.\n",
+				i,
+				Statistics.path_counts[i],
+				(double)Statistics.path_ray_counts[i] / (double)Statistics.path_counts[i],
+				Statistics.trace_ray_count > 0 ? 100.0 * (double)Statistics.path_ray_counts[i] / (double)Statistics.trace_ray_count : 0.0
+			);
+		}
+	}
+
+	// Report the time each material's shaders took, summed over the threads, when a wavefront pass shaded its hits sorted by hit group.
+	if (Statistics.bounces.empty() == false && SortQueuedHits == true)
+	{
+		for (size_t i = 0; i < Statistics.closest_hit_seconds.size(); i++)
+		{
+			if (Statistics.closest_hit_invocations[i] > 0)
+			{
+				printf
+				(
+					"  Hit group %zu shaded in %.2f ms, %.1f ns per hit.\n",
+					i,
+					Statistics.closest_hit_seconds[i] * 1000.0,
+					Statistics.closest_hit_seconds[i] * 1.0e9 / (double)Statistics.closest_hit_invocations[i]
+				);
+			}
+		}
+
+		printf("  Misses shaded in %.2f ms.\n", Statistics.miss_seconds * 1000.0);
+	}
+
+	// Report how evenly the tiles of the last pass were spread over the threads.
+	double BusySeconds{ 0.0 };
+	double MinBusySeconds{ 1.0e30 };
+	unsigned long long StolenTileCount{ 0 };
+
+	for (const CPUDXR::DispatchWorkerStatistics& Worker : Statistics.workers)
+	{
+		BusySeconds += Worker.busy_seconds;
+		MinBusySeconds = Worker.busy_seconds < MinBusySeconds ? Worker.busy_seconds : MinBusySeconds;
+		StolenTileCount += Worker.stolen_tile_count;
+	}
+
+	if (Statistics.workers.empty() == false)
+	{
+		printf
+		(
+			"%zu threads were busy %.1f%% of the time on average, and %.1f%% at the least, with %llu tiles stolen.\n",
+			Statistics.workers.size(),
+			100.0 * BusySeconds / ((double)Statistics.workers.size() * Statistics.dispatch_seconds),
+			100.0 * MinBusySeconds / Statistics.dispatch_seconds,
+			StolenTileCount
+		);
+	}
+
+	if (PrintThreadStatistics == true)
+	{
+		for (size_t i = 0; i < Statistics.workers.size(); i++)
+		{
+			printf
+			(
+				"  Thread %zu: %llu tiles (%llu stolen), busy %.2f ms, idle %.2f ms.\n",
+				i,
+				Statistics.workers[i].tile_count,
+				Statistics.workers[i].stolen_tile_count,
+				Statistics.workers[i].busy_seconds * 1000.0,
+				Statistics.workers[i].idle_seconds * 1000.0
+			);
+		}
+	}
+
+	if (pOutputFileName != nullptr)
+	{
+		if (WritePPM(pOutputFileName, Raytracer.GetRenderTarget(), PixelWidth, PixelHeight) == false)
+		{
+			fprintf(stderr, "Failed to write %s.\n", pOutputFileName);
+			return 1;
+		}
+	}
+
+	return 0;
+}
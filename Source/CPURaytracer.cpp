@@ -0,0 +1,282 @@
+// CPURaytracer.cpp - Headless CPU path-tracing backend, reproducing the DXR pipeline without a GPU.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include "CPURaytracer.hpp"
+
+CPURaytracer::CPURaytracer
+() :
+	InitConfig{},
+	Config{}
+{
+	this->Config.pixel_count = 0;
+	this->Config.bytes_per_pixel = 4;
+	this->Config.shader_resources = CPUShaderResources{};
+	this->Config.name = "CPURaytracer";
+	this->Config.error_message = "CPURaytracer.Initialize() failed.";
+
+	this->InitConfig.pixel_width = 0;
+	this->InitConfig.pixel_height = 0;
+	this->InitConfig.thread_count = 0;
+	this->InitConfig.tile_width = 16;
+	this->InitConfig.tile_height = 16;
+	this->InitConfig.tile_order = CPUDXR::TILE_ORDER_HILBERT;
+	this->InitConfig.ptr_inline_constant_buffer = nullptr;
+	this->InitConfig.ptr_instance_descs = nullptr;
+	this->InitConfig.instance_count = 0;
+	this->InitConfig.ptr_materials = nullptr;
+	this->InitConfig.acceleration_structure_build_flags = BVH_BUILD_FLAG_PREFER_FAST_TRACE;
+	this->InitConfig.acceleration_structure_branching_factor = BVH8Width;
+	this->InitConfig.denoiser_iteration_count = 0;
+	this->InitConfig.primary_hit_strata = 0;
+	this->InitConfig.packet_tracing = false;
+	this->InitConfig.wavefront_size = 0;
+	this->InitConfig.sort_queued_hits = true;
+	this->InitConfig.temporal_min_blend_factor = 0.0f;
+}
+
+void CPURaytracer::Initialize
+()
+{
+	CPUDXR::FailCheck
+	(
+		(this->InitConfig.ptr_inline_constant_buffer != nullptr) && (this->InitConfig.ptr_materials != nullptr) && (this->InitConfig.pixel_width > 0) && (this->InitConfig.pixel_height > 0),
+		this->Config.error_message,
+		this->Config.name
+	);
+
+	// Allocate the render target.
+	this->Config.pixel_count = this->InitConfig.pixel_width * this->InitConfig.pixel_height;
+	this->Config.render_target.assign((size_t)this->Config.pixel_count * this->Config.bytes_per_pixel, 0);
+	this->Config.accumulation_buffer.assign((size_t)this->Config.pixel_count * 4, 0.0f);
+
+	// Bind the resources, for the shaders. (Random numbers are generated in the shaders, from the seed in the constants.)
+	this->Config.shader_resources.Constants = this->InitConfig.ptr_inline_constant_buffer;
+	this->Config.shader_resources.RenderTarget = this->Config.render_target.data();
+	this->Config.shader_resources.AccumulationBuffer = this->Config.accumulation_buffer.data();
+
+	const CPUShaderResources* pResources = &(this->Config.shader_resources);
+
+	// Ray generation shader record, or the wavefront one, for tracing the paths in queues, or the tile one, for tracing the camera rays as packets.
+	if (this->InitConfig.wavefront_size > 0 && this->InitConfig.primary_hit_strata == 0)
+	{
+		this->Config.shader_resources.WavefrontSize = this->InitConfig.wavefront_size;
+
+		this->Config.pipeline.InitConfig.ray_generation_wavefront_shader = [pResources]()
+		{
+			RayGenerationWavefront(*pResources);
+		};
+	}
+	else if (this->InitConfig.packet_tracing == true && this->InitConfig.primary_hit_strata == 0)
+	{
+		this->Config.pipeline.InitConfig.ray_generation_tile_shader = [pResources](UInt2 FirstIndex, UInt2 EndIndex)
+		{
+			RayGenerationTile(*pResources, FirstIndex, EndIndex);
+		};
+	}
+	else
+	{
+		this->Config.pipeline.InitConfig.ray_generation_shader = [pResources]()
+		{
+			RayGeneration(*pResources);
+		};
+	}
+
+	// Hit group shader table, in the order of LambertianHitGroupIndex, MetallicHitGroupIndex and DielectricHitGroupIndex. All three intersect the World-Space spheres, so packets can be traced.
+	this->Config.pipeline.InitConfig.hit_groups.resize(3);
+
+	this->Config.pipeline.InitConfig.hit_groups[LambertianHitGroupIndex] = CPUDXR::HitGroup
+	{
+		"LambertianHitGroup",
+		[pResources]() { LambertianIntersection(*pResources); },
+		nullptr,
+		[pResources](RayPayload& Payload, const IntersectionAttributes& Attributes) { LambertianClosestHit(*pResources, Payload, Attributes); },
+		true
+	};
+
+	this->Config.pipeline.InitConfig.hit_groups[MetallicHitGroupIndex] = CPUDXR::HitGroup
+	{
+		"MetallicHitGroup",
+		[pResources]() { MetallicIntersection(*pResources); },
+		nullptr,
+		[pResources](RayPayload& Payload, const IntersectionAttributes& Attributes) { MetallicClosestHit(*pResources, Payload, Attributes); },
+		true
+	};
+
+	this->Config.pipeline.InitConfig.hit_groups[DielectricHitGroupIndex] = CPUDXR::HitGroup
+	{
+		"DielectricHitGroup",
+		[pResources]() { DielectricIntersection(*pResources); },
+		nullptr,
+		[pResources](RayPayload& Payload, const IntersectionAttributes& Attributes) { DielectricClosestHit(*pResources, Payload, Attributes); },
+		true
+	};
+
+	// Miss shader table.
+	this->Config.pipeline.InitConfig.miss_shaders =
+	{
+		[pResources](RayPayload& Payload) { LambertianMiss(*pResources, Payload); },
+		[pResources](RayPayload& Payload) { MetallicMiss(*pResources, Payload); },
+		[pResources](RayPayload& Payload) { DielectricMiss(*pResources, Payload); }
+	};
+
+	// Pipeline config and scene.
+	this->Config.pipeline.InitConfig.max_trace_recursion_depth = 1U;
+	this->Config.pipeline.InitConfig.ptr_instance_descs = this->InitConfig.ptr_instance_descs;
+	this->Config.pipeline.InitConfig.instance_count = this->InitConfig.instance_count;
+	this->Config.pipeline.InitConfig.ptr_materials = this->InitConfig.ptr_materials;
+	this->Config.pipeline.InitConfig.acceleration_structure_build_flags = this->InitConfig.acceleration_structure_build_flags;
+	this->Config.pipeline.InitConfig.acceleration_structure_branching_factor = this->InitConfig.acceleration_structure_branching_factor;
+	this->Config.pipeline.InitConfig.thread_count = this->InitConfig.thread_count;
+	this->Config.pipeline.InitConfig.tile_width = this->InitConfig.tile_width;
+	this->Config.pipeline.InitConfig.tile_height = this->InitConfig.tile_height;
+	this->Config.pipeline.InitConfig.tile_order = this->InitConfig.tile_order;
+	this->Config.pipeline.InitConfig.sort_queued_hits = this->InitConfig.sort_queued_hits;
+	this->Config.pipeline.Initialize();
+
+	// The cache of first hits, if the camera stays put long enough for it.
+	if (this->InitConfig.primary_hit_strata > 0)
+	{
+		this->Config.primary_hit_buffer.assign((size_t)this->Config.pixel_count * this->InitConfig.primary_hit_strata * this->InitConfig.primary_hit_strata, PrimaryHit{});
+
+		this->Config.shader_resources.PrimaryHitBuffer = this->Config.primary_hit_buffer.data();
+		this->Config.shader_resources.PrimaryHitStrata = this->InitConfig.primary_hit_strata;
+	}
+
+	// The denoiser, the history, and the guide buffers the ray generation shader fills out for them, only get allocated if they are going to be used.
+	if (this->InitConfig.denoiser_iteration_count > 0 || this->InitConfig.temporal_min_blend_factor > 0.0f)
+	{
+		this->Config.guide_buffer.assign((size_t)this->Config.pixel_count * 4, 0.0f);
+		this->Config.albedo_buffer.assign((size_t)this->Config.pixel_count * 4, 0.0f);
+
+		this->Config.shader_resources.GuideBuffer = this->Config.guide_buffer.data();
+		this->Config.shader_resources.AlbedoBuffer = this->Config.albedo_buffer.data();
+	}
+
+	// Both run on the pipeline's threads, between dispatches.
+	if (this->InitConfig.denoiser_iteration_count > 0)
+	{
+		this->Config.denoiser.InitConfig.pixel_width = this->InitConfig.pixel_width;
+		this->Config.denoiser.InitConfig.pixel_height = this->InitConfig.pixel_height;
+		this->Config.denoiser.InitConfig.iteration_count = this->InitConfig.denoiser_iteration_count;
+		this->Config.denoiser.InitConfig.ptr_thread_pool = &(this->Config.pipeline.GetThreadPool());
+		this->Config.denoiser.Initialize();
+	}
+
+	if (this->InitConfig.temporal_min_blend_factor > 0.0f)
+	{
+		this->Config.temporal_accumulator.InitConfig.pixel_width = this->InitConfig.pixel_width;
+		this->Config.temporal_accumulator.InitConfig.pixel_height = this->InitConfig.pixel_height;
+		this->Config.temporal_accumulator.InitConfig.min_blend_factor = this->InitConfig.temporal_min_blend_factor;
+		this->Config.temporal_accumulator.InitConfig.ptr_thread_pool = &(this->Config.pipeline.GetThreadPool());
+		this->Config.temporal_accumulator.Initialize();
+	}
+}
+
+bool CPURaytracer::UpdateInstances
+(
+	const SceneInstanceDesc* pInstanceDescs,
+	const unsigned int* pChangedInstanceIndices,
+	unsigned int ChangedInstanceCount
+)
+{
+	return this->Config.pipeline.UpdateInstances(pInstanceDescs, pChangedInstanceIndices, ChangedInstanceCount);
+}
+
+void CPURaytracer::DispatchRays
+()
+{
+	this->Config.pipeline.DispatchRays
+	(
+		this->InitConfig.pixel_width,
+		this->InitConfig.pixel_height
+	);
+}
+
+const unsigned char* CPURaytracer::GetRenderTarget
+()
+{
+	return this->Config.render_target.data();
+}
+
+unsigned int CPURaytracer::GetRenderTargetByteSize
+()
+{
+	return (unsigned int)this->Config.render_target.size();
+}
+
+void CPURaytracer::Denoise
+()
+{
+	CPUDXR::FailCheck(this->InitConfig.denoiser_iteration_count > 0, "CPURaytracer.Denoise() failed: no denoiser_iteration_count was set.", this->Config.name);
+
+	this->Config.denoiser.Denoise
+	(
+		this->Config.accumulation_buffer.data(),
+		this->Config.guide_buffer.data(),
+		this->Config.albedo_buffer.data(),
+		this->Config.render_target.data()
+	);
+}
+
+void CPURaytracer::AccumulateHistory
+()
+{
+	CPUDXR::FailCheck(this->InitConfig.temporal_min_blend_factor > 0.0f, "CPURaytracer.AccumulateHistory() failed: no temporal_min_blend_factor was set.", this->Config.name);
+
+	this->Config.temporal_accumulator.Accumulate
+	(
+		*(this->InitConfig.ptr_inline_constant_buffer),
+		this->Config.accumulation_buffer.data(),
+		this->Config.guide_buffer.data(),
+		this->Config.albedo_buffer.data(),
+		this->Config.render_target.data()
+	);
+}
+
+unsigned int CPURaytracer::GetConvergedPixelCount
+()
+{
+	unsigned int ConvergedPixelCount{ 0 };
+
+	for (unsigned int i = 0; i < this->Config.pixel_count; i++)
+	{
+		if (this->Config.accumulation_buffer[((size_t)i * 4) + 3] < 0.0f)
+		{
+			ConvergedPixelCount++;
+		}
+	}
+
+	return ConvergedPixelCount;
+}
+
+const CPUDXR::DispatchStatistics& CPURaytracer::GetStatistics
+()
+{
+	return this->Config.pipeline.GetStatistics();
+}
+
+const CPUBVH& CPURaytracer::GetAccelerationStructure
+()
+{
+	return this->Config.pipeline.GetAccelerationStructure();
+}
+
+const CPUDenoiser& CPURaytracer::GetDenoiser
+()
+{
+	return this->Config.denoiser;
+}
+
+const CPUTemporalAccumulator& CPURaytracer::GetTemporalAccumulator
+()
+{
+	return this->Config.temporal_accumulator;
+}
+
+CPURaytracer::~CPURaytracer
+()
+{
+	// Nothing here, for now.
+}
@@ -0,0 +1,167 @@
+// CPURaytracer.hpp - Headless CPU path-tracing backend, reproducing the DXR pipeline without a GPU.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include <vector>
+
+#include "SceneDescription.hpp"
+#include "CPUShaderStuff.hpp"
+#include "CPUDXR.hpp"
+#include "CPUShaders.hpp"
+#include "CPUDenoiser.hpp"
+#include "CPUTemporalAccumulator.hpp"
+
+// Config data for this class.
+struct CPURaytracerConfig
+{
+	// For calculating and allocating the render target.
+	unsigned int pixel_count;
+	unsigned int bytes_per_pixel;
+
+	// Render target, in R8G8B8A8_UNORM format.
+	std::vector<unsigned char> render_target;
+
+	// Sums of the colors and squared luminances of the rays traced so far, in R32G32B32A32_FLOAT format.
+	std::vector<float> accumulation_buffer;
+
+	// Sums of the first-hit normals and depths, and of the first-hit albedos and sample counts, for guiding the denoiser. (See CPUShaderResources.)
+	std::vector<float> guide_buffer;
+	std::vector<float> albedo_buffer;
+
+	// First hits of the camera rays, per stratum of each pixel, for static cameras. (See CPUShaderResources.)
+	std::vector<PrimaryHit> primary_hit_buffer;
+
+	// Bindings of the global root signature, handed to the shaders.
+	CPUShaderResources shader_resources;
+
+	// Software DXR pipeline, with the ported shaders in its shader tables.
+	CPUDXR::CPUDXRPipeline pipeline;
+
+	// Filter for the accumulated image, run by Denoise().
+	CPUDenoiser denoiser;
+
+	// History of the previous frames, blended in by AccumulateHistory().
+	CPUTemporalAccumulator temporal_accumulator;
+
+	// Label for this class.
+	const char* name;
+
+	// Error message for initialization.
+	const char* error_message;
+};
+
+// Populate this before calling the initializer function.
+struct CPURaytracerInitConfig
+{
+	// Desired number of pixels along each dimension.
+	unsigned int pixel_width;
+	unsigned int pixel_height;
+
+	// Number of worker threads to render with. Use 0 for one per hardware thread.
+	unsigned int thread_count;
+
+	// Size of the tiles the image gets traced in, and the order they get dealt out to the workers in. (See CPUDXR::TILE_ORDER.)
+	unsigned int tile_width;
+	unsigned int tile_height;
+	unsigned int tile_order;
+
+	// Scene and rendering constants, the same ones passed to the DXR pipeline as inline root constants.
+	const InlineConstantBuffer* ptr_inline_constant_buffer;
+
+	// Instance descriptions, the same ones used for building the DXR top-level acceleration structure.
+	const SceneInstanceDesc* ptr_instance_descs;
+	unsigned int instance_count;
+
+	// Material of each instance, instance_count of them, the same table the DXR pipeline uploads for its shaders.
+	const SceneMaterial* ptr_materials;
+
+	// Build flags for the acceleration structure over the instances. (See BVH_BUILD_FLAG.) Include BVH_BUILD_FLAG_ALLOW_UPDATE for animated scenes.
+	unsigned int acceleration_structure_build_flags;
+
+	// 2 for a binary acceleration structure, or 8 for an 8-wide one with SIMD node tests.
+	unsigned int acceleration_structure_branching_factor;
+
+	// Number of à-trous passes Denoise() runs. (See CPUDenoiserInitConfig.) Use 0 to leave the denoiser out.
+	unsigned int denoiser_iteration_count;
+
+	// Strata along each side of a pixel whose camera rays share their first hit, when tracing more than one pass, or more than one ray per pixel, without moving the camera: only the first ray through each stratum gets traced.
+	// Costs 60 bytes per stratum per pixel. Use 0 to trace every camera ray. 1 gives up anti-aliasing altogether, while 4 keeps 16 levels of it along the edges.
+	unsigned int primary_hit_strata;
+
+	// Whether to trace the camera rays of each tile together, as packets of tile_width x tile_height rays, instead of one by one. (See CPUDXR::TraceRayPacket().)
+	// Only applies when there is no first-hit cache: the two both save work on the camera rays, and the cache saves more of it.
+	bool packet_tracing;
+
+	// Number of pixels whose paths get traced breadth-first together, one bounce at a time, with the rays of each bounce sorted and traced in a single queue. (See CPUDXR::TraceRayQueue().) Use 0 to trace each pixel's paths depth-first.
+	// Takes precedence over packet_tracing, and likewise only applies when there is no first-hit cache. Costs about 200 bytes per pixel of the wave.
+	unsigned int wavefront_size;
+
+	// Whether the wavefront shades its hits sorted by hit group. (See CPUDXR::CPUDXRPipelineInitConfig::sort_queued_hits.)
+	bool sort_queued_hits;
+
+	// Smallest weight AccumulateHistory() gives the current frame. (See CPUTemporalAccumulatorInitConfig.) Use 0 to leave the history out.
+	// The guide buffers are only allocated if either this or the denoiser is used.
+	float temporal_min_blend_factor;
+};
+
+// Renders the sphere scene on the CPU, by running the ported shaders on the software DXR runtime, and writes the frame into host memory.
+class CPURaytracer
+{
+public:
+	// Constructor.
+	CPURaytracer();
+
+	// Populate this before calling the initializer function.
+	CPURaytracerInitConfig InitConfig;
+
+	// Initializes the instance of this class.
+	// Allocates the render target, and builds the pipeline's shader tables.
+	void Initialize();
+
+	// Moves the instances listed in pChangedInstanceIndices (or all of them, if nullptr) to their descriptions in pInstanceDescs, and refits the acceleration structure over them.
+	// Returns true if the acceleration structure had degraded enough to be rebuilt instead.
+	bool UpdateInstances(const SceneInstanceDesc* pInstanceDescs, const unsigned int* pChangedInstanceIndices, unsigned int ChangedInstanceCount);
+
+	// Renders one frame, or one pass of it, into the render target, using every worker thread. Equivalent of DispatchRays().
+	// Passes after the first one (FirstSampleIndex > 0) add to the accumulation buffer, and write the average of every pass so far.
+	void DispatchRays();
+
+	// Returns a pointer to the R8G8B8A8_UNORM render target.
+	const unsigned char* GetRenderTarget();
+
+	// Returns the size of the render target, in bytes.
+	unsigned int GetRenderTargetByteSize();
+
+	// Overwrites the render target with a denoised version of the average of every pass so far. Call it after the last DispatchRays() of a frame.
+	void Denoise();
+
+	// Blends the previous frames, reprojected to the current camera, into the average of every pass so far, and overwrites the render target with the result.
+	// Call it after the last DispatchRays() of a frame, and before Denoise(), which then filters the blend.
+	void AccumulateHistory();
+
+	// Returns the number of pixels that adaptive sampling has stopped tracing, since the last pass with FirstSampleIndex = 0.
+	unsigned int GetConvergedPixelCount();
+
+	// Returns the shader invocation counts and timing of the last DispatchRays() call.
+	const CPUDXR::DispatchStatistics& GetStatistics();
+
+	// Returns the hierarchy built over the scene's instances.
+	const CPUBVH& GetAccelerationStructure();
+
+	// Returns the denoiser, for its timing.
+	const CPUDenoiser& GetDenoiser();
+
+	// Returns the temporal accumulator, for its timing and reprojection statistics.
+	const CPUTemporalAccumulator& GetTemporalAccumulator();
+
+	// Destructor.
+	~CPURaytracer();
+
+protected:
+	// Config data for this object.
+	CPURaytracerConfig Config;
+
+};
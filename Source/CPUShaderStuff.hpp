@@ -0,0 +1,497 @@
+// CPUShaderStuff.hpp (Header-Only) - C++ port of CommonShaderStuff.h, for the CPU rendering path.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include <cmath>
+
+#include "SceneDescription.hpp"
+
+#define UnitSphereRadius 1.0f
+#define TwoPi 6.28318530718f
+
+// 2-component float vector, standing in for HLSL's float2.
+struct Float2
+{
+	float x, y;
+};
+
+// 3-component float vector, standing in for HLSL's float3.
+struct Float3
+{
+	float x, y, z;
+};
+
+// 2-component unsigned vector, standing in for HLSL's uint2.
+struct UInt2
+{
+	unsigned int x, y;
+};
+
+inline Float3 operator+(Float3 a, Float3 b) { return Float3{ a.x + b.x, a.y + b.y, a.z + b.z }; }
+inline Float3 operator-(Float3 a, Float3 b) { return Float3{ a.x - b.x, a.y - b.y, a.z - b.z }; }
+inline Float3 operator*(Float3 a, Float3 b) { return Float3{ a.x * b.x, a.y * b.y, a.z * b.z }; }
+inline Float3 operator*(float s, Float3 a) { return Float3{ s * a.x, s * a.y, s * a.z }; }
+inline Float3 operator*(Float3 a, float s) { return Float3{ s * a.x, s * a.y, s * a.z }; }
+inline Float3 operator/(Float3 a, float s) { return Float3{ a.x / s, a.y / s, a.z / s }; }
+inline Float3 operator-(Float3 a) { return Float3{ -a.x, -a.y, -a.z }; }
+
+inline float Dot(Float3 a, Float3 b)
+{
+	return (a.x * b.x) + (a.y * b.y) + (a.z * b.z);
+}
+
+inline Float3 Cross(Float3 a, Float3 b)
+{
+	return Float3{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+inline Float3 Normalize(Float3 a)
+{
+	return a / std::sqrt(Dot(a, a));
+}
+
+// Stands in for HLSL's reversebits().
+inline unsigned int ReverseBits(unsigned int a)
+{
+	a = ((a >> 1) & 0x55555555U) | ((a & 0x55555555U) << 1);
+	a = ((a >> 2) & 0x33333333U) | ((a & 0x33333333U) << 2);
+	a = ((a >> 4) & 0x0F0F0F0FU) | ((a & 0x0F0F0F0FU) << 4);
+	a = ((a >> 8) & 0x00FF00FFU) | ((a & 0x00FF00FFU) << 8);
+
+	return (a >> 16) | (a << 16);
+}
+
+// Ray payload for the main/only rays. It carries a path from one bounce to the next, as the Ray Generation shader traces them in a loop.
+struct RayPayload
+{
+	// Product of the attenuations of the surfaces the path has bounced off so far, to be scaled by each Closest-Hit shader.
+	Float3 Throughput;
+
+	// Light the path has picked up from the emissive surfaces it hit so far, each one's emission scaled by the throughput of the path up to it.
+	Float3 Radiance;
+
+	// Origin in World-Space of the path's next ray, from the Closest-Hit shader: the hit, or wherever the ray left the surface after going through it.
+	Float3 WorldScatterOrigin;
+
+	// Direction in World-Space of the path's next ray, from the Closest-Hit shader.
+	Float3 WorldScatterDirection;
+
+	// Distance along the ray to its hit, from the Closest-Hit shader. The Miss shaders set it negative, to end the path.
+	float HitT;
+
+	// Tracker for number of times this path has intersected something.
+	unsigned int IntersectionCount;
+
+	// Index of the camera ray within its pixel, which picks the sample of each of its random dimensions. (See GetSample3D().)
+	unsigned int SampleIndex;
+
+	// Surface normal in World-Space at the hit, from the Closest-Hit shader. (CPU backend only: it feeds the denoiser's guide buffers.)
+	Float3 WorldSurfaceNormal;
+
+	// Hit group of the path's first hit, set by the runtime, which counts the rays of each path towards the material it started on. (CPU backend only: see DispatchStatistics::path_ray_counts.)
+	unsigned int PathHitGroupIndex;
+};
+
+// Intersection attributes.
+struct IntersectionAttributes
+{
+	// Intersection point in Object-Space.
+	Float3 ObjectIntersectionPoint;
+
+	// Surface normal of the intersection point in Object-Space.
+	Float3 ObjectSurfaceNormal;
+};
+
+// Enumeration for reporting the Hit-Type with ReportHit().
+enum HitTypes
+{
+	SphereHit = 0
+};
+
+// Equivalent of mul(CameraToWorld, float4(Point, 1.0)).xyz, for the XMMATRIX-layout camera transform.
+inline Float3 TransformCameraPoint(const SceneFloat4x4& CameraToWorld, Float3 Point)
+{
+	const float(&m)[4][4] = CameraToWorld.m;
+
+	return Float3
+	{
+		Point.x * m[0][0] + Point.y * m[1][0] + Point.z * m[2][0] + m[3][0],
+		Point.x * m[0][1] + Point.y * m[1][1] + Point.z * m[2][1] + m[3][1],
+		Point.x * m[0][2] + Point.y * m[1][2] + Point.z * m[2][2] + m[3][2]
+	};
+}
+
+// Equivalent of mul(Transform3x4, float4(Point, 1.0)).xyz.
+inline Float3 TransformPoint3x4(const float(&Transform)[3][4], Float3 Point)
+{
+	return Float3
+	{
+		Transform[0][0] * Point.x + Transform[0][1] * Point.y + Transform[0][2] * Point.z + Transform[0][3],
+		Transform[1][0] * Point.x + Transform[1][1] * Point.y + Transform[1][2] * Point.z + Transform[1][3],
+		Transform[2][0] * Point.x + Transform[2][1] * Point.y + Transform[2][2] * Point.z + Transform[2][3]
+	};
+}
+
+// Equivalent of mul(Transform3x4, float4(Vector, 0.0)).xyz.
+inline Float3 TransformVector3x4(const float(&Transform)[3][4], Float3 Vector)
+{
+	return Float3
+	{
+		Transform[0][0] * Vector.x + Transform[0][1] * Vector.y + Transform[0][2] * Vector.z,
+		Transform[1][0] * Vector.x + Transform[1][1] * Vector.y + Transform[1][2] * Vector.z,
+		Transform[2][0] * Vector.x + Transform[2][1] * Vector.y + Transform[2][2] * Vector.z
+	};
+}
+
+// Calculates the inverse of an affine 3x4 transform, for the WorldToObject3x4() equivalent.
+inline void InvertTransform3x4(const float(&Transform)[3][4], float(&Inverse)[3][4])
+{
+	const float(&m)[3][4] = Transform;
+
+	float Determinant =
+		m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+		m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+		m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+
+	float InverseDeterminant = 1.0f / Determinant;
+
+	Inverse[0][0] = (m[1][1] * m[2][2] - m[1][2] * m[2][1]) * InverseDeterminant;
+	Inverse[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * InverseDeterminant;
+	Inverse[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * InverseDeterminant;
+	Inverse[1][0] = (m[1][2] * m[2][0] - m[1][0] * m[2][2]) * InverseDeterminant;
+	Inverse[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * InverseDeterminant;
+	Inverse[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * InverseDeterminant;
+	Inverse[2][0] = (m[1][0] * m[2][1] - m[1][1] * m[2][0]) * InverseDeterminant;
+	Inverse[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * InverseDeterminant;
+	Inverse[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * InverseDeterminant;
+
+	// Inverse translation = -(Inverse rotation/scale * translation).
+	for (unsigned int Row = 0; Row < 3; Row++)
+	{
+		Inverse[Row][3] = -(Inverse[Row][0] * m[0][3] + Inverse[Row][1] * m[1][3] + Inverse[Row][2] * m[2][3]);
+	}
+}
+
+// Calculates the Camera's position in World-Space, using a Camera-to-World transform.
+inline Float3 GetWorldCameraPosition(const SceneFloat4x4& CameraToWorld)
+{
+	// The second value represents the Camera's position in the Camera's Object-Space, along with a homogenous coordinate for translation.
+	return TransformCameraPoint(CameraToWorld, Float3{ 0.0f, 0.0f, 0.0f });
+}
+
+// PCG hash (Jarzynski and Olano, "Hash Functions for GPU Rendering"), for generating random numbers from counters rather than reading them from a buffer.
+// NOTE: Must match GetRandomHash() in CommonShaderStuff.h, so that both rendering paths get the same numbers.
+inline unsigned int GetRandomHash(unsigned int Value)
+{
+	unsigned int State = Value * 747796405U + 2891336453U;
+	unsigned int Word = ((State >> ((State >> 28U) + 4U)) ^ State) * 277803737U;
+
+	return (Word >> 22U) ^ Word;
+}
+
+// Seed of a pixel's random numbers, from its position and the frame's seed, so that no two pixels share a sequence.
+inline unsigned int GetPixelSeed(UInt2 ThreadId, UInt2 ThreadDims, unsigned int RandomSeed)
+{
+	unsigned int PixelIndex = ThreadId.y * ThreadDims.x + ThreadId.x;
+
+	return GetRandomHash(PixelIndex ^ GetRandomHash(RandomSeed));
+}
+
+// Float (Range [0.0, 1.0)) from the top 24 bits of a 0.32 fixed-point value, which a float holds exactly.
+inline float GetUnitFloat(unsigned int Value)
+{
+	return (float)(Value >> 8) * (1.0f / 16777216.0f);
+}
+
+// Generator matrices of the second and third Sobol dimensions. (The first one is a bit reversal.)
+// NOTE: Must match SobolDirections in CommonShaderStuff.h.
+const unsigned int SobolDirections[2][32]
+{
+	{
+		0x80000000U, 0xc0000000U, 0xa0000000U, 0xf0000000U, 0x88000000U, 0xcc000000U, 0xaa000000U, 0xff000000U,
+		0x80800000U, 0xc0c00000U, 0xa0a00000U, 0xf0f00000U, 0x88880000U, 0xcccc0000U, 0xaaaa0000U, 0xffff0000U,
+		0x80008000U, 0xc000c000U, 0xa000a000U, 0xf000f000U, 0x88008800U, 0xcc00cc00U, 0xaa00aa00U, 0xff00ff00U,
+		0x80808080U, 0xc0c0c0c0U, 0xa0a0a0a0U, 0xf0f0f0f0U, 0x88888888U, 0xccccccccU, 0xaaaaaaaaU, 0xffffffffU
+	},
+	{
+		0x80000000U, 0xc0000000U, 0x60000000U, 0x90000000U, 0xe8000000U, 0x5c000000U, 0x8e000000U, 0xc5000000U,
+		0x68800000U, 0x9cc00000U, 0xee600000U, 0x55900000U, 0x80680000U, 0xc09c0000U, 0x60ee0000U, 0x90550000U,
+		0xe8808000U, 0x5cc0c000U, 0x8e606000U, 0xc5909000U, 0x6868e800U, 0x9c9c5c00U, 0xeeee8e00U, 0x5555c500U,
+		0x8000e880U, 0xc0005cc0U, 0x60008e60U, 0x9000c590U, 0xe8006868U, 0x5c009c9cU, 0x8e00eeeeU, 0xc5005555U
+	}
+};
+
+// Sobol point of the given index, in one of the first 3 dimensions, as a 0.32 fixed-point value.
+inline unsigned int GetSobol(unsigned int Index, unsigned int Dimension)
+{
+	if (Dimension == 0)
+	{
+		return ReverseBits(Index);
+	}
+
+	unsigned int Value = 0;
+
+	// Without a branch on each bit, which would be taken at random.
+	for (unsigned int Bit = 0; Index != 0; Bit++, Index >>= 1)
+	{
+		Value ^= SobolDirections[Dimension - 1][Bit] & (0 - (Index & 1));
+	}
+
+	return Value;
+}
+
+// Nested uniform (Owen) scramble of a 0.32 fixed-point value, using the hash of Burley, "Practical Hash-based Owen Scrambling".
+inline unsigned int GetOwenScramble(unsigned int Value, unsigned int Seed)
+{
+	Value = ReverseBits(Value);
+
+	Value += Seed;
+	Value ^= Value * 0x6c50b47cU;
+	Value ^= Value * 0xb82f1e52U;
+	Value ^= Value * 0xc7afe638U;
+	Value ^= Value * 0x8d22f6e6U;
+
+	return ReverseBits(Value);
+}
+
+// 3D sample (Range [0.0, 1.0)) of one group of dimensions of a camera ray. Group 0 jitters the camera ray, and group N scatters its Nth bounce.
+// With the Sobol sampler, each pixel and group gets its own shuffle and scramble of the same 3D sequence: the samples of a pixel stay stratified, but are decorrelated from those of other pixels and groups.
+inline Float3 GetSample3D(unsigned int PixelSeed, unsigned int SampleIndex, unsigned int Group, unsigned int SamplerType)
+{
+	unsigned int GroupSeed = GetRandomHash(PixelSeed ^ GetRandomHash(Group));
+
+	Float3 Sample;
+
+	if (SamplerType == SamplerTypeSobol)
+	{
+		unsigned int ShuffledIndex = GetOwenScramble(SampleIndex, GroupSeed);
+
+		Sample.x = GetUnitFloat(GetOwenScramble(GetSobol(ShuffledIndex, 0), GetRandomHash(GroupSeed + 0)));
+		Sample.y = GetUnitFloat(GetOwenScramble(GetSobol(ShuffledIndex, 1), GetRandomHash(GroupSeed + 1)));
+		Sample.z = GetUnitFloat(GetOwenScramble(GetSobol(ShuffledIndex, 2), GetRandomHash(GroupSeed + 2)));
+	}
+	else
+	{
+		unsigned int SampleSeed = GetRandomHash(GroupSeed ^ GetRandomHash(SampleIndex));
+
+		Sample.x = GetUnitFloat(GetRandomHash(SampleSeed + 0));
+		Sample.y = GetUnitFloat(GetRandomHash(SampleSeed + 1));
+		Sample.z = GetUnitFloat(GetRandomHash(SampleSeed + 2));
+	}
+
+	return Sample;
+}
+
+// Calculates random offsets into a pixel (Range [0.0, 1.0)), for jittering ray positions.
+inline Float2 GetPixelOffset(unsigned int PixelSeed, unsigned int SampleIndex, unsigned int SamplerType)
+{
+	Float3 Sample = GetSample3D(PixelSeed, SampleIndex, 0, SamplerType);
+
+	return Float2{ Sample.x, Sample.y };
+}
+
+// Calculates a Point's position in World-Space, using a Camera-to-World transform and some other values. Used for generating Camera-Ray directions.
+inline Float3 GetWorldPointPosition(const SceneFloat4x4& CameraToWorld, UInt2 ThreadDims, UInt2 ThreadId, Float2 OffsetIntoPixel, float VerticalFoVRadians)
+{
+	Float3 WorldPointPosition;
+
+	WorldPointPosition.x = ((((float)ThreadId.x + OffsetIntoPixel.x) / (float)ThreadDims.x) * 2.0f - 1.0f) * ((float)ThreadDims.x / (float)ThreadDims.y) * (std::tan(VerticalFoVRadians / 2.0f));
+
+	WorldPointPosition.y = -((((float)ThreadId.y + OffsetIntoPixel.y) / (float)ThreadDims.y) * 2.0f - 1.0f) * (std::tan(VerticalFoVRadians / 2.0f));
+
+	WorldPointPosition.z = 1.0f;
+
+	return TransformCameraPoint(CameraToWorld, WorldPointPosition);
+}
+
+// Function for "lerping" the "sky-color" associated with a given pixel, based on World-Space Ray Direction.
+inline Float3 GetColorValue(SceneFloat4 SkyTopColor, SceneFloat4 SkyBottomColor, Float3 WorldRayDirection)
+{
+	float Blend = 0.5f * WorldRayDirection.y + 0.5f;
+
+	Float3 ColorValue{ 0.0f, 0.0f, 0.0f };
+
+	ColorValue.x = ((1.0f - Blend) * SkyBottomColor.x) + (Blend * SkyTopColor.x);
+	ColorValue.y = ((1.0f - Blend) * SkyBottomColor.y) + (Blend * SkyTopColor.y);
+	ColorValue.z = ((1.0f - Blend) * SkyBottomColor.z) + (Blend * SkyTopColor.z);
+
+	return ColorValue;
+}
+
+// Rec. 709 luminance of a color, for estimating the noise of a pixel.
+inline float GetLuminance(Float3 Color)
+{
+	return Dot(Color, Float3{ 0.2126f, 0.7152f, 0.0722f });
+}
+
+// Checks whether the standard error of a pixel's mean luminance has dropped below the threshold, from the sums of the luminances and squared luminances of its samples.
+inline bool GetPixelConverged(float LuminanceSum, float LuminanceSquaredSum, unsigned int SampleCount, float Threshold)
+{
+	if (Threshold <= 0.0f || SampleCount < AdaptiveMinSampleCount)
+	{
+		return false;
+	}
+
+	float Mean = LuminanceSum / (float)SampleCount;
+	float Variance = std::fmax((LuminanceSquaredSum / (float)SampleCount) - (Mean * Mean), 0.0f) * ((float)SampleCount / (float)(SampleCount - 1));
+
+	return std::sqrt(Variance / (float)SampleCount) <= Threshold;
+}
+
+// Solves the Sphere's "Intersection Quadratic" once, in Object-Space, combining GetIntersectionCount() and GetObjectIntersectionPoint().
+// Returns false if there are no solutions, or if the nearest solution lies outside of [TMin, TMax].
+// The nearest solution is where the ray enters the sphere, which is behind any ray leaving its surface, so that scattered rays never hit the sphere they left.
+inline bool GetObjectIntersection(Float3 ObjectRayOrigin, Float3 ObjectRayDirection, float TMin, float TMax, float* pTHit, IntersectionAttributes* pAttributes)
+{
+	// 'a', 'b' and 'c' from the quadratic formula.
+	float a = Dot(ObjectRayDirection, ObjectRayDirection);
+	float b = 2.0f * Dot(ObjectRayDirection, ObjectRayOrigin);
+	float c = Dot(ObjectRayOrigin, ObjectRayOrigin) - (UnitSphereRadius * UnitSphereRadius);
+
+	float Discriminant = (b * b) - (4.0f * a * c);
+
+	if (Discriminant < 0.0f)
+	{
+		return false;
+	}
+
+	// Distance along Ray to the nearest intersection.
+	float tRay = (-b - std::sqrt(Discriminant)) / (2.0f * a);
+
+	if (tRay < TMin || tRay > TMax)
+	{
+		return false;
+	}
+
+	*pTHit = tRay;
+
+	// Sphere intersection point and surface normal, in Object-Space.
+	pAttributes->ObjectIntersectionPoint = (ObjectRayOrigin + (tRay * ObjectRayDirection)) / UnitSphereRadius;
+	pAttributes->ObjectSurfaceNormal = Normalize(pAttributes->ObjectIntersectionPoint);
+
+	return true;
+}
+
+// World-Space counterpart of GetObjectIntersection(), for uniformly scaled spheres given by their World-Space center and radius.
+// The attributes come out the same as in Object-Space, as the unit sphere's surface normal doesn't change under uniform scaling and translation.
+inline bool GetWorldIntersection(Float3 WorldRayOrigin, Float3 WorldRayDirection, Float3 Center, float Radius, float TMin, float TMax, float* pTHit, IntersectionAttributes* pAttributes)
+{
+	Float3 CenterToOrigin = WorldRayOrigin - Center;
+
+	// 'a', 'b' and 'c' from the quadratic formula, in its half-b form.
+	float a = Dot(WorldRayDirection, WorldRayDirection);
+	float b = Dot(WorldRayDirection, CenterToOrigin);
+	float c = Dot(CenterToOrigin, CenterToOrigin) - (Radius * Radius);
+
+	float Discriminant = (b * b) - (a * c);
+
+	if (Discriminant < 0.0f)
+	{
+		return false;
+	}
+
+	// Distance along Ray to the nearest intersection.
+	float tRay = (-b - std::sqrt(Discriminant)) / a;
+
+	if (tRay < TMin || tRay > TMax)
+	{
+		return false;
+	}
+
+	*pTHit = tRay;
+
+	// Surface normal of the intersection point, which is also the intersection point on the unit sphere in Object-Space.
+	pAttributes->ObjectSurfaceNormal = (CenterToOrigin + (tRay * WorldRayDirection)) / Radius;
+	pAttributes->ObjectIntersectionPoint = pAttributes->ObjectSurfaceNormal * UnitSphereRadius;
+
+	return true;
+}
+
+// 2D sample (Range [0.0, 1.0)) for scattering the given bounce (IntersectionCount, starting at 1) of a camera ray.
+inline Float2 GetScatterSample(unsigned int PixelSeed, unsigned int SampleIndex, unsigned int IntersectionCount, unsigned int SamplerType)
+{
+	Float3 Sample = GetSample3D(PixelSeed, SampleIndex, IntersectionCount, SamplerType);
+
+	return Float2{ Sample.x, Sample.y };
+}
+
+// Function for mapping a 2D sample onto the hemisphere around a World-Space normal, with a density proportional to the cosine to the normal.
+// The sample is spread uniformly over the unit disk and projected up onto the hemisphere (Malley's method), in a basis around the normal (Duff et al., "Building an Orthonormal Basis, Revisited").
+// For a Lambertian surface, that density cancels the cosine and BRDF out, so each scattered ray weighs exactly the surface's attenuation.
+inline Float3 GetCosineWeightedDirection(Float3 WorldSurfaceNormal, Float2 Sample)
+{
+	float Sign = WorldSurfaceNormal.z >= 0.0f ? 1.0f : -1.0f;
+	float a = -1.0f / (Sign + WorldSurfaceNormal.z);
+	float b = WorldSurfaceNormal.x * WorldSurfaceNormal.y * a;
+
+	Float3 Tangent{ 1.0f + Sign * WorldSurfaceNormal.x * WorldSurfaceNormal.x * a, Sign * b, -Sign * WorldSurfaceNormal.x };
+	Float3 Bitangent{ b, Sign + WorldSurfaceNormal.y * WorldSurfaceNormal.y * a, -WorldSurfaceNormal.y };
+
+	float DiskRadius = std::sqrt(Sample.x);
+	float DiskAngle = TwoPi * Sample.y;
+
+	return (DiskRadius * std::cos(DiskAngle) * Tangent) + (DiskRadius * std::sin(DiskAngle) * Bitangent) + (std::sqrt(std::fmax(1.0f - Sample.x, 0.0f)) * WorldSurfaceNormal);
+}
+
+// Mirror reflection of a direction off of a surface with the given normal.
+inline Float3 GetReflectedDirection(Float3 Direction, Float3 WorldSurfaceNormal)
+{
+	return Direction - ((2.0f * Dot(Direction, WorldSurfaceNormal)) * WorldSurfaceNormal);
+}
+
+// Refraction of a unit direction through a surface whose unit normal faces against it, with Eta the ratio of the indices of refraction on either side (incident over transmitted), by Snell's law.
+// Directions past the critical angle get clamped to the surface's tangent plane. (A sphere entered from outside never takes them on its way out, so the dielectric shader never asks for one.)
+inline Float3 GetRefractedDirection(Float3 Direction, Float3 WorldSurfaceNormal, float Eta)
+{
+	float CosIncidence = -Dot(Direction, WorldSurfaceNormal);
+	float CosTransmitted = std::sqrt(std::fmax(1.0f - (Eta * Eta * (1.0f - (CosIncidence * CosIncidence))), 0.0f));
+
+	return Normalize((Eta * Direction) + (((Eta * CosIncidence) - CosTransmitted) * WorldSurfaceNormal));
+}
+
+// Schlick's approximation of the Fresnel reflectance of a dielectric, seen from outside at the given cosine to its normal.
+inline float GetSchlickReflectance(float CosIncidence, float IndexOfRefraction)
+{
+	float R0 = (1.0f - IndexOfRefraction) / (1.0f + IndexOfRefraction);
+	R0 = R0 * R0;
+
+	float OneMinusCos = 1.0f - CosIncidence;
+
+	return R0 + ((1.0f - R0) * OneMinusCos * OneMinusCos * OneMinusCos * OneMinusCos * OneMinusCos);
+}
+
+// Function for mapping a 3D sample to a point uniformly distributed within the unit ball, for fuzzing reflections.
+inline Float3 GetUnitBallPoint(Float3 Sample)
+{
+	float z = 1.0f - (2.0f * Sample.x);
+	float DiskRadius = std::sqrt(std::fmax(1.0f - (z * z), 0.0f));
+	float Angle = TwoPi * Sample.y;
+
+	return std::cbrt(Sample.z) * Float3{ DiskRadius * std::cos(Angle), DiskRadius * std::sin(Angle), z };
+}
+
+// Function for deciding whether Russian roulette ends a path that has traced PathDepth rays. Past RouletteMinDepth, it survives with the probability of its brightest throughput channel, and makes up for the paths that were ended by carrying that much more.
+// Returns false for a path that was ended, whose throughput is then 0.
+inline bool GetRouletteSurvival(unsigned int PixelSeed, unsigned int SampleIndex, unsigned int PathDepth, unsigned int RouletteMinDepth, unsigned int SamplerType, Float3* pThroughput)
+{
+	if (RouletteMinDepth == 0 || PathDepth < RouletteMinDepth)
+	{
+		return true;
+	}
+
+	float SurvivalProbability = std::fmin(std::fmax(pThroughput->x, std::fmax(pThroughput->y, pThroughput->z)), 1.0f);
+
+	if (GetSample3D(PixelSeed, SampleIndex, RouletteSampleGroup + PathDepth, SamplerType).x >= SurvivalProbability)
+	{
+		*pThroughput = Float3{ 0.0f, 0.0f, 0.0f };
+
+		return false;
+	}
+
+	*pThroughput = *pThroughput / SurvivalProbability;
+
+	return true;
+}
@@ -0,0 +1,670 @@
+// CPUShaders.cpp - C++ ports of the HLSL shaders in "Shader Source", for the software DXR runtime.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include "CPUShaders.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace CPUDXR;
+
+// Shared body of the sphere intersection shaders: figure out if we actually made any intersections with the AABB's sphere, and report it.
+inline void ReportSphereIntersection()
+{
+	float THit{};
+	IntersectionAttributes Attributes{};
+
+	// Uniformly scaled spheres get intersected in World-Space, without transforming the ray into Object-Space.
+	Float3 WorldCenter{};
+	float WorldRadius{};
+
+	if (GetWorldSphere(&WorldCenter, &WorldRadius) == true)
+	{
+		if (GetWorldIntersection(WorldRayOrigin(), WorldRayDirection(), WorldCenter, WorldRadius, RayTMin(), RayTCurrent(), &THit, &Attributes) == true)
+		{
+			ReportHit(THit, SphereHit, Attributes);
+		}
+
+		return;
+	}
+
+	if (GetObjectIntersection(ObjectRayOrigin(), ObjectRayDirection(), RayTMin(), RayTCurrent(), &THit, &Attributes) == true)
+	{
+		ReportHit(THit, SphereHit, Attributes);
+	}
+}
+
+// Writes a color value out to an R8G8B8A8_UNORM render target, with the same float-to-UNORM conversion as a UAV store.
+inline void StoreRenderTarget(unsigned char* RenderTarget, UInt2 ThreadDims, UInt2 ThreadId, Float3 Color)
+{
+	float Channels[4]{ Color.x, Color.y, Color.z, 0.0f };
+
+	unsigned char* pPixel = &(RenderTarget[((size_t)ThreadId.y * ThreadDims.x + ThreadId.x) * 4]);
+
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		float Saturated = Channels[i] < 0.0f ? 0.0f : (Channels[i] > 1.0f ? 1.0f : Channels[i]);
+
+		pPixel[i] = (unsigned char)(Saturated * 255.0f + 0.5f);
+	}
+}
+
+// Surface normal in World-Space of the hit being shaded by a Closest-Hit shader.
+inline Float3 GetHitWorldSurfaceNormal(const IntersectionAttributes& Attributes)
+{
+	Float3 WorldCenter{};
+	float WorldRadius{};
+
+	if (GetWorldSphere(&WorldCenter, &WorldRadius) == true)
+	{
+		// Uniformly scaled spheres: the normal the intersection shader found is already in World-Space.
+		return Attributes.ObjectSurfaceNormal;
+	}
+
+	return Normalize(TransformVector3x4(ObjectToWorld3x4(), Attributes.ObjectSurfaceNormal));
+}
+
+// Adds the light a hit's material emits to the path's radiance, and attenuates the path by its albedo.
+inline void AddSurfaceMaterial(const SceneMaterial& SurfaceMaterial, RayPayload& Payload)
+{
+	Payload.Radiance = Payload.Radiance + (Payload.Throughput * Float3{ SurfaceMaterial.Emission.x, SurfaceMaterial.Emission.y, SurfaceMaterial.Emission.z });
+	Payload.Throughput = Payload.Throughput * Float3{ SurfaceMaterial.Albedo.x, SurfaceMaterial.Albedo.y, SurfaceMaterial.Albedo.z };
+}
+
+// Cosine-weighted scatter direction of a Lambertian hit, drawn from the sample's own random numbers.
+inline Float3 GetLambertianScatterDirection(const InlineConstantBuffer& Constants, unsigned int PixelSeed, const RayPayload& Payload, Float3 WorldSurfaceNormal)
+{
+	Float2 ScatterSample = GetScatterSample(PixelSeed, Payload.SampleIndex, Payload.IntersectionCount, Constants.SamplerType);
+
+	return GetCosineWeightedDirection(WorldSurfaceNormal, ScatterSample);
+}
+
+// Sums of a pixel's samples traced by the current pass, before they get added to the previous passes'.
+struct PixelSampleSums
+{
+	// Sum of the rays' colors, and of their squared luminances, for estimating the pixel's noise.
+	Float3 Color;
+	float LuminanceSquared;
+
+	// Sums of the first hits' normals, depths and albedos, for the denoiser.
+	Float3 Normal;
+	float Depth;
+	Float3 Albedo;
+};
+
+// Returns true once adaptive sampling has stopped tracing a pixel, which then keeps the average it was last written with.
+inline bool IsPixelConverged(const CPUShaderResources& Resources, UInt2 ThreadDims, UInt2 ThreadId)
+{
+	return Resources.Constants->FirstSampleIndex > 0 && Resources.AccumulationBuffer[((size_t)ThreadId.y * ThreadDims.x + ThreadId.x) * 4 + 3] < 0.0f;
+}
+
+// Creates the camera ray going through the given offset within a pixel, along with its payload.
+inline void GetCameraRay(const InlineConstantBuffer& Constants, UInt2 ThreadDims, UInt2 ThreadId, Float3 WorldCameraPosition, Float2 PixelOffset, unsigned int SampleIndex, RayDesc* pRay, RayPayload* pPayload)
+{
+	// Collect the point in World-Space to shoot the camera-ray through.
+	Float3 WorldPointPosition = GetWorldPointPosition(Constants.CameraToWorld, ThreadDims, ThreadId, PixelOffset, Constants.VertFoVRad);
+
+	pRay->Direction = Normalize(WorldPointPosition - WorldCameraPosition);
+	pRay->Origin = WorldCameraPosition;
+	pRay->TMin = 0.000f;
+	pRay->TMax = 10000.0f;
+
+	*pPayload = RayPayload{};
+	pPayload->Throughput = Float3{ 1.0f, 1.0f, 1.0f };
+	pPayload->HitT = -1.0f;
+	pPayload->SampleIndex = SampleIndex;
+	pPayload->PathHitGroupIndex = ~0U;
+}
+
+// Adds the first hit of a camera ray to the sums of the denoiser's guides. Camera rays that reach the sky count as infinitely far, with no normal and a white albedo.
+inline void AddFirstHitGuides(const RayDesc& Ray, const RayPayload& Payload, PixelSampleSums* pSums)
+{
+	pSums->Normal = pSums->Normal + (Payload.HitT < 0.0f ? Float3{ 0.0f, 0.0f, 0.0f } : Payload.WorldSurfaceNormal);
+	pSums->Depth += Payload.HitT < 0.0f ? Ray.TMax : Payload.HitT;
+	pSums->Albedo = pSums->Albedo + (Payload.HitT < 0.0f ? Float3{ 1.0f, 1.0f, 1.0f } : Payload.Throughput);
+}
+
+// Ends a path that reached the sky, or ran out of depth: it gets the sky's color along its last ray, attenuated by every bounce, on top of the light it picked up on the way.
+inline void AddPathColor(const InlineConstantBuffer& Constants, const RayPayload& Payload, Float3 Direction, PixelSampleSums* pSums)
+{
+	Float3 RayColor = Payload.Radiance + (Payload.Throughput * GetColorValue(Constants.SkyTopColor, Constants.SkyBottomColor, Direction));
+
+	// Add the returned Ray's color value to the pixel's color value, to be averaged after.
+	pSums->Color = pSums->Color + RayColor;
+
+	pSums->LuminanceSquared += GetLuminance(RayColor) * GetLuminance(RayColor);
+}
+
+// Traces the path of a camera ray one ray at a time, continuing from where the Closest-Hit shader scattered the last one, so that nothing recurses, and adds its color to the pixel's sums.
+// TraceAtDepth(PathDepth, Ray, Payload) traces each ray of the path into its payload.
+template<typename TraceFunction>
+inline void TracePath(const InlineConstantBuffer& Constants, unsigned int PixelSeed, RayDesc* pRay, RayPayload* pPayload, PixelSampleSums* pSums, TraceFunction&& TraceAtDepth)
+{
+	RayDesc& Ray = *pRay;
+	RayPayload& Payload = *pPayload;
+
+	for (unsigned int PathDepth = 1; PathDepth <= Constants.MaxPathDepth; PathDepth++)
+	{
+		TraceAtDepth(PathDepth, Ray, Payload);
+
+		if (PathDepth == 1)
+		{
+			AddFirstHitGuides(Ray, Payload, pSums);
+		}
+
+		if (Payload.HitT < 0.0f)
+		{
+			break;
+		}
+
+		if (GetRouletteSurvival(PixelSeed, Payload.SampleIndex, PathDepth, Constants.RouletteMinDepth, Constants.SamplerType, &(Payload.Throughput)) == false)
+		{
+			break;
+		}
+
+		Ray.Origin = Payload.WorldScatterOrigin;
+		Ray.Direction = Payload.WorldScatterDirection;
+
+		// Hit groups without a Closest-Hit shader leave the payload alone, which ends the path.
+		Payload.HitT = -1.0f;
+	}
+
+	AddPathColor(Constants, Payload, Ray.Direction, pSums);
+}
+
+// Adds the sums of a pixel's samples to those of the previous passes, and writes the average out to the Render Target.
+inline void StorePixel(const CPUShaderResources& Resources, UInt2 ThreadDims, UInt2 ThreadId, const PixelSampleSums& Sums)
+{
+	const InlineConstantBuffer& Constants = *(Resources.Constants);
+
+	float* pAccumulatedColor = &(Resources.AccumulationBuffer[((size_t)ThreadId.y * ThreadDims.x + ThreadId.x) * 4]);
+
+	Float3 PixelColor = Sums.Color;
+	float LuminanceSquaredSum = Sums.LuminanceSquared;
+
+	// Add the sums of the previous passes, if any, and keep them for the next ones.
+	if (Constants.FirstSampleIndex > 0)
+	{
+		PixelColor = PixelColor + Float3{ pAccumulatedColor[0], pAccumulatedColor[1], pAccumulatedColor[2] };
+		LuminanceSquaredSum += pAccumulatedColor[3];
+	}
+
+	// Stop tracing the pixel in the next passes, once it is converged.
+	if (GetPixelConverged(GetLuminance(PixelColor), LuminanceSquaredSum, Constants.FirstSampleIndex + Constants.RaysPerPixel, Constants.AdaptiveThreshold) == true)
+	{
+		LuminanceSquaredSum = -1.0f;
+	}
+
+	pAccumulatedColor[0] = PixelColor.x;
+	pAccumulatedColor[1] = PixelColor.y;
+	pAccumulatedColor[2] = PixelColor.z;
+	pAccumulatedColor[3] = LuminanceSquaredSum;
+
+	// Same for the denoiser's guides, if there is a denoiser.
+	if (Resources.GuideBuffer != nullptr)
+	{
+		float* pAccumulatedGuide = &(Resources.GuideBuffer[((size_t)ThreadId.y * ThreadDims.x + ThreadId.x) * 4]);
+		float* pAccumulatedAlbedo = &(Resources.AlbedoBuffer[((size_t)ThreadId.y * ThreadDims.x + ThreadId.x) * 4]);
+
+		Float3 NormalSum = Sums.Normal;
+		float DepthSum = Sums.Depth;
+		Float3 AlbedoSum = Sums.Albedo;
+
+		if (Constants.FirstSampleIndex > 0)
+		{
+			NormalSum = NormalSum + Float3{ pAccumulatedGuide[0], pAccumulatedGuide[1], pAccumulatedGuide[2] };
+			DepthSum += pAccumulatedGuide[3];
+			AlbedoSum = AlbedoSum + Float3{ pAccumulatedAlbedo[0], pAccumulatedAlbedo[1], pAccumulatedAlbedo[2] };
+		}
+
+		pAccumulatedGuide[0] = NormalSum.x;
+		pAccumulatedGuide[1] = NormalSum.y;
+		pAccumulatedGuide[2] = NormalSum.z;
+		pAccumulatedGuide[3] = DepthSum;
+
+		pAccumulatedAlbedo[0] = AlbedoSum.x;
+		pAccumulatedAlbedo[1] = AlbedoSum.y;
+		pAccumulatedAlbedo[2] = AlbedoSum.z;
+		pAccumulatedAlbedo[3] = (float)(Constants.FirstSampleIndex + Constants.RaysPerPixel);
+	}
+
+	// Average the pixel's color value, over the rays of every pass so far.
+	PixelColor = PixelColor / (float)(Constants.FirstSampleIndex + Constants.RaysPerPixel);
+
+	// Write the pixel's color value out to the Render Target.
+	StoreRenderTarget(Resources.RenderTarget, ThreadDims, ThreadId, PixelColor);
+}
+
+void RayGeneration(const CPUShaderResources& Resources)
+{
+	const InlineConstantBuffer& Constants = *(Resources.Constants);
+
+	// Collect the Thread Dimensions.
+	UInt2 ThreadDims = DispatchRaysDimensions();
+
+	// Collect Thread Id for the current worker.
+	UInt2 ThreadId = DispatchRaysIndex();
+
+	if (IsPixelConverged(Resources, ThreadDims, ThreadId) == true)
+	{
+		return;
+	}
+
+	// Get the Camera's position in World-Space.
+	Float3 WorldCameraPosition = GetWorldCameraPosition(Constants.CameraToWorld);
+
+	// Sums for the current pixel, to be accumulated during the loop, then averaged down afterwards and written to the Render Target.
+	PixelSampleSums Sums{};
+
+	// Seed of the random numbers of the current pixel.
+	unsigned int PixelSeed = GetPixelSeed(ThreadId, ThreadDims, Constants.RandomSeed);
+
+	// Cached first hits of the pixel's strata, which start over along with the accumulation.
+	PrimaryHit* pPixelPrimaryHits{ nullptr };
+
+	if (Resources.PrimaryHitBuffer != nullptr)
+	{
+		unsigned int StratumCount = Resources.PrimaryHitStrata * Resources.PrimaryHitStrata;
+
+		pPixelPrimaryHits = &(Resources.PrimaryHitBuffer[((size_t)ThreadId.y * ThreadDims.x + ThreadId.x) * StratumCount]);
+
+		if (Constants.FirstSampleIndex == 0)
+		{
+			for (unsigned int i = 0; i < StratumCount; i++)
+			{
+				pPixelPrimaryHits[i].IsValid = 0;
+			}
+		}
+	}
+
+	// Loop for creating and tracing rays within the current pixel (Pixel = Worker Thread).
+	for (unsigned int RayIndex = 1; RayIndex <= Constants.RaysPerPixel; RayIndex++)
+	{
+		// Collect the pixel offset values for the current ray.
+		Float2 PixelOffset = GetPixelOffset(PixelSeed, Constants.FirstSampleIndex + RayIndex - 1, Constants.SamplerType);
+
+		// Create and initialize the Ray Payload and Ray Description.
+		RayDesc Ray;
+		RayPayload Payload;
+
+		GetCameraRay(Constants, ThreadDims, ThreadId, WorldCameraPosition, PixelOffset, Constants.FirstSampleIndex + RayIndex - 1, &Ray, &Payload);
+
+		// Cached first hit of the stratum the ray goes through, if there is a cache.
+		PrimaryHit* pPrimaryHit{ nullptr };
+
+		if (pPixelPrimaryHits != nullptr)
+		{
+			unsigned int StratumX = std::min((unsigned int)(PixelOffset.x * (float)Resources.PrimaryHitStrata), Resources.PrimaryHitStrata - 1);
+			unsigned int StratumY = std::min((unsigned int)(PixelOffset.y * (float)Resources.PrimaryHitStrata), Resources.PrimaryHitStrata - 1);
+
+			pPrimaryHit = &(pPixelPrimaryHits[StratumY * Resources.PrimaryHitStrata + StratumX]);
+		}
+
+		TracePath(Constants, PixelSeed, &Ray, &Payload, &Sums, [&](unsigned int PathDepth, const RayDesc& PathRay, RayPayload& PathPayload)
+		{
+			if (PathDepth == 1 && pPrimaryHit != nullptr && pPrimaryHit->IsValid != 0)
+			{
+				// Continue from the stratum's cached hit, as if the Closest-Hit shader had been invoked on it again. (Only Lambertian hits get cached.)
+				PathPayload.WorldScatterOrigin = pPrimaryHit->WorldPosition;
+				PathPayload.HitT = pPrimaryHit->HitT;
+				PathPayload.WorldSurfaceNormal = pPrimaryHit->WorldSurfaceNormal;
+				PathPayload.Throughput = pPrimaryHit->Throughput;
+				PathPayload.Radiance = pPrimaryHit->Radiance;
+				PathPayload.IntersectionCount = 1;
+
+				if (PathPayload.HitT >= 0.0f)
+				{
+					PathPayload.WorldScatterDirection = GetLambertianScatterDirection(Constants, PixelSeed, PathPayload, PathPayload.WorldSurfaceNormal);
+				}
+
+				return;
+			}
+
+			TraceRay(RAY_FLAG_FORCE_OPAQUE, ~0U, 0, 1, 0, PathRay, PathPayload);
+
+			// Metallic and Dielectric hits scatter by samples of their own, so they get traced again by every sample of the stratum.
+			if (PathDepth == 1 && pPrimaryHit != nullptr && (PathPayload.HitT < 0.0f || PathPayload.PathHitGroupIndex == LambertianHitGroupIndex))
+			{
+				pPrimaryHit->WorldPosition = PathPayload.WorldScatterOrigin;
+				pPrimaryHit->HitT = PathPayload.HitT;
+				pPrimaryHit->WorldSurfaceNormal = PathPayload.WorldSurfaceNormal;
+				pPrimaryHit->Throughput = PathPayload.Throughput;
+				pPrimaryHit->Radiance = PathPayload.Radiance;
+				pPrimaryHit->IsValid = 1;
+			}
+		});
+	}
+
+	StorePixel(Resources, ThreadDims, ThreadId, Sums);
+}
+
+void RayGenerationTile(const CPUShaderResources& Resources, UInt2 FirstIndex, UInt2 EndIndex)
+{
+	const InlineConstantBuffer& Constants = *(Resources.Constants);
+
+	// Collect the Thread Dimensions.
+	UInt2 ThreadDims = DispatchRaysDimensions();
+
+	// Get the Camera's position in World-Space.
+	Float3 WorldCameraPosition = GetWorldCameraPosition(Constants.CameraToWorld);
+
+	// Pixels of the tile that are still being traced, along with their seeds and sums.
+	std::vector<UInt2> ThreadIds;
+	std::vector<unsigned int> PixelSeeds;
+	std::vector<PixelSampleSums> Sums;
+
+	for (unsigned int y = FirstIndex.y; y < EndIndex.y; y++)
+	{
+		for (unsigned int x = FirstIndex.x; x < EndIndex.x; x++)
+		{
+			if (IsPixelConverged(Resources, ThreadDims, UInt2{ x, y }) == false)
+			{
+				ThreadIds.push_back(UInt2{ x, y });
+				PixelSeeds.push_back(GetPixelSeed(UInt2{ x, y }, ThreadDims, Constants.RandomSeed));
+			}
+		}
+	}
+
+	const unsigned int PixelCount = (unsigned int)ThreadIds.size();
+
+	Sums.assign(PixelCount, PixelSampleSums{});
+
+	// Camera rays of the current sample of every pixel, traced together.
+	std::vector<RayDesc> Rays(PixelCount);
+	std::vector<RayPayload> Payloads(PixelCount);
+
+	for (unsigned int RayIndex = 1; RayIndex <= Constants.RaysPerPixel; RayIndex++)
+	{
+		const unsigned int SampleIndex = Constants.FirstSampleIndex + RayIndex - 1;
+
+		for (unsigned int i = 0; i < PixelCount; i++)
+		{
+			GetCameraRay(Constants, ThreadDims, ThreadIds[i], WorldCameraPosition, GetPixelOffset(PixelSeeds[i], SampleIndex, Constants.SamplerType), SampleIndex, &(Rays[i]), &(Payloads[i]));
+		}
+
+		if (Constants.MaxPathDepth > 0)
+		{
+			TraceRayPacket(RAY_FLAG_FORCE_OPAQUE, ~0U, 0, 1, 0, Rays.data(), ThreadIds.data(), Payloads.data(), PixelCount);
+		}
+
+		// The bounces scatter every which way, so the rest of each path gets traced one ray at a time.
+		for (unsigned int i = 0; i < PixelCount; i++)
+		{
+			const UInt2 ThreadId = ThreadIds[i];
+
+			TracePath(Constants, PixelSeeds[i], &(Rays[i]), &(Payloads[i]), &(Sums[i]), [&](unsigned int PathDepth, const RayDesc& PathRay, RayPayload& PathPayload)
+			{
+				if (PathDepth > 1)
+				{
+					TraceRayPacket(RAY_FLAG_FORCE_OPAQUE, ~0U, 0, 1, 0, &PathRay, &ThreadId, &PathPayload, 1);
+				}
+			});
+		}
+	}
+
+	for (unsigned int i = 0; i < PixelCount; i++)
+	{
+		StorePixel(Resources, ThreadDims, ThreadIds[i], Sums[i]);
+	}
+}
+
+void RayGenerationWavefront(const CPUShaderResources& Resources)
+{
+	const InlineConstantBuffer& Constants = *(Resources.Constants);
+
+	// Collect the Thread Dimensions.
+	UInt2 ThreadDims = DispatchRaysDimensions();
+
+	// Get the Camera's position in World-Space.
+	Float3 WorldCameraPosition = GetWorldCameraPosition(Constants.CameraToWorld);
+
+	const unsigned int ImagePixelCount = ThreadDims.x * ThreadDims.y;
+	const unsigned int WavefrontSize = Resources.WavefrontSize > 0 ? Resources.WavefrontSize : ImagePixelCount;
+
+	// Pixels of the wave that are still being traced, along with their seeds and sums.
+	std::vector<UInt2> ThreadIds;
+	std::vector<unsigned int> PixelSeeds;
+	std::vector<PixelSampleSums> Sums;
+
+	// Queue of the paths still going, each one's ray indexing its pixel's payload. Paths that end get marked with PayloadIndex = ~0U, and compacted away.
+	std::vector<QueuedRay> Rays;
+	std::vector<RayPayload> Payloads;
+
+	for (unsigned int FirstPixel = 0; FirstPixel < ImagePixelCount; FirstPixel += WavefrontSize)
+	{
+		const unsigned int EndPixel = std::min(FirstPixel + WavefrontSize, ImagePixelCount);
+
+		ThreadIds.clear();
+
+		for (unsigned int Pixel = FirstPixel; Pixel < EndPixel; Pixel++)
+		{
+			UInt2 ThreadId{ Pixel % ThreadDims.x, Pixel / ThreadDims.x };
+
+			if (IsPixelConverged(Resources, ThreadDims, ThreadId) == false)
+			{
+				ThreadIds.push_back(ThreadId);
+			}
+		}
+
+		const unsigned int PixelCount = (unsigned int)ThreadIds.size();
+
+		PixelSeeds.resize(PixelCount);
+		Sums.assign(PixelCount, PixelSampleSums{});
+		Rays.resize(PixelCount);
+		Payloads.resize(PixelCount);
+
+		ForEachQueuedRay(PixelCount, [&](unsigned int Begin, unsigned int End)
+		{
+			for (unsigned int i = Begin; i < End; i++)
+			{
+				PixelSeeds[i] = GetPixelSeed(ThreadIds[i], ThreadDims, Constants.RandomSeed);
+			}
+		});
+
+		for (unsigned int RayIndex = 1; RayIndex <= Constants.RaysPerPixel; RayIndex++)
+		{
+			const unsigned int SampleIndex = Constants.FirstSampleIndex + RayIndex - 1;
+
+			// Queue up the camera rays of the current sample of every pixel.
+			ForEachQueuedRay(PixelCount, [&](unsigned int Begin, unsigned int End)
+			{
+				for (unsigned int i = Begin; i < End; i++)
+				{
+					QueuedRay& Ray = Rays[i];
+
+					GetCameraRay(Constants, ThreadDims, ThreadIds[i], WorldCameraPosition, GetPixelOffset(PixelSeeds[i], SampleIndex, Constants.SamplerType), SampleIndex, &(Ray.Ray), &(Payloads[i]));
+
+					Ray.DispatchIndex = ThreadIds[i];
+					Ray.InstanceInclusionMask = ~0U;
+					Ray.PayloadIndex = i;
+				}
+			});
+
+			unsigned int RayCount = PixelCount;
+
+			// Trace every path one bounce at a time, then continue the ones that survived, as TracePath() would.
+			for (unsigned int PathDepth = 1; PathDepth <= Constants.MaxPathDepth && RayCount > 0; PathDepth++)
+			{
+				TraceRayQueue(RAY_FLAG_FORCE_OPAQUE, 0, 1, 0, Rays.data(), Payloads.data(), RayCount, PathDepth);
+
+				ForEachQueuedRay(RayCount, [&](unsigned int Begin, unsigned int End)
+				{
+					for (unsigned int i = Begin; i < End; i++)
+					{
+						QueuedRay& Ray = Rays[i];
+						RayPayload& Payload = Payloads[Ray.PayloadIndex];
+
+						if (PathDepth == 1)
+						{
+							AddFirstHitGuides(Ray.Ray, Payload, &(Sums[Ray.PayloadIndex]));
+						}
+
+						if (Payload.HitT < 0.0f || GetRouletteSurvival(PixelSeeds[Ray.PayloadIndex], Payload.SampleIndex, PathDepth, Constants.RouletteMinDepth, Constants.SamplerType, &(Payload.Throughput)) == false)
+						{
+							AddPathColor(Constants, Payload, Ray.Ray.Direction, &(Sums[Ray.PayloadIndex]));
+
+							Ray.PayloadIndex = ~0U;
+							continue;
+						}
+
+						Ray.Ray.Origin = Payload.WorldScatterOrigin;
+						Ray.Ray.Direction = Payload.WorldScatterDirection;
+						
+						Payload.HitT = -1.0f;
+					}
+				});
+
+				// Compact the queue down to the paths that are still going.
+				RayCount = (unsigned int)(std::remove_if(Rays.begin(), Rays.begin() + RayCount, [](const QueuedRay& Ray) { return Ray.PayloadIndex == ~0U; }) - Rays.begin());
+			}
+
+			// Paths that ran out of depth.
+			ForEachQueuedRay(RayCount, [&](unsigned int Begin, unsigned int End)
+			{
+				for (unsigned int i = Begin; i < End; i++)
+				{
+					AddPathColor(Constants, Payloads[Rays[i].PayloadIndex], Rays[i].Ray.Direction, &(Sums[Rays[i].PayloadIndex]));
+				}
+			});
+
+			Rays.resize(PixelCount);
+		}
+
+		ForEachQueuedRay(PixelCount, [&](unsigned int Begin, unsigned int End)
+		{
+			for (unsigned int i = Begin; i < End; i++)
+			{
+				StorePixel(Resources, ThreadDims, ThreadIds[i], Sums[i]);
+			}
+		});
+	}
+}
+
+void LambertianIntersection(const CPUShaderResources& /*Resources*/)
+{
+	ReportSphereIntersection();
+}
+
+void LambertianClosestHit(const CPUShaderResources& Resources, RayPayload& Payload, const IntersectionAttributes& Attributes)
+{
+	const InlineConstantBuffer& Constants = *(Resources.Constants);
+
+	// Set some stuff in the Payload.
+	Payload.IntersectionCount++;
+
+	// Collect a cosine-weighted direction around the Surface Normal, for the random reflection/scatter direction.
+	Float3 WorldSurfaceNormal = GetHitWorldSurfaceNormal(Attributes);
+
+	// Hand the Reflection Ray back to the Ray Generation shader, which traces it next.
+	AddSurfaceMaterial(GetInstanceMaterial(), Payload);
+	Payload.WorldScatterOrigin = WorldRayOrigin() + (RayTCurrent() * WorldRayDirection());
+	Payload.WorldScatterDirection = GetLambertianScatterDirection(Constants, GetPixelSeed(DispatchRaysIndex(), DispatchRaysDimensions(), Constants.RandomSeed), Payload, WorldSurfaceNormal);
+	Payload.HitT = RayTCurrent();
+	Payload.WorldSurfaceNormal = WorldSurfaceNormal;
+}
+
+void LambertianMiss(const CPUShaderResources& /*Resources*/, RayPayload& Payload)
+{
+	// End the path. The Ray Generation shader gives it the sky's color.
+	Payload.HitT = -1.0f;
+}
+
+void MetallicIntersection(const CPUShaderResources& /*Resources*/)
+{
+	ReportSphereIntersection();
+}
+
+void MetallicClosestHit(const CPUShaderResources& Resources, RayPayload& Payload, const IntersectionAttributes& Attributes)
+{
+	const InlineConstantBuffer& Constants = *(Resources.Constants);
+	const SceneMaterial SurfaceMaterial = GetInstanceMaterial();
+
+	// Set some stuff in the Payload.
+	Payload.IntersectionCount++;
+
+	Float3 WorldSurfaceNormal = GetHitWorldSurfaceNormal(Attributes);
+
+	// Reflect the ray off of the surface, and fuzz it with a random point in a ball of the material's roughness radius. Fuzzed rays that end up below the surface keep the mirror reflection.
+	Float3 ReflectedDirection = GetReflectedDirection(Normalize(WorldRayDirection()), WorldSurfaceNormal);
+
+	Float3 FuzzSample = GetSample3D(GetPixelSeed(DispatchRaysIndex(), DispatchRaysDimensions(), Constants.RandomSeed), Payload.SampleIndex, Payload.IntersectionCount, Constants.SamplerType);
+	Float3 FuzzedDirection = Normalize(ReflectedDirection + (SurfaceMaterial.Roughness * GetUnitBallPoint(FuzzSample)));
+
+	// Hand the Reflection Ray back to the Ray Generation shader, which traces it next.
+	AddSurfaceMaterial(SurfaceMaterial, Payload);
+	Payload.WorldScatterOrigin = WorldRayOrigin() + (RayTCurrent() * WorldRayDirection());
+	Payload.WorldScatterDirection = Dot(FuzzedDirection, WorldSurfaceNormal) > 0.0f ? FuzzedDirection : ReflectedDirection;
+	Payload.HitT = RayTCurrent();
+	Payload.WorldSurfaceNormal = WorldSurfaceNormal;
+}
+
+void MetallicMiss(const CPUShaderResources& /*Resources*/, RayPayload& Payload)
+{
+	// End the path. The Ray Generation shader gives it the sky's color.
+	Payload.HitT = -1.0f;
+}
+
+void DielectricIntersection(const CPUShaderResources& /*Resources*/)
+{
+	ReportSphereIntersection();
+}
+
+void DielectricClosestHit(const CPUShaderResources& Resources, RayPayload& Payload, const IntersectionAttributes& Attributes)
+{
+	const InlineConstantBuffer& Constants = *(Resources.Constants);
+
+	// Set some stuff in the Payload.
+	Payload.IntersectionCount++;
+
+	Float3 WorldSurfaceNormal = GetHitWorldSurfaceNormal(Attributes);
+
+	// Radius of the sphere in World-Space. (Instances are uniformly scaled.)
+	Float3 WorldCenter{};
+	float WorldRadius{};
+
+	if (GetWorldSphere(&WorldCenter, &WorldRadius) == false)
+	{
+		Float3 WorldAxis = TransformVector3x4(ObjectToWorld3x4(), Float3{ UnitSphereRadius, 0.0f, 0.0f });
+
+		WorldRadius = std::sqrt(Dot(WorldAxis, WorldAxis));
+	}
+
+	Float3 Direction = Normalize(WorldRayDirection());
+	Float3 WorldHitPosition = WorldRayOrigin() + (RayTCurrent() * WorldRayDirection());
+
+	const SceneMaterial SurfaceMaterial = GetInstanceMaterial();
+
+	float IndexOfRefraction = SurfaceMaterial.IndexOfRefraction;
+	float CosIncidence = std::fmin(-Dot(Direction, WorldSurfaceNormal), 1.0f);
+
+	Float3 ScatterSample = GetSample3D(GetPixelSeed(DispatchRaysIndex(), DispatchRaysDimensions(), Constants.RandomSeed), Payload.SampleIndex, Payload.IntersectionCount, Constants.SamplerType);
+
+	if (ScatterSample.x < GetSchlickReflectance(CosIncidence, IndexOfRefraction))
+	{
+		Payload.WorldScatterOrigin = WorldHitPosition;
+		Payload.WorldScatterDirection = GetReflectedDirection(Direction, WorldSurfaceNormal);
+	}
+	else
+	{
+		// Through the sphere: the chord along the refracted direction ends where the far side's normal is the near side's, mirrored about the chord.
+		Float3 InsideDirection = GetRefractedDirection(Direction, WorldSurfaceNormal, 1.0f / IndexOfRefraction);
+		float ChordLength = -2.0f * WorldRadius * Dot(InsideDirection, WorldSurfaceNormal);
+		Float3 ExitSurfaceNormal = WorldSurfaceNormal - ((2.0f * Dot(InsideDirection, WorldSurfaceNormal)) * InsideDirection);
+
+		Payload.WorldScatterOrigin = WorldHitPosition + (ChordLength * InsideDirection);
+		Payload.WorldScatterDirection = GetRefractedDirection(InsideDirection, -ExitSurfaceNormal, IndexOfRefraction);
+	}
+
+	// Hand the scattered ray back to the Ray Generation shader, which traces it next. The albedo tints the glass.
+	AddSurfaceMaterial(SurfaceMaterial, Payload);
+	Payload.HitT = RayTCurrent();
+	Payload.WorldSurfaceNormal = WorldSurfaceNormal;
+}
+
+void DielectricMiss(const CPUShaderResources& /*Resources*/, RayPayload& Payload)
+{
+	// End the path. The Ray Generation shader gives it the sky's color.
+	Payload.HitT = -1.0f;
+}
@@ -0,0 +1,96 @@
+// CPUShaders.hpp - C++ ports of the HLSL shaders in "Shader Source", for the software DXR runtime.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include "SceneDescription.hpp"
+#include "CPUShaderStuff.hpp"
+#include "CPUDXR.hpp"
+
+// First hit of a camera ray, kept for the later samples that land in the same stratum of the same pixel. (CPU backend only.)
+// Holds what the Closest-Hit (or Miss) shader left in the payload, apart from the scatter direction, which every sample draws for itself.
+struct PrimaryHit
+{
+	// Hit point in World-Space, and its distance from the camera. A negative distance means that the path ended at its first ray: it reached the sky, or got absorbed.
+	Float3 WorldPosition;
+	float HitT;
+
+	// Surface normal in World-Space at the hit.
+	Float3 WorldSurfaceNormal;
+
+	// Throughput of the path after the hit, which is the hit's albedo, and the light it emits.
+	Float3 Throughput;
+	Float3 Radiance;
+
+	// Zero until the first sample of the stratum has traced its ray, since the last pass with FirstSampleIndex = 0.
+	unsigned int IsValid;
+};
+
+// Equivalent of the global root signature's bindings: the inline root constants and the UAVs.
+struct CPUShaderResources
+{
+	// Global "Constant Buffer" of inline root constants.
+	const InlineConstantBuffer* Constants;
+
+	// Render target of type UAV RW2DTexture, in R8G8B8A8_UNORM format.
+	unsigned char* RenderTarget;
+
+	// Sums of the colors (xyz) and squared luminances (w) of the rays traced so far, for progressive rendering. UAV RW2DTexture, in R32G32B32A32_FLOAT format.
+	// A negative w marks a pixel that adaptive sampling has stopped tracing.
+	float* AccumulationBuffer;
+
+	// Sums of the first-hit normals (xyz) and depths (w) of the rays traced so far, for guiding the denoiser. R32G32B32A32_FLOAT format.
+	// Both of these are nullptr when there is no denoiser to guide.
+	float* GuideBuffer;
+
+	// Sums of the first-hit albedos (xyz) of the rays traced so far, and their number (w), for guiding the denoiser. R32G32B32A32_FLOAT format.
+	float* AlbedoBuffer;
+
+	// First hits of the camera rays, PrimaryHitStrata x PrimaryHitStrata of them per pixel, one for each stratum of the pixel's area, for static cameras. (CPU backend only.)
+	// Only the first sample landing in a stratum traces its camera ray, and the others continue their paths from its hit. nullptr traces every camera ray.
+	PrimaryHit* PrimaryHitBuffer;
+	unsigned int PrimaryHitStrata;
+
+	// Number of pixels whose paths RayGenerationWavefront() keeps in flight at once, 0 taking the whole image. (CPU backend only.)
+	unsigned int WavefrontSize;
+};
+
+// Ray Generation shader, to begin the Raytracing flow.
+void RayGeneration(const CPUShaderResources& Resources);
+
+// Ray Generation shader for a whole tile of pixels, [FirstIndex, EndIndex), which traces the camera rays of each sample as packets, and the rest of their paths one ray at a time. (CPU backend only.)
+// Produces the same image as RayGeneration(), but doesn't use the PrimaryHitBuffer.
+void RayGenerationTile(const CPUShaderResources& Resources, UInt2 FirstIndex, UInt2 EndIndex);
+
+// Ray Generation shader for the whole dispatch, which traces the paths of a wave of pixels breadth-first: every ray of a bounce goes into one queue, sorted and traced together, and the paths that end get compacted out before the next bounce. (CPU backend only.)
+// Produces the same image as RayGeneration(), but doesn't use the PrimaryHitBuffer.
+void RayGenerationWavefront(const CPUShaderResources& Resources);
+
+// Lambertion Intersection shader.
+void LambertianIntersection(const CPUShaderResources& Resources);
+
+// Lambertian Closest-Hit shader.
+void LambertianClosestHit(const CPUShaderResources& Resources, RayPayload& Payload, const IntersectionAttributes& Attributes);
+
+// Lambertian Miss shader.
+void LambertianMiss(const CPUShaderResources& Resources, RayPayload& Payload);
+
+// Metallic Intersection shader.
+void MetallicIntersection(const CPUShaderResources& Resources);
+
+// Metallic Closest-Hit shader.
+void MetallicClosestHit(const CPUShaderResources& Resources, RayPayload& Payload, const IntersectionAttributes& Attributes);
+
+// Metallic Miss shader.
+void MetallicMiss(const CPUShaderResources& Resources, RayPayload& Payload);
+
+// Dielectric Intersection shader.
+void DielectricIntersection(const CPUShaderResources& Resources);
+
+// Dielectric Closest-Hit shader.
+void DielectricClosestHit(const CPUShaderResources& Resources, RayPayload& Payload, const IntersectionAttributes& Attributes);
+
+// Dielectric Miss shader.
+void DielectricMiss(const CPUShaderResources& Resources, RayPayload& Payload);
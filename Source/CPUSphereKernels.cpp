@@ -0,0 +1,619 @@
+// CPUSphereKernels.cpp - SIMD ray-sphere intersection kernels, with SSE/AVX2/AVX-512 paths chosen at runtime.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include "CPUSphereKernels.hpp"
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define SPHERE_KERNELS_X64 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define SPHERE_KERNELS_X64 0
+#endif
+
+// GCC and Clang only emit AVX2/AVX-512 instructions inside functions that are explicitly targeted at them.
+#if SPHERE_KERNELS_X64 && (defined(__GNUC__) || defined(__clang__))
+#define SPHERE_KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#define SPHERE_KERNEL_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define SPHERE_KERNEL_TARGET_AVX2
+#define SPHERE_KERNEL_TARGET_AVX512
+#endif
+
+// Solves the quadratic of one ray against one sphere, returning the near root, or a negative discriminant.
+inline bool SolveSphereNearRoot(Float3 Origin, Float3 Direction, Float3 Center, float Radius, float* pT)
+{
+	Float3 OriginToCenter = Origin - Center;
+
+	// Half-b form of the quadratic formula.
+	float a = Dot(Direction, Direction);
+	float b = Dot(OriginToCenter, Direction);
+	float c = Dot(OriginToCenter, OriginToCenter) - (Radius * Radius);
+
+	float Discriminant = (b * b) - (a * c);
+
+	if (Discriminant < 0.0f)
+	{
+		return false;
+	}
+
+	*pT = (-b - std::sqrt(Discriminant)) / a;
+
+	return true;
+}
+
+// Fills out the intersection point and normal of a ray that hit a sphere at distance T.
+inline void CompleteSphereHit(Float3 Origin, Float3 Direction, Float3 Center, float Radius, float T, unsigned int SphereIndex, SphereIntersection* pHit)
+{
+	pHit->T = T;
+	pHit->Point = Origin + (T * Direction);
+	pHit->Normal = (pHit->Point - Center) / Radius;
+	pHit->SphereIndex = SphereIndex;
+}
+
+// Scalar loop over the spheres in [First, Count), updating *pBestT / *pBestIndex.
+inline void IntersectRaySpheresTail(Float3 Origin, Float3 Direction, float TMin, const SphereArraySoA& Spheres, unsigned int First, float* pBestT, unsigned int* pBestIndex)
+{
+	for (unsigned int i = First; i < Spheres.Count; i++)
+	{
+		float T{};
+
+		if (SolveSphereNearRoot(Origin, Direction, Float3{ Spheres.CenterX[i], Spheres.CenterY[i], Spheres.CenterZ[i] }, Spheres.Radius[i], &T) && T >= TMin && T < *pBestT)
+		{
+			*pBestT = T;
+			*pBestIndex = i;
+		}
+	}
+}
+
+// Scalar update of packet lanes in [First, RayCount).
+inline void IntersectRayPacketSphereTail(SphereRayPacket* pPacket, unsigned int First, unsigned int RayCount, Float3 Center, float Radius, unsigned int SphereIndex)
+{
+	for (unsigned int i = First; i < RayCount; i++)
+	{
+		Float3 Origin{ pPacket->OriginX[i], pPacket->OriginY[i], pPacket->OriginZ[i] };
+		Float3 Direction{ pPacket->DirectionX[i], pPacket->DirectionY[i], pPacket->DirectionZ[i] };
+
+		float T{};
+
+		if (SolveSphereNearRoot(Origin, Direction, Center, Radius, &T) && T >= pPacket->TMin[i] && T < pPacket->T[i])
+		{
+			SphereIntersection Hit{};
+			CompleteSphereHit(Origin, Direction, Center, Radius, T, SphereIndex, &Hit);
+
+			pPacket->T[i] = T;
+			pPacket->PointX[i] = Hit.Point.x;
+			pPacket->PointY[i] = Hit.Point.y;
+			pPacket->PointZ[i] = Hit.Point.z;
+			pPacket->NormalX[i] = Hit.Normal.x;
+			pPacket->NormalY[i] = Hit.Normal.y;
+			pPacket->NormalZ[i] = Hit.Normal.z;
+			pPacket->SphereIndex[i] = SphereIndex;
+		}
+	}
+}
+
+
+
+
+
+// Scalar kernels.
+unsigned int IntersectRaySpheresScalar(Float3 Origin, Float3 Direction, float TMin, float* pBestT, const SphereArraySoA& Spheres)
+{
+	unsigned int BestIndex{ ~0U };
+
+	IntersectRaySpheresTail(Origin, Direction, TMin, Spheres, 0, pBestT, &BestIndex);
+
+	return BestIndex;
+}
+
+void IntersectRayPacketSphereScalar(SphereRayPacket* pPacket, unsigned int RayCount, Float3 Center, float Radius, unsigned int SphereIndex)
+{
+	IntersectRayPacketSphereTail(pPacket, 0, RayCount, Center, Radius, SphereIndex);
+}
+
+#if SPHERE_KERNELS_X64
+
+// SSE kernels, 4 lanes. (SSE2 only, which every x64 CPU has.)
+inline __m128 BlendSSE(__m128 a, __m128 b, __m128 Mask)
+{
+	return _mm_or_ps(_mm_andnot_ps(Mask, a), _mm_and_ps(Mask, b));
+}
+
+unsigned int IntersectRaySpheresSSE(Float3 Origin, Float3 Direction, float TMin, float* pBestT, const SphereArraySoA& Spheres)
+{
+	const __m128 Ox = _mm_set1_ps(Origin.x), Oy = _mm_set1_ps(Origin.y), Oz = _mm_set1_ps(Origin.z);
+	const __m128 Dx = _mm_set1_ps(Direction.x), Dy = _mm_set1_ps(Direction.y), Dz = _mm_set1_ps(Direction.z);
+	const __m128 A = _mm_set1_ps(Dot(Direction, Direction));
+	const __m128 MinT = _mm_set1_ps(TMin);
+	const __m128 Zero = _mm_setzero_ps();
+
+	__m128 BestT = _mm_set1_ps(*pBestT);
+	__m128 BestIndex = _mm_castsi128_ps(_mm_set1_epi32(-1));
+	__m128i Index = _mm_setr_epi32(0, 1, 2, 3);
+
+	unsigned int i = 0;
+
+	for (; i + 4 <= Spheres.Count; i += 4)
+	{
+		__m128 OCx = _mm_sub_ps(Ox, _mm_loadu_ps(Spheres.CenterX + i));
+		__m128 OCy = _mm_sub_ps(Oy, _mm_loadu_ps(Spheres.CenterY + i));
+		__m128 OCz = _mm_sub_ps(Oz, _mm_loadu_ps(Spheres.CenterZ + i));
+		__m128 R = _mm_loadu_ps(Spheres.Radius + i);
+
+		__m128 B = _mm_add_ps(_mm_add_ps(_mm_mul_ps(OCx, Dx), _mm_mul_ps(OCy, Dy)), _mm_mul_ps(OCz, Dz));
+		__m128 C = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(OCx, OCx), _mm_mul_ps(OCy, OCy)), _mm_mul_ps(OCz, OCz)), _mm_mul_ps(R, R));
+		__m128 Discriminant = _mm_sub_ps(_mm_mul_ps(B, B), _mm_mul_ps(A, C));
+
+		__m128 T = _mm_div_ps(_mm_sub_ps(_mm_sub_ps(Zero, B), _mm_sqrt_ps(_mm_max_ps(Discriminant, Zero))), A);
+
+		__m128 Hit = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(Discriminant, Zero), _mm_cmpge_ps(T, MinT)), _mm_cmplt_ps(T, BestT));
+
+		BestT = BlendSSE(BestT, T, Hit);
+		BestIndex = BlendSSE(BestIndex, _mm_castsi128_ps(Index), Hit);
+		Index = _mm_add_epi32(Index, _mm_set1_epi32(4));
+	}
+
+	// Reduce the lanes down to the nearest hit.
+	alignas(16) float LaneT[4];
+	alignas(16) unsigned int LaneIndex[4];
+	_mm_store_ps(LaneT, BestT);
+	_mm_store_si128((__m128i*)LaneIndex, _mm_castps_si128(BestIndex));
+
+	unsigned int BestSphere{ ~0U };
+
+	for (unsigned int Lane = 0; Lane < 4; Lane++)
+	{
+		if (LaneIndex[Lane] != ~0U && (LaneT[Lane] < *pBestT || (LaneT[Lane] == *pBestT && LaneIndex[Lane] < BestSphere)))
+		{
+			*pBestT = LaneT[Lane];
+			BestSphere = LaneIndex[Lane];
+		}
+	}
+
+	IntersectRaySpheresTail(Origin, Direction, TMin, Spheres, i, pBestT, &BestSphere);
+
+	return BestSphere;
+}
+
+void IntersectRayPacketSphereSSE(SphereRayPacket* pPacket, unsigned int RayCount, Float3 Center, float Radius, unsigned int SphereIndex)
+{
+	const __m128 Cx = _mm_set1_ps(Center.x), Cy = _mm_set1_ps(Center.y), Cz = _mm_set1_ps(Center.z);
+	const __m128 RR = _mm_set1_ps(Radius * Radius);
+	const __m128 InverseR = _mm_set1_ps(1.0f / Radius);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 Sphere = _mm_castsi128_ps(_mm_set1_epi32((int)SphereIndex));
+
+	unsigned int i = 0;
+
+	for (; i + 4 <= RayCount; i += 4)
+	{
+		__m128 Ox = _mm_load_ps(pPacket->OriginX + i), Oy = _mm_load_ps(pPacket->OriginY + i), Oz = _mm_load_ps(pPacket->OriginZ + i);
+		__m128 Dx = _mm_load_ps(pPacket->DirectionX + i), Dy = _mm_load_ps(pPacket->DirectionY + i), Dz = _mm_load_ps(pPacket->DirectionZ + i);
+		__m128 CurrentT = _mm_load_ps(pPacket->T + i);
+
+		__m128 OCx = _mm_sub_ps(Ox, Cx), OCy = _mm_sub_ps(Oy, Cy), OCz = _mm_sub_ps(Oz, Cz);
+
+		__m128 A = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Dx, Dx), _mm_mul_ps(Dy, Dy)), _mm_mul_ps(Dz, Dz));
+		__m128 B = _mm_add_ps(_mm_add_ps(_mm_mul_ps(OCx, Dx), _mm_mul_ps(OCy, Dy)), _mm_mul_ps(OCz, Dz));
+		__m128 C = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(OCx, OCx), _mm_mul_ps(OCy, OCy)), _mm_mul_ps(OCz, OCz)), RR);
+		__m128 Discriminant = _mm_sub_ps(_mm_mul_ps(B, B), _mm_mul_ps(A, C));
+
+		__m128 T = _mm_div_ps(_mm_sub_ps(_mm_sub_ps(Zero, B), _mm_sqrt_ps(_mm_max_ps(Discriminant, Zero))), A);
+
+		__m128 Hit = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(Discriminant, Zero), _mm_cmpge_ps(T, _mm_load_ps(pPacket->TMin + i))), _mm_cmplt_ps(T, CurrentT));
+
+		if (_mm_movemask_ps(Hit) == 0)
+		{
+			continue;
+		}
+
+		__m128 Px = _mm_add_ps(Ox, _mm_mul_ps(T, Dx)), Py = _mm_add_ps(Oy, _mm_mul_ps(T, Dy)), Pz = _mm_add_ps(Oz, _mm_mul_ps(T, Dz));
+
+		_mm_store_ps(pPacket->T + i, BlendSSE(CurrentT, T, Hit));
+		_mm_store_ps(pPacket->PointX + i, BlendSSE(_mm_load_ps(pPacket->PointX + i), Px, Hit));
+		_mm_store_ps(pPacket->PointY + i, BlendSSE(_mm_load_ps(pPacket->PointY + i), Py, Hit));
+		_mm_store_ps(pPacket->PointZ + i, BlendSSE(_mm_load_ps(pPacket->PointZ + i), Pz, Hit));
+		_mm_store_ps(pPacket->NormalX + i, BlendSSE(_mm_load_ps(pPacket->NormalX + i), _mm_mul_ps(_mm_sub_ps(Px, Cx), InverseR), Hit));
+		_mm_store_ps(pPacket->NormalY + i, BlendSSE(_mm_load_ps(pPacket->NormalY + i), _mm_mul_ps(_mm_sub_ps(Py, Cy), InverseR), Hit));
+		_mm_store_ps(pPacket->NormalZ + i, BlendSSE(_mm_load_ps(pPacket->NormalZ + i), _mm_mul_ps(_mm_sub_ps(Pz, Cz), InverseR), Hit));
+		_mm_store_ps((float*)(pPacket->SphereIndex + i), BlendSSE(_mm_load_ps((const float*)(pPacket->SphereIndex + i)), Sphere, Hit));
+	}
+
+	IntersectRayPacketSphereTail(pPacket, i, RayCount, Center, Radius, SphereIndex);
+}
+
+// AVX2 kernels, 8 lanes.
+SPHERE_KERNEL_TARGET_AVX2 unsigned int IntersectRaySpheresAVX2(Float3 Origin, Float3 Direction, float TMin, float* pBestT, const SphereArraySoA& Spheres)
+{
+	const __m256 Ox = _mm256_set1_ps(Origin.x), Oy = _mm256_set1_ps(Origin.y), Oz = _mm256_set1_ps(Origin.z);
+	const __m256 Dx = _mm256_set1_ps(Direction.x), Dy = _mm256_set1_ps(Direction.y), Dz = _mm256_set1_ps(Direction.z);
+	const __m256 A = _mm256_set1_ps(Dot(Direction, Direction));
+	const __m256 MinT = _mm256_set1_ps(TMin);
+	const __m256 Zero = _mm256_setzero_ps();
+
+	__m256 BestT = _mm256_set1_ps(*pBestT);
+	__m256i BestIndex = _mm256_set1_epi32(-1);
+	__m256i Index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+	unsigned int i = 0;
+
+	for (; i + 8 <= Spheres.Count; i += 8)
+	{
+		__m256 OCx = _mm256_sub_ps(Ox, _mm256_loadu_ps(Spheres.CenterX + i));
+		__m256 OCy = _mm256_sub_ps(Oy, _mm256_loadu_ps(Spheres.CenterY + i));
+		__m256 OCz = _mm256_sub_ps(Oz, _mm256_loadu_ps(Spheres.CenterZ + i));
+		__m256 R = _mm256_loadu_ps(Spheres.Radius + i);
+
+		__m256 B = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(OCx, Dx), _mm256_mul_ps(OCy, Dy)), _mm256_mul_ps(OCz, Dz));
+		__m256 C = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(OCx, OCx), _mm256_mul_ps(OCy, OCy)), _mm256_mul_ps(OCz, OCz)), _mm256_mul_ps(R, R));
+		__m256 Discriminant = _mm256_sub_ps(_mm256_mul_ps(B, B), _mm256_mul_ps(A, C));
+
+		__m256 T = _mm256_div_ps(_mm256_sub_ps(_mm256_sub_ps(Zero, B), _mm256_sqrt_ps(_mm256_max_ps(Discriminant, Zero))), A);
+
+		__m256 Hit = _mm256_and_ps
+		(
+			_mm256_and_ps(_mm256_cmp_ps(Discriminant, Zero, _CMP_GE_OQ), _mm256_cmp_ps(T, MinT, _CMP_GE_OQ)),
+			_mm256_cmp_ps(T, BestT, _CMP_LT_OQ)
+		);
+
+		BestT = _mm256_blendv_ps(BestT, T, Hit);
+		BestIndex = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(BestIndex), _mm256_castsi256_ps(Index), Hit));
+		Index = _mm256_add_epi32(Index, _mm256_set1_epi32(8));
+	}
+
+	// Reduce the lanes down to the nearest hit.
+	alignas(32) float LaneT[8];
+	alignas(32) unsigned int LaneIndex[8];
+	_mm256_store_ps(LaneT, BestT);
+	_mm256_store_si256((__m256i*)LaneIndex, BestIndex);
+
+	unsigned int BestSphere{ ~0U };
+
+	for (unsigned int Lane = 0; Lane < 8; Lane++)
+	{
+		if (LaneIndex[Lane] != ~0U && (LaneT[Lane] < *pBestT || (LaneT[Lane] == *pBestT && LaneIndex[Lane] < BestSphere)))
+		{
+			*pBestT = LaneT[Lane];
+			BestSphere = LaneIndex[Lane];
+		}
+	}
+
+	IntersectRaySpheresTail(Origin, Direction, TMin, Spheres, i, pBestT, &BestSphere);
+
+	return BestSphere;
+}
+
+SPHERE_KERNEL_TARGET_AVX2 void IntersectRayPacketSphereAVX2(SphereRayPacket* pPacket, unsigned int RayCount, Float3 Center, float Radius, unsigned int SphereIndex)
+{
+	const __m256 Cx = _mm256_set1_ps(Center.x), Cy = _mm256_set1_ps(Center.y), Cz = _mm256_set1_ps(Center.z);
+	const __m256 RR = _mm256_set1_ps(Radius * Radius);
+	const __m256 InverseR = _mm256_set1_ps(1.0f / Radius);
+	const __m256 Zero = _mm256_setzero_ps();
+	const __m256 Sphere = _mm256_castsi256_ps(_mm256_set1_epi32((int)SphereIndex));
+
+	unsigned int i = 0;
+
+	for (; i + 8 <= RayCount; i += 8)
+	{
+		__m256 Ox = _mm256_load_ps(pPacket->OriginX + i), Oy = _mm256_load_ps(pPacket->OriginY + i), Oz = _mm256_load_ps(pPacket->OriginZ + i);
+		__m256 Dx = _mm256_load_ps(pPacket->DirectionX + i), Dy = _mm256_load_ps(pPacket->DirectionY + i), Dz = _mm256_load_ps(pPacket->DirectionZ + i);
+		__m256 CurrentT = _mm256_load_ps(pPacket->T + i);
+
+		__m256 OCx = _mm256_sub_ps(Ox, Cx), OCy = _mm256_sub_ps(Oy, Cy), OCz = _mm256_sub_ps(Oz, Cz);
+
+		__m256 A = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Dx, Dx), _mm256_mul_ps(Dy, Dy)), _mm256_mul_ps(Dz, Dz));
+		__m256 B = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(OCx, Dx), _mm256_mul_ps(OCy, Dy)), _mm256_mul_ps(OCz, Dz));
+		__m256 C = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(OCx, OCx), _mm256_mul_ps(OCy, OCy)), _mm256_mul_ps(OCz, OCz)), RR);
+		__m256 Discriminant = _mm256_sub_ps(_mm256_mul_ps(B, B), _mm256_mul_ps(A, C));
+
+		__m256 T = _mm256_div_ps(_mm256_sub_ps(_mm256_sub_ps(Zero, B), _mm256_sqrt_ps(_mm256_max_ps(Discriminant, Zero))), A);
+
+		__m256 Hit = _mm256_and_ps
+		(
+			_mm256_and_ps(_mm256_cmp_ps(Discriminant, Zero, _CMP_GE_OQ), _mm256_cmp_ps(T, _mm256_load_ps(pPacket->TMin + i), _CMP_GE_OQ)),
+			_mm256_cmp_ps(T, CurrentT, _CMP_LT_OQ)
+		);
+
+		if (_mm256_movemask_ps(Hit) == 0)
+		{
+			continue;
+		}
+
+		__m256 Px = _mm256_add_ps(Ox, _mm256_mul_ps(T, Dx)), Py = _mm256_add_ps(Oy, _mm256_mul_ps(T, Dy)), Pz = _mm256_add_ps(Oz, _mm256_mul_ps(T, Dz));
+
+		_mm256_store_ps(pPacket->T + i, _mm256_blendv_ps(CurrentT, T, Hit));
+		_mm256_store_ps(pPacket->PointX + i, _mm256_blendv_ps(_mm256_load_ps(pPacket->PointX + i), Px, Hit));
+		_mm256_store_ps(pPacket->PointY + i, _mm256_blendv_ps(_mm256_load_ps(pPacket->PointY + i), Py, Hit));
+		_mm256_store_ps(pPacket->PointZ + i, _mm256_blendv_ps(_mm256_load_ps(pPacket->PointZ + i), Pz, Hit));
+		_mm256_store_ps(pPacket->NormalX + i, _mm256_blendv_ps(_mm256_load_ps(pPacket->NormalX + i), _mm256_mul_ps(_mm256_sub_ps(Px, Cx), InverseR), Hit));
+		_mm256_store_ps(pPacket->NormalY + i, _mm256_blendv_ps(_mm256_load_ps(pPacket->NormalY + i), _mm256_mul_ps(_mm256_sub_ps(Py, Cy), InverseR), Hit));
+		_mm256_store_ps(pPacket->NormalZ + i, _mm256_blendv_ps(_mm256_load_ps(pPacket->NormalZ + i), _mm256_mul_ps(_mm256_sub_ps(Pz, Cz), InverseR), Hit));
+		_mm256_store_ps((float*)(pPacket->SphereIndex + i), _mm256_blendv_ps(_mm256_load_ps((const float*)(pPacket->SphereIndex + i)), Sphere, Hit));
+	}
+
+	IntersectRayPacketSphereTail(pPacket, i, RayCount, Center, Radius, SphereIndex);
+}
+
+// AVX-512 kernels, 16 lanes, using masked loads instead of a scalar tail.
+SPHERE_KERNEL_TARGET_AVX512 unsigned int IntersectRaySpheresAVX512(Float3 Origin, Float3 Direction, float TMin, float* pBestT, const SphereArraySoA& Spheres)
+{
+	const __m512 Ox = _mm512_set1_ps(Origin.x), Oy = _mm512_set1_ps(Origin.y), Oz = _mm512_set1_ps(Origin.z);
+	const __m512 Dx = _mm512_set1_ps(Direction.x), Dy = _mm512_set1_ps(Direction.y), Dz = _mm512_set1_ps(Direction.z);
+	const __m512 A = _mm512_set1_ps(Dot(Direction, Direction));
+	const __m512 MinT = _mm512_set1_ps(TMin);
+	const __m512 Zero = _mm512_setzero_ps();
+
+	__m512 BestT = _mm512_set1_ps(*pBestT);
+	__m512i BestIndex = _mm512_set1_epi32(-1);
+	__m512i Index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+	for (unsigned int i = 0; i < Spheres.Count; i += 16)
+	{
+		unsigned int Remaining = Spheres.Count - i;
+		__mmask16 Lanes = Remaining >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1U << Remaining) - 1U);
+
+		__m512 OCx = _mm512_sub_ps(Ox, _mm512_maskz_loadu_ps(Lanes, Spheres.CenterX + i));
+		__m512 OCy = _mm512_sub_ps(Oy, _mm512_maskz_loadu_ps(Lanes, Spheres.CenterY + i));
+		__m512 OCz = _mm512_sub_ps(Oz, _mm512_maskz_loadu_ps(Lanes, Spheres.CenterZ + i));
+		__m512 R = _mm512_maskz_loadu_ps(Lanes, Spheres.Radius + i);
+
+		__m512 B = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(OCx, Dx), _mm512_mul_ps(OCy, Dy)), _mm512_mul_ps(OCz, Dz));
+		__m512 C = _mm512_sub_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(OCx, OCx), _mm512_mul_ps(OCy, OCy)), _mm512_mul_ps(OCz, OCz)), _mm512_mul_ps(R, R));
+		__m512 Discriminant = _mm512_sub_ps(_mm512_mul_ps(B, B), _mm512_mul_ps(A, C));
+
+		__m512 T = _mm512_div_ps(_mm512_sub_ps(_mm512_sub_ps(Zero, B), _mm512_maskz_sqrt_ps(Lanes, _mm512_maskz_max_ps(Lanes, Discriminant, Zero))), A);
+
+		__mmask16 Hit = Lanes;
+		Hit = _mm512_mask_cmp_ps_mask(Hit, Discriminant, Zero, _CMP_GE_OQ);
+		Hit = _mm512_mask_cmp_ps_mask(Hit, T, MinT, _CMP_GE_OQ);
+		Hit = _mm512_mask_cmp_ps_mask(Hit, T, BestT, _CMP_LT_OQ);
+
+		BestT = _mm512_mask_blend_ps(Hit, BestT, T);
+		BestIndex = _mm512_mask_blend_epi32(Hit, BestIndex, Index);
+		Index = _mm512_add_epi32(Index, _mm512_set1_epi32(16));
+	}
+
+	// Reduce the lanes down to the nearest hit.
+	alignas(64) float LaneT[16];
+	alignas(64) unsigned int LaneIndex[16];
+	_mm512_store_ps(LaneT, BestT);
+	_mm512_store_si512((void*)LaneIndex, BestIndex);
+
+	unsigned int BestSphere{ ~0U };
+
+	for (unsigned int Lane = 0; Lane < 16; Lane++)
+	{
+		if (LaneIndex[Lane] != ~0U && (LaneT[Lane] < *pBestT || (LaneT[Lane] == *pBestT && LaneIndex[Lane] < BestSphere)))
+		{
+			*pBestT = LaneT[Lane];
+			BestSphere = LaneIndex[Lane];
+		}
+	}
+
+	return BestSphere;
+}
+
+SPHERE_KERNEL_TARGET_AVX512 void IntersectRayPacketSphereAVX512(SphereRayPacket* pPacket, unsigned int RayCount, Float3 Center, float Radius, unsigned int SphereIndex)
+{
+	const __m512 Cx = _mm512_set1_ps(Center.x), Cy = _mm512_set1_ps(Center.y), Cz = _mm512_set1_ps(Center.z);
+	const __m512 RR = _mm512_set1_ps(Radius * Radius);
+	const __m512 InverseR = _mm512_set1_ps(1.0f / Radius);
+	const __m512 Zero = _mm512_setzero_ps();
+
+	__mmask16 Lanes = RayCount >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1U << RayCount) - 1U);
+
+	__m512 Ox = _mm512_load_ps(pPacket->OriginX), Oy = _mm512_load_ps(pPacket->OriginY), Oz = _mm512_load_ps(pPacket->OriginZ);
+	__m512 Dx = _mm512_load_ps(pPacket->DirectionX), Dy = _mm512_load_ps(pPacket->DirectionY), Dz = _mm512_load_ps(pPacket->DirectionZ);
+	__m512 CurrentT = _mm512_load_ps(pPacket->T);
+
+	__m512 OCx = _mm512_sub_ps(Ox, Cx), OCy = _mm512_sub_ps(Oy, Cy), OCz = _mm512_sub_ps(Oz, Cz);
+
+	__m512 A = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(Dx, Dx), _mm512_mul_ps(Dy, Dy)), _mm512_mul_ps(Dz, Dz));
+	__m512 B = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(OCx, Dx), _mm512_mul_ps(OCy, Dy)), _mm512_mul_ps(OCz, Dz));
+	__m512 C = _mm512_sub_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(OCx, OCx), _mm512_mul_ps(OCy, OCy)), _mm512_mul_ps(OCz, OCz)), RR);
+	__m512 Discriminant = _mm512_sub_ps(_mm512_mul_ps(B, B), _mm512_mul_ps(A, C));
+
+	__m512 T = _mm512_div_ps(_mm512_sub_ps(_mm512_sub_ps(Zero, B), _mm512_maskz_sqrt_ps(Lanes, _mm512_maskz_max_ps(Lanes, Discriminant, Zero))), A);
+
+	__mmask16 Hit = Lanes;
+	Hit = _mm512_mask_cmp_ps_mask(Hit, Discriminant, Zero, _CMP_GE_OQ);
+	Hit = _mm512_mask_cmp_ps_mask(Hit, T, _mm512_load_ps(pPacket->TMin), _CMP_GE_OQ);
+	Hit = _mm512_mask_cmp_ps_mask(Hit, T, CurrentT, _CMP_LT_OQ);
+
+	if (Hit == 0)
+	{
+		return;
+	}
+
+	__m512 Px = _mm512_add_ps(Ox, _mm512_mul_ps(T, Dx)), Py = _mm512_add_ps(Oy, _mm512_mul_ps(T, Dy)), Pz = _mm512_add_ps(Oz, _mm512_mul_ps(T, Dz));
+
+	_mm512_mask_store_ps(pPacket->T, Hit, T);
+	_mm512_mask_store_ps(pPacket->PointX, Hit, Px);
+	_mm512_mask_store_ps(pPacket->PointY, Hit, Py);
+	_mm512_mask_store_ps(pPacket->PointZ, Hit, Pz);
+	_mm512_mask_store_ps(pPacket->NormalX, Hit, _mm512_mul_ps(_mm512_sub_ps(Px, Cx), InverseR));
+	_mm512_mask_store_ps(pPacket->NormalY, Hit, _mm512_mul_ps(_mm512_sub_ps(Py, Cy), InverseR));
+	_mm512_mask_store_ps(pPacket->NormalZ, Hit, _mm512_mul_ps(_mm512_sub_ps(Pz, Cz), InverseR));
+	_mm512_mask_store_epi32(pPacket->SphereIndex, Hit, _mm512_set1_epi32((int)SphereIndex));
+}
+
+#endif
+
+
+
+
+
+// Runtime selection.
+using IntersectRaySpheresFunction = unsigned int (*)(Float3, Float3, float, float*, const SphereArraySoA&);
+using IntersectRayPacketSphereFunction = void (*)(SphereRayPacket*, unsigned int, Float3, float, unsigned int);
+
+struct SphereKernelTable
+{
+	SPHERE_KERNEL_ISA isa;
+	IntersectRaySpheresFunction intersect_ray_spheres;
+	IntersectRayPacketSphereFunction intersect_ray_packet_sphere;
+};
+
+static SphereKernelTable SelectSphereKernels(SPHERE_KERNEL_ISA ISA)
+{
+	SPHERE_KERNEL_ISA Supported = GetSupportedSphereKernelISA();
+
+	if (ISA > Supported)
+	{
+		ISA = Supported;
+	}
+
+	switch (ISA)
+	{
+#if SPHERE_KERNELS_X64
+	case (SPHERE_KERNEL_ISA_AVX512):
+	{
+		return SphereKernelTable{ ISA, IntersectRaySpheresAVX512, IntersectRayPacketSphereAVX512 };
+	}
+
+	case (SPHERE_KERNEL_ISA_AVX2):
+	{
+		return SphereKernelTable{ ISA, IntersectRaySpheresAVX2, IntersectRayPacketSphereAVX2 };
+	}
+
+	case (SPHERE_KERNEL_ISA_SSE):
+	{
+		return SphereKernelTable{ ISA, IntersectRaySpheresSSE, IntersectRayPacketSphereSSE };
+	}
+#endif
+
+	default:
+	{
+		return SphereKernelTable{ SPHERE_KERNEL_ISA_SCALAR, IntersectRaySpheresScalar, IntersectRayPacketSphereScalar };
+	}
+	}
+}
+
+static SphereKernelTable& GetSphereKernelTable()
+{
+	static SphereKernelTable Table{ SelectSphereKernels(SPHERE_KERNEL_ISA_AVX512) };
+
+	return Table;
+}
+
+SPHERE_KERNEL_ISA GetSupportedSphereKernelISA()
+{
+#if SPHERE_KERNELS_X64
+#if defined(_MSC_VER)
+	int CPUInfo[4]{};
+
+	__cpuid(CPUInfo, 0);
+	int MaxLeaf = CPUInfo[0];
+
+	__cpuid(CPUInfo, 1);
+	bool OSXSAVE = (CPUInfo[2] & (1 << 27)) != 0;
+	bool AVX = (CPUInfo[2] & (1 << 28)) != 0;
+
+	if (!OSXSAVE || !AVX || MaxLeaf < 7)
+	{
+		return SPHERE_KERNEL_ISA_SSE;
+	}
+
+	// Make sure the OS saves the YMM (and ZMM) registers.
+	unsigned __int64 XCR0 = _xgetbv(0);
+
+	__cpuidex(CPUInfo, 7, 0);
+	bool AVX2 = (CPUInfo[1] & (1 << 5)) != 0;
+	bool AVX512F = (CPUInfo[1] & (1 << 16)) != 0;
+
+	if (AVX512F && ((XCR0 & 0xE6) == 0xE6))
+	{
+		return SPHERE_KERNEL_ISA_AVX512;
+	}
+
+	if (AVX2 && ((XCR0 & 0x6) == 0x6))
+	{
+		return SPHERE_KERNEL_ISA_AVX2;
+	}
+
+	return SPHERE_KERNEL_ISA_SSE;
+#else
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f"))
+	{
+		return SPHERE_KERNEL_ISA_AVX512;
+	}
+
+	if (__builtin_cpu_supports("avx2"))
+	{
+		return SPHERE_KERNEL_ISA_AVX2;
+	}
+
+	return SPHERE_KERNEL_ISA_SSE;
+#endif
+#else
+	return SPHERE_KERNEL_ISA_SCALAR;
+#endif
+}
+
+void SetSphereKernelISA(SPHERE_KERNEL_ISA ISA)
+{
+	GetSphereKernelTable() = SelectSphereKernels(ISA);
+}
+
+SPHERE_KERNEL_ISA GetSphereKernelISA()
+{
+	return GetSphereKernelTable().isa;
+}
+
+const char* GetSphereKernelISAName(SPHERE_KERNEL_ISA ISA)
+{
+	switch (ISA)
+	{
+	case (SPHERE_KERNEL_ISA_SSE): return "SSE";
+	case (SPHERE_KERNEL_ISA_AVX2): return "AVX2";
+	case (SPHERE_KERNEL_ISA_AVX512): return "AVX-512";
+	default: return "Scalar";
+	}
+}
+
+bool IntersectRaySpheres
+(
+	Float3 Origin,
+	Float3 Direction,
+	float TMin,
+	float TMax,
+	const SphereArraySoA& Spheres,
+	SphereIntersection* pHit
+)
+{
+	float BestT{ TMax };
+
+	unsigned int BestSphere = GetSphereKernelTable().intersect_ray_spheres(Origin, Direction, TMin, &BestT, Spheres);
+
+	if (BestSphere == ~0U)
+	{
+		return false;
+	}
+
+	Float3 Center{ Spheres.CenterX[BestSphere], Spheres.CenterY[BestSphere], Spheres.CenterZ[BestSphere] };
+
+	CompleteSphereHit(Origin, Direction, Center, Spheres.Radius[BestSphere], BestT, BestSphere, pHit);
+
+	return true;
+}
+
+void IntersectRayPacketSphere
+(
+	SphereRayPacket* pPacket,
+	unsigned int RayCount,
+	Float3 Center,
+	float Radius,
+	unsigned int SphereIndex
+)
+{
+	GetSphereKernelTable().intersect_ray_packet_sphere(pPacket, RayCount, Center, Radius, SphereIndex);
+}
@@ -0,0 +1,110 @@
+// CPUSphereKernels.hpp - SIMD ray-sphere intersection kernels, with SSE/AVX2/AVX-512 paths chosen at runtime.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include "CPUShaderStuff.hpp"
+
+// Instruction sets the sphere kernels can run with.
+enum SPHERE_KERNEL_ISA
+{
+	SPHERE_KERNEL_ISA_SCALAR = 0,
+	SPHERE_KERNEL_ISA_SSE = 1,
+	SPHERE_KERNEL_ISA_AVX2 = 2,
+	SPHERE_KERNEL_ISA_AVX512 = 3
+};
+
+// Maximum number of rays in a SphereRayPacket, one per AVX-512 lane.
+const unsigned int SphereKernelMaxPacketSize{ 16 };
+
+// Spheres, in structure-of-arrays layout.
+struct SphereArraySoA
+{
+	const float* CenterX;
+	const float* CenterY;
+	const float* CenterZ;
+	const float* Radius;
+
+	unsigned int Count;
+};
+
+// Nearest intersection of one ray against a set of spheres.
+struct SphereIntersection
+{
+	// Distance along the ray.
+	float T;
+
+	// Intersection point and unit surface normal, in the spheres' space.
+	Float3 Point;
+	Float3 Normal;
+
+	// Index of the sphere that was hit.
+	unsigned int SphereIndex;
+};
+
+// Packet of rays in structure-of-arrays layout, each lane tracking its own nearest intersection.
+struct alignas(64) SphereRayPacket
+{
+	float OriginX[SphereKernelMaxPacketSize];
+	float OriginY[SphereKernelMaxPacketSize];
+	float OriginZ[SphereKernelMaxPacketSize];
+
+	float DirectionX[SphereKernelMaxPacketSize];
+	float DirectionY[SphereKernelMaxPacketSize];
+	float DirectionZ[SphereKernelMaxPacketSize];
+
+	float TMin[SphereKernelMaxPacketSize];
+
+	// TMax on input, distance to the nearest intersection on output.
+	float T[SphereKernelMaxPacketSize];
+
+	// Intersection point and unit surface normal of the nearest intersection.
+	float PointX[SphereKernelMaxPacketSize];
+	float PointY[SphereKernelMaxPacketSize];
+	float PointZ[SphereKernelMaxPacketSize];
+
+	float NormalX[SphereKernelMaxPacketSize];
+	float NormalY[SphereKernelMaxPacketSize];
+	float NormalZ[SphereKernelMaxPacketSize];
+
+	// Index of the nearest sphere hit so far. Left untouched for lanes that hit nothing.
+	unsigned int SphereIndex[SphereKernelMaxPacketSize];
+};
+
+// Returns the widest instruction set the running CPU supports.
+SPHERE_KERNEL_ISA GetSupportedSphereKernelISA();
+
+// Selects the instruction set for the kernels below. Falls back to the widest supported one if the requested one is unavailable.
+// NOTE: Not thread-safe; select the instruction set before dispatching any work.
+void SetSphereKernelISA(SPHERE_KERNEL_ISA ISA);
+
+// Returns the instruction set currently used by the kernels below. Defaults to GetSupportedSphereKernelISA().
+SPHERE_KERNEL_ISA GetSphereKernelISA();
+
+// Returns a printable name for an instruction set.
+const char* GetSphereKernelISAName(SPHERE_KERNEL_ISA ISA);
+
+// Tests one ray against every sphere in the array, 4/8/16 spheres at a time.
+// Returns true and fills out pHit with the nearest intersection in [TMin, TMax), using the near root of each sphere.
+bool IntersectRaySpheres
+(
+	Float3 Origin,
+	Float3 Direction,
+	float TMin,
+	float TMax,
+	const SphereArraySoA& Spheres,
+	SphereIntersection* pHit
+);
+
+// Tests up to SphereKernelMaxPacketSize rays against one sphere, 4/8/16 rays at a time.
+// Lanes whose near root lies in [TMin, T) get their T, point, normal and sphere index updated.
+void IntersectRayPacketSphere
+(
+	SphereRayPacket* pPacket,
+	unsigned int RayCount,
+	Float3 Center,
+	float Radius,
+	unsigned int SphereIndex
+);
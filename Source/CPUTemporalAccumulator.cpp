@@ -0,0 +1,261 @@
+// CPUTemporalAccumulator.cpp - Reprojection of the previous frames' colors into the current one, for accumulating samples across camera motion on the CPU backend.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include "CPUTemporalAccumulator.hpp"
+#include "CPUShaderStuff.hpp"
+#include "CPUDXR.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+// Rows per task, when running on the pool.
+const unsigned int TemporalRowGrain{ 8 };
+
+// History whose matching bilinear taps add up to less than this weight is dropped, rather than renormalized: those taps are mostly other pixels' surfaces.
+const float TemporalMinTapWeight{ 0.01f };
+
+CPUTemporalAccumulator::CPUTemporalAccumulator
+() :
+	InitConfig{},
+	Config{}
+{
+	this->Config.previous_index = 0;
+	this->Config.previous_camera_to_world = SceneFloat4x4{};
+	this->Config.has_history = false;
+	this->Config.reprojected_pixel_count = 0;
+	this->Config.accumulate_seconds = 0.0;
+	this->Config.name = "CPUTemporalAccumulator";
+	this->Config.error_message = "CPUTemporalAccumulator.Initialize() failed.";
+
+	this->InitConfig.pixel_width = 0;
+	this->InitConfig.pixel_height = 0;
+	this->InitConfig.min_blend_factor = 0.05f;
+	this->InitConfig.depth_tolerance = 0.1f;
+	this->InitConfig.normal_tolerance = 0.1f;
+	this->InitConfig.ptr_thread_pool = nullptr;
+}
+
+void CPUTemporalAccumulator::Initialize
+()
+{
+	CPUDXR::FailCheck
+	(
+		(this->InitConfig.pixel_width > 0) && (this->InitConfig.pixel_height > 0) && (this->InitConfig.min_blend_factor > 0.0f) && (this->InitConfig.min_blend_factor <= 1.0f),
+		this->Config.error_message,
+		this->Config.name
+	);
+
+	size_t PixelCount = (size_t)this->InitConfig.pixel_width * this->InitConfig.pixel_height;
+
+	for (unsigned int i = 0; i < 2; i++)
+	{
+		this->Config.history_colors[i].assign(PixelCount * 4, 0.0f);
+		this->Config.history_guides[i].assign(PixelCount * 4, 0.0f);
+	}
+
+	this->Reset();
+}
+
+void CPUTemporalAccumulator::Accumulate
+(
+	const InlineConstantBuffer& Constants,
+	float* pColorSums,
+	const float* pGuideSums,
+	const float* pAlbedoSums,
+	unsigned char* pRenderTarget
+)
+{
+	auto StartTime = std::chrono::steady_clock::now();
+
+	unsigned int Width = this->InitConfig.pixel_width;
+	unsigned int Height = this->InitConfig.pixel_height;
+
+	const float* pPreviousColors = this->Config.history_colors[this->Config.previous_index].data();
+	const float* pPreviousGuides = this->Config.history_guides[this->Config.previous_index].data();
+	float* pCurrentColors = this->Config.history_colors[1 - this->Config.previous_index].data();
+	float* pCurrentGuides = this->Config.history_guides[1 - this->Config.previous_index].data();
+
+	bool HasHistory = this->Config.has_history;
+
+	// Camera of the previous frame, and the scale from its Camera-Space to its pixels. (The inverse of GetWorldPointPosition().)
+	const float(&Previous)[4][4] = this->Config.previous_camera_to_world.m;
+
+	Float3 PreviousRight{ Previous[0][0], Previous[0][1], Previous[0][2] };
+	Float3 PreviousUp{ Previous[1][0], Previous[1][1], Previous[1][2] };
+	Float3 PreviousForward{ Previous[2][0], Previous[2][1], Previous[2][2] };
+	Float3 PreviousPosition{ Previous[3][0], Previous[3][1], Previous[3][2] };
+
+	float TanHalfFoV = std::tan(Constants.VertFoVRad / 2.0f);
+	float AspectRatio = (float)Width / (float)Height;
+
+	Float3 CameraPosition = GetWorldCameraPosition(Constants.CameraToWorld);
+
+	std::atomic<unsigned int> ReprojectedPixelCount{ 0 };
+
+	this->ForEachRow(Height, [&](unsigned int Begin, unsigned int End)
+	{
+		unsigned int RowReprojectedPixelCount{ 0 };
+
+		for (unsigned int y = Begin; y < End; y++)
+		{
+			for (unsigned int x = 0; x < Width; x++)
+			{
+				size_t i = ((size_t)y * Width + x) * 4;
+
+				float SampleCount = std::max(pAlbedoSums[i + 3], 1.0f);
+
+				Float3 Color = Float3{ pColorSums[i + 0], pColorSums[i + 1], pColorSums[i + 2] } / SampleCount;
+				Float3 Normal = Float3{ pGuideSums[i + 0], pGuideSums[i + 1], pGuideSums[i + 2] } / SampleCount;
+				float Depth = pGuideSums[i + 3] / SampleCount;
+
+				// Where the first hit seen through the middle of the pixel was, and where that point was on the previous frame's screen.
+				Float3 Direction = Normalize(GetWorldPointPosition(Constants.CameraToWorld, UInt2{ Width, Height }, UInt2{ x, y }, Float2{ 0.5f, 0.5f }, Constants.VertFoVRad) - CameraPosition);
+				Float3 WorldPosition = CameraPosition + (Depth * Direction);
+
+				Float3 PreviousOffset = WorldPosition - PreviousPosition;
+				float PreviousDepth = std::sqrt(Dot(PreviousOffset, PreviousOffset));
+				float PreviousZ = Dot(PreviousOffset, PreviousForward);
+
+				Float3 HistoryColor{ 0.0f, 0.0f, 0.0f };
+				float HistorySampleCount{ 0.0f };
+
+				if (HasHistory == true && PreviousZ > 0.0f)
+				{
+					float u = ((Dot(PreviousOffset, PreviousRight) / (PreviousZ * AspectRatio * TanHalfFoV)) + 1.0f) * 0.5f;
+					float v = (1.0f - (Dot(PreviousOffset, PreviousUp) / (PreviousZ * TanHalfFoV))) * 0.5f;
+
+					// Bilinear taps around the reprojected point, each one kept only if it saw the same surface.
+					float px = (u * (float)Width) - 0.5f;
+					float py = (v * (float)Height) - 0.5f;
+					float x0 = std::floor(px);
+					float y0 = std::floor(py);
+					float fx = px - x0;
+					float fy = py - y0;
+
+					float WeightSum{ 0.0f };
+
+					for (unsigned int Tap = 0; Tap < 4; Tap++)
+					{
+						int tx = (int)x0 + (int)(Tap & 1);
+						int ty = (int)y0 + (int)(Tap >> 1);
+
+						if (tx < 0 || ty < 0 || tx >= (int)Width || ty >= (int)Height)
+						{
+							continue;
+						}
+
+						size_t j = ((size_t)ty * Width + tx) * 4;
+
+						Float3 NormalDelta = Float3{ pPreviousGuides[j + 0], pPreviousGuides[j + 1], pPreviousGuides[j + 2] } - Normal;
+
+						if (std::fabs(pPreviousGuides[j + 3] - PreviousDepth) > this->InitConfig.depth_tolerance * PreviousDepth || Dot(NormalDelta, NormalDelta) > this->InitConfig.normal_tolerance)
+						{
+							continue;
+						}
+
+						float Weight = ((Tap & 1) != 0 ? fx : 1.0f - fx) * ((Tap >> 1) != 0 ? fy : 1.0f - fy);
+
+						HistoryColor = HistoryColor + (Weight * Float3{ pPreviousColors[j + 0], pPreviousColors[j + 1], pPreviousColors[j + 2] });
+						HistorySampleCount += Weight * pPreviousColors[j + 3];
+						WeightSum += Weight;
+					}
+
+					if (WeightSum >= TemporalMinTapWeight)
+					{
+						HistoryColor = HistoryColor / WeightSum;
+						HistorySampleCount = HistorySampleCount / WeightSum;
+						RowReprojectedPixelCount++;
+					}
+					else
+					{
+						HistoryColor = Float3{ 0.0f, 0.0f, 0.0f };
+						HistorySampleCount = 0.0f;
+					}
+				}
+
+				// Weight the frames by their sample counts, down to min_blend_factor for the current one.
+				float BlendFactor = std::max(SampleCount / (HistorySampleCount + SampleCount), this->InitConfig.min_blend_factor);
+
+				Color = HistoryColor + (BlendFactor * (Color - HistoryColor));
+
+				pCurrentColors[i + 0] = Color.x;
+				pCurrentColors[i + 1] = Color.y;
+				pCurrentColors[i + 2] = Color.z;
+				pCurrentColors[i + 3] = SampleCount / BlendFactor;
+
+				pCurrentGuides[i + 0] = Normal.x;
+				pCurrentGuides[i + 1] = Normal.y;
+				pCurrentGuides[i + 2] = Normal.z;
+				pCurrentGuides[i + 3] = Depth;
+
+				pColorSums[i + 0] = Color.x * SampleCount;
+				pColorSums[i + 1] = Color.y * SampleCount;
+				pColorSums[i + 2] = Color.z * SampleCount;
+
+				// Same float-to-UNORM conversion as the ray generation shader's.
+				float Channels[4]{ Color.x, Color.y, Color.z, 0.0f };
+
+				for (unsigned int Channel = 0; Channel < 4; Channel++)
+				{
+					float Saturated = Channels[Channel] < 0.0f ? 0.0f : (Channels[Channel] > 1.0f ? 1.0f : Channels[Channel]);
+
+					pRenderTarget[i + Channel] = (unsigned char)(Saturated * 255.0f + 0.5f);
+				}
+			}
+		}
+
+		ReprojectedPixelCount += RowReprojectedPixelCount;
+	});
+
+	this->Config.previous_index = 1 - this->Config.previous_index;
+	this->Config.previous_camera_to_world = Constants.CameraToWorld;
+	this->Config.has_history = true;
+	this->Config.reprojected_pixel_count = ReprojectedPixelCount;
+
+	this->Config.accumulate_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+}
+
+void CPUTemporalAccumulator::Reset
+()
+{
+	this->Config.has_history = false;
+	this->Config.reprojected_pixel_count = 0;
+}
+
+unsigned int CPUTemporalAccumulator::GetReprojectedPixelCount
+() const
+{
+	return this->Config.reprojected_pixel_count;
+}
+
+double CPUTemporalAccumulator::GetAccumulateSeconds
+() const
+{
+	return this->Config.accumulate_seconds;
+}
+
+void CPUTemporalAccumulator::ForEachRow
+(
+	unsigned int Count,
+	const std::function<void(unsigned int Begin, unsigned int End)>& Function
+)
+{
+	if (this->InitConfig.ptr_thread_pool != nullptr)
+	{
+		this->InitConfig.ptr_thread_pool->ParallelFor(Count, TemporalRowGrain, Function);
+	}
+	else
+	{
+		Function(0, Count);
+	}
+}
+
+CPUTemporalAccumulator::~CPUTemporalAccumulator
+()
+{
+	// Nothing here, for now.
+}
@@ -0,0 +1,103 @@
+// CPUTemporalAccumulator.hpp - Reprojection of the previous frames' colors into the current one, for accumulating samples across camera motion on the CPU backend.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "SceneDescription.hpp"
+#include "CPUWorkStealingPool.hpp"
+
+// Config data for this class.
+struct CPUTemporalAccumulatorConfig
+{
+	// Accumulated colors (xyz) and the number of samples they stand for (w), of the previous frame and of the current one, in R32G32B32A32_FLOAT format.
+	std::vector<float> history_colors[2];
+
+	// First-hit normals (xyz) and distances from the camera (w) of the previous frame and of the current one, for rejecting history that got disoccluded.
+	std::vector<float> history_guides[2];
+
+	// Which of the two buffers above holds the previous frame.
+	unsigned int previous_index;
+
+	// Camera of the previous frame, and whether there is a previous frame at all.
+	SceneFloat4x4 previous_camera_to_world;
+	bool has_history;
+
+	// Number of pixels of the last frame that found any history to blend with.
+	unsigned int reprojected_pixel_count;
+
+	// Time the last Accumulate() call took.
+	double accumulate_seconds;
+
+	// Label for this class.
+	const char* name;
+
+	// Error message for initialization.
+	const char* error_message;
+};
+
+// Populate this before calling the initializer function.
+struct CPUTemporalAccumulatorInitConfig
+{
+	// Desired number of pixels along each dimension.
+	unsigned int pixel_width;
+	unsigned int pixel_height;
+
+	// Smallest weight the current frame gets in the blend. Until the history holds (1 / min_blend_factor - 1) times the samples of a frame, frames are weighted by their sample counts, as if they had been traced together.
+	// After that, older frames fade out exponentially, so that lighting that changes (moving spheres, or history that survived reprojection but shouldn't have) catches up.
+	float min_blend_factor;
+
+	// History gets rejected where its distance from the camera differs from the reprojected point's by more than this fraction of it...
+	float depth_tolerance;
+
+	// ...or where its normal is further than this squared distance from the current one. (0.1 is a difference of about 18 degrees.)
+	float normal_tolerance;
+
+	// Pool to process rows of the image in parallel on. Runs on the calling thread alone if nullptr.
+	CPUWorkStealingPool* ptr_thread_pool;
+};
+
+// Keeps the colors, first-hit normals and depths of the previous frame, along with its camera, and blends them into each new frame:
+// every pixel is traced back to where its first hit was in the previous frame, and the history there gets bilinearly resampled from the taps whose depth and normal still match.
+// Pixels that see something the previous frame didn't (disocclusions) start over from the current frame's samples.
+class CPUTemporalAccumulator
+{
+public:
+	// Constructor.
+	CPUTemporalAccumulator();
+
+	// Populate this before calling the initializer function.
+	CPUTemporalAccumulatorInitConfig InitConfig;
+
+	// Initializes the instance of this class.
+	// Allocates the history.
+	void Initialize();
+
+	// Blends the frame described by Constants into the history, and replaces its color sums with the result (scaled by each pixel's sample count), so that a denoiser run afterwards sees it too.
+	// The buffers are laid out like CPUShaderResources' AccumulationBuffer, GuideBuffer and AlbedoBuffer. Also writes the result into the R8G8B8A8_UNORM render target.
+	void Accumulate(const InlineConstantBuffer& Constants, float* pColorSums, const float* pGuideSums, const float* pAlbedoSums, unsigned char* pRenderTarget);
+
+	// Forgets the history, for when the next frame has nothing in common with the last one.
+	void Reset();
+
+	// Returns the number of pixels of the last frame that found any history to blend with.
+	unsigned int GetReprojectedPixelCount() const;
+
+	// Returns the time the last Accumulate() call took.
+	double GetAccumulateSeconds() const;
+
+	// Destructor.
+	~CPUTemporalAccumulator();
+
+protected:
+	// Config data for this object.
+	CPUTemporalAccumulatorConfig Config;
+
+	// Runs Function(Begin, End) over the rows [0, Count), on the pool if there is one.
+	void ForEachRow(unsigned int Count, const std::function<void(unsigned int Begin, unsigned int End)>& Function);
+
+};
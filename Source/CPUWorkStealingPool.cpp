@@ -0,0 +1,480 @@
+// CPUWorkStealingPool.cpp - Work-stealing task pool, for the parallel parts of the CPU rendering path.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include "CPUWorkStealingPool.hpp"
+
+#include <chrono>
+#include <thread>
+
+// The pool and worker the current thread is running tasks for, if any.
+thread_local CPUWorkStealingPool* CurrentPool{ nullptr };
+thread_local unsigned int CurrentWorkerIndex{ 0 };
+
+CPUWorkStealingPool::CPUWorkStealingPool
+() :
+	InitConfig{},
+	Config{}
+{
+	this->Config.outstanding_tasks = 0;
+	this->Config.queued_tasks = 0;
+	this->Config.job_index = 0;
+	this->Config.stopping = false;
+	this->Config.busy_workers = 0;
+	this->Config.sleeping_workers = 0;
+	this->Config.thread_count = 1;
+	this->Config.name = "CPUWorkStealingPool";
+	this->Config.error_message = "CPUWorkStealingPool.Initialize() failed.";
+
+	this->InitConfig.thread_count = 0;
+}
+
+void CPUWorkStealingPool::Initialize
+()
+{
+	this->StopThreads();
+
+	this->Config.thread_count = this->InitConfig.thread_count;
+
+	if (this->Config.thread_count == 0)
+	{
+		this->Config.thread_count = std::thread::hardware_concurrency();
+	}
+
+	if (this->Config.thread_count == 0)
+	{
+		this->Config.thread_count = 1;
+	}
+
+	this->Config.queues.clear();
+
+	for (unsigned int i = 0; i < this->Config.thread_count; i++)
+	{
+		this->Config.queues.push_back(std::make_unique<PoolWorkerQueue>());
+	}
+
+	this->Config.statistics.assign(this->Config.thread_count, PoolWorkerStatistics{});
+
+	// The calling thread is worker 0, so only the others get threads of their own.
+	for (unsigned int i = 1; i < this->Config.thread_count; i++)
+	{
+		this->Config.threads.emplace_back(&CPUWorkStealingPool::WorkerThread, this, i);
+	}
+}
+
+void CPUWorkStealingPool::Run
+(
+	const std::function<void()>& RootTask
+)
+{
+	// Already inside of Run(), so just run it as part of the current task tree.
+	if (CurrentPool == this)
+	{
+		RootTask();
+		return;
+	}
+
+	this->Config.outstanding_tasks = 1;
+	this->Config.queued_tasks = 1;
+	this->Config.queues[0]->tasks.push_back(PoolTask{ RootTask, nullptr });
+
+	this->RunQueuedTasks();
+}
+
+void CPUWorkStealingPool::Spawn
+(
+	std::function<void()> Task,
+	std::atomic<unsigned int>* pGroupCounter
+)
+{
+	if (CurrentPool != this)
+	{
+		Task();
+		return;
+	}
+
+	if (pGroupCounter != nullptr)
+	{
+		pGroupCounter->fetch_add(1);
+	}
+
+	this->Config.outstanding_tasks.fetch_add(1);
+
+	PoolWorkerQueue& Queue = *(this->Config.queues[CurrentWorkerIndex]);
+
+	unsigned int QueuedTaskCount{};
+
+	{
+		std::lock_guard<std::mutex> Lock{ Queue.mutex };
+		Queue.tasks.push_back(PoolTask{ std::move(Task), pGroupCounter });
+		QueuedTaskCount = this->Config.queued_tasks.fetch_add(1);
+	}
+
+	// Only the first queued task wakes a sleeping worker. Whoever takes a task wakes the next one while there are more, so that spawning a loop's chunks doesn't wake a worker per chunk.
+	if (QueuedTaskCount == 0)
+	{
+		this->WakeSleepingWorkers(false);
+	}
+}
+
+void CPUWorkStealingPool::Wait
+(
+	std::atomic<unsigned int>* pGroupCounter
+)
+{
+	while (pGroupCounter->load() > 0)
+	{
+		PoolTask Task{};
+
+		if (CurrentPool != this)
+		{
+			std::this_thread::yield();
+		}
+		else if (this->FindTask(CurrentWorkerIndex, &Task) == true)
+		{
+			this->ExecuteTask(CurrentWorkerIndex, Task);
+		}
+		else
+		{
+			this->SleepUntilTaskOrZero(pGroupCounter);
+		}
+	}
+}
+
+void CPUWorkStealingPool::ParallelFor
+(
+	unsigned int Count,
+	unsigned int Grain,
+	const std::function<void(unsigned int Begin, unsigned int End)>& Function
+)
+{
+	if (Grain == 0)
+	{
+		Grain = 1;
+	}
+
+	auto RunChunks = [&]()
+	{
+		std::atomic<unsigned int> GroupCounter{ 0 };
+
+		for (unsigned int Begin = Grain; Begin < Count; Begin += Grain)
+		{
+			unsigned int End = Count - Begin < Grain ? Count : Begin + Grain;
+
+			this->Spawn([&Function, Begin, End]() { Function(Begin, End); }, &GroupCounter);
+		}
+
+		// Do the first chunk here, then help with the rest.
+		Function(0, Count < Grain ? Count : Grain);
+
+		this->Wait(&GroupCounter);
+	};
+
+	if (CurrentPool == this)
+	{
+		RunChunks();
+	}
+	else
+	{
+		this->Run(RunChunks);
+	}
+}
+
+void CPUWorkStealingPool::DistributedFor
+(
+	unsigned int Count,
+	unsigned int Grain,
+	const std::function<void(unsigned int Begin, unsigned int End)>& Function
+)
+{
+	if (CurrentPool == this)
+	{
+		this->ParallelFor(Count, Grain, Function);
+		return;
+	}
+
+	if (Grain == 0)
+	{
+		Grain = 1;
+	}
+
+	unsigned int ChunkCount = (Count + Grain - 1) / Grain;
+
+	if (ChunkCount == 0)
+	{
+		return;
+	}
+
+	this->Config.outstanding_tasks = ChunkCount;
+	this->Config.queued_tasks = ChunkCount;
+
+	for (unsigned int i = 0; i < this->Config.thread_count; i++)
+	{
+		unsigned int FirstChunk = (unsigned int)(((unsigned long long)ChunkCount * i) / this->Config.thread_count);
+		unsigned int EndChunk = (unsigned int)(((unsigned long long)ChunkCount * (i + 1)) / this->Config.thread_count);
+
+		// Queued back to front, since the owner pops from the back.
+		for (unsigned int Chunk = EndChunk; Chunk > FirstChunk; Chunk--)
+		{
+			unsigned int Begin = (Chunk - 1) * Grain;
+			unsigned int End = Count - Begin < Grain ? Count : Begin + Grain;
+
+			this->Config.queues[i]->tasks.push_back(PoolTask{ [&Function, Begin, End]() { Function(Begin, End); }, nullptr });
+		}
+	}
+
+	this->RunQueuedTasks();
+}
+
+unsigned int CPUWorkStealingPool::GetThreadCount
+() const
+{
+	return this->Config.thread_count;
+}
+
+unsigned int CPUWorkStealingPool::GetCurrentWorkerIndex
+() const
+{
+	return CurrentPool == this ? CurrentWorkerIndex : 0;
+}
+
+const std::vector<PoolWorkerStatistics>& CPUWorkStealingPool::GetStatistics
+() const
+{
+	return this->Config.statistics;
+}
+
+CPUWorkStealingPool::~CPUWorkStealingPool
+()
+{
+	this->StopThreads();
+}
+
+bool CPUWorkStealingPool::FindTask
+(
+	unsigned int WorkerIndex,
+	PoolTask* pTask
+)
+{
+	unsigned int QueuedTaskCount{ 0 };
+
+	// Newest task of our own first, to stay depth-first and cache-warm.
+	{
+		PoolWorkerQueue& Queue = *(this->Config.queues[WorkerIndex]);
+
+		std::lock_guard<std::mutex> Lock{ Queue.mutex };
+
+		if (Queue.tasks.empty() == false)
+		{
+			*pTask = std::move(Queue.tasks.back());
+			Queue.tasks.pop_back();
+			QueuedTaskCount = this->Config.queued_tasks.fetch_sub(1);
+		}
+	}
+
+	// Then the oldest task of someone else, which tends to be the biggest.
+	for (unsigned int i = 1; i < this->Config.thread_count && QueuedTaskCount == 0; i++)
+	{
+		PoolWorkerQueue& Queue = *(this->Config.queues[(WorkerIndex + i) % this->Config.thread_count]);
+
+		std::lock_guard<std::mutex> Lock{ Queue.mutex };
+
+		if (Queue.tasks.empty() == false)
+		{
+			*pTask = std::move(Queue.tasks.front());
+			Queue.tasks.pop_front();
+			QueuedTaskCount = this->Config.queued_tasks.fetch_sub(1);
+
+			this->Config.statistics[WorkerIndex].tasks_stolen++;
+		}
+	}
+
+	// Pass the wake-up on, if there are tasks left for a sleeping worker.
+	if (QueuedTaskCount > 1)
+	{
+		this->WakeSleepingWorkers(false);
+	}
+
+	return QueuedTaskCount > 0;
+}
+
+void CPUWorkStealingPool::ExecuteTask
+(
+	unsigned int WorkerIndex,
+	PoolTask& Task
+)
+{
+	Task.function();
+
+	this->Config.statistics[WorkerIndex].tasks_executed++;
+
+	// Whoever waits on a counter that drops to 0 may be asleep.
+	bool CounterReachedZero{ false };
+
+	if (Task.ptr_group_counter != nullptr && Task.ptr_group_counter->fetch_sub(1) == 1)
+	{
+		CounterReachedZero = true;
+	}
+
+	if (this->Config.outstanding_tasks.fetch_sub(1) == 1)
+	{
+		CounterReachedZero = true;
+	}
+
+	if (CounterReachedZero == true)
+	{
+		this->WakeSleepingWorkers(true);
+	}
+}
+
+void CPUWorkStealingPool::RunQueuedTasks
+()
+{
+	auto StartTime = std::chrono::steady_clock::now();
+
+	this->Config.statistics.assign(this->Config.thread_count, PoolWorkerStatistics{});
+
+	{
+		std::lock_guard<std::mutex> Lock{ this->Config.wake_mutex };
+		this->Config.busy_workers = this->Config.thread_count - 1;
+		this->Config.job_index++;
+	}
+
+	this->Config.wake_condition.notify_all();
+
+	this->RunWorker(0);
+
+	{
+		std::unique_lock<std::mutex> Lock{ this->Config.wake_mutex };
+		this->Config.done_condition.wait(Lock, [this]() { return this->Config.busy_workers == 0; });
+	}
+
+	double RunSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+	for (PoolWorkerStatistics& Statistics : this->Config.statistics)
+	{
+		Statistics.idle_seconds = RunSeconds > Statistics.busy_seconds ? RunSeconds - Statistics.busy_seconds : 0.0;
+	}
+}
+
+void CPUWorkStealingPool::RunWorker
+(
+	unsigned int WorkerIndex
+)
+{
+	CurrentPool = this;
+	CurrentWorkerIndex = WorkerIndex;
+
+	double BusySeconds{ 0.0 };
+
+	while (this->Config.outstanding_tasks.load() > 0)
+	{
+		PoolTask Task{};
+
+		if (this->FindTask(WorkerIndex, &Task) == true)
+		{
+			auto TaskStartTime = std::chrono::steady_clock::now();
+
+			this->ExecuteTask(WorkerIndex, Task);
+
+			BusySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - TaskStartTime).count();
+		}
+		else
+		{
+			this->SleepUntilTaskOrZero(&(this->Config.outstanding_tasks));
+		}
+	}
+
+	this->Config.statistics[WorkerIndex].busy_seconds = BusySeconds;
+
+	CurrentPool = nullptr;
+	CurrentWorkerIndex = 0;
+}
+
+void CPUWorkStealingPool::WorkerThread
+(
+	unsigned int WorkerIndex
+)
+{
+	unsigned long long LastJobIndex{ 0 };
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> Lock{ this->Config.wake_mutex };
+			this->Config.wake_condition.wait(Lock, [&]() { return this->Config.stopping == true || this->Config.job_index != LastJobIndex; });
+
+			if (this->Config.stopping == true)
+			{
+				return;
+			}
+
+			LastJobIndex = this->Config.job_index;
+		}
+
+		this->RunWorker(WorkerIndex);
+
+		std::lock_guard<std::mutex> Lock{ this->Config.wake_mutex };
+
+		if (--(this->Config.busy_workers) == 0)
+		{
+			this->Config.done_condition.notify_one();
+		}
+	}
+}
+
+void CPUWorkStealingPool::SleepUntilTaskOrZero
+(
+	const std::atomic<unsigned int>* pCounter
+)
+{
+	std::unique_lock<std::mutex> Lock{ this->Config.task_mutex };
+
+	// Counted before checking, so that whoever queues a task or zeroes the counter after the check knows to notify.
+	this->Config.sleeping_workers.fetch_add(1);
+	this->Config.task_condition.wait(Lock, [&]() { return this->Config.queued_tasks.load() > 0 || pCounter->load() == 0; });
+	this->Config.sleeping_workers.fetch_sub(1);
+}
+
+void CPUWorkStealingPool::WakeSleepingWorkers
+(
+	bool WakeAll
+)
+{
+	if (this->Config.sleeping_workers.load() == 0)
+	{
+		return;
+	}
+
+	// Taking the lock orders the notification after any sleeper's check.
+	std::lock_guard<std::mutex> Lock{ this->Config.task_mutex };
+
+	if (WakeAll == true)
+	{
+		this->Config.task_condition.notify_all();
+	}
+	else
+	{
+		this->Config.task_condition.notify_one();
+	}
+}
+
+void CPUWorkStealingPool::StopThreads
+()
+{
+	{
+		std::lock_guard<std::mutex> Lock{ this->Config.wake_mutex };
+		this->Config.stopping = true;
+	}
+
+	this->Config.wake_condition.notify_all();
+
+	for (std::thread& Thread : this->Config.threads)
+	{
+		Thread.join();
+	}
+
+	this->Config.threads.clear();
+	this->Config.stopping = false;
+}
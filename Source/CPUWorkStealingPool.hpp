@@ -0,0 +1,161 @@
+// CPUWorkStealingPool.hpp - Work-stealing task pool, for the parallel parts of the CPU rendering path.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A task, along with the counter of the group it belongs to.
+struct PoolTask
+{
+	std::function<void()> function;
+	std::atomic<unsigned int>* ptr_group_counter;
+};
+
+// Double-ended queue of one worker. The owner pushes and pops at the back, thieves steal from the front.
+struct PoolWorkerQueue
+{
+	std::mutex mutex;
+	std::deque<PoolTask> tasks;
+};
+
+// Counts collected per worker during Run().
+struct PoolWorkerStatistics
+{
+	unsigned long long tasks_executed;
+	unsigned long long tasks_stolen;
+
+	// Time spent running tasks taken from the queues (along with whatever they waited on), and the rest of the time Run() took.
+	double busy_seconds;
+	double idle_seconds;
+};
+
+// Config data for this class.
+struct CPUWorkStealingPoolConfig
+{
+	// One queue per worker, with the thread calling Run() as worker 0.
+	std::vector<std::unique_ptr<PoolWorkerQueue>> queues;
+
+	// Per-worker counts of the last Run() call.
+	std::vector<PoolWorkerStatistics> statistics;
+
+	// Tasks that were spawned but haven't finished, across every worker.
+	std::atomic<unsigned int> outstanding_tasks;
+
+	// Tasks sitting in the queues, which no worker has taken yet.
+	std::atomic<unsigned int> queued_tasks;
+
+	// Workers 1 and up, started once by Initialize() and joined by the destructor. Between jobs, they wait on wake_condition for job_index to change.
+	std::vector<std::thread> threads;
+	std::mutex wake_mutex;
+	std::condition_variable wake_condition;
+	unsigned long long job_index;
+	bool stopping;
+
+	// Number of workers still running the current job, which the calling thread waits on, under wake_mutex.
+	unsigned int busy_workers;
+	std::condition_variable done_condition;
+
+	// Workers that ran out of tasks during a job sleep on task_condition until one gets queued, or the counter they wait on drops to 0.
+	std::mutex task_mutex;
+	std::condition_variable task_condition;
+	std::atomic<unsigned int> sleeping_workers;
+
+	// Number of workers, counting the calling thread.
+	unsigned int thread_count;
+
+	// Label for this class.
+	const char* name;
+
+	// Error message for initialization.
+	const char* error_message;
+};
+
+// Populate this before calling the initializer function.
+struct CPUWorkStealingPoolInitConfig
+{
+	// Number of workers, counting the calling thread. Use 0 for one per hardware thread.
+	unsigned int thread_count;
+};
+
+// Runs a tree of tasks across worker threads. Each worker works depth-first on its own tasks, and steals the oldest ones of the others when it runs out.
+// The threads get started once, by Initialize(), and sleep between jobs and whenever there is nothing to steal, until the destructor joins them.
+class CPUWorkStealingPool
+{
+public:
+	// Constructor.
+	CPUWorkStealingPool();
+
+	// Populate this before calling the initializer function.
+	CPUWorkStealingPoolInitConfig InitConfig;
+
+	// Initializes the instance of this class, and starts its worker threads.
+	void Initialize();
+
+	// Runs RootTask, and every task it spawns, on all of the workers. Returns once they have all finished.
+	void Run(const std::function<void()>& RootTask);
+
+	// Queues a task on the calling worker. If pGroupCounter is given, it is incremented now and decremented once the task has finished.
+	// Outside of Run(), the task runs right away.
+	void Spawn(std::function<void()> Task, std::atomic<unsigned int>* pGroupCounter = nullptr);
+
+	// Runs other tasks until *pGroupCounter drops to 0.
+	void Wait(std::atomic<unsigned int>* pGroupCounter);
+
+	// Calls Function(Begin, End) over [0, Count) in chunks of Grain, in parallel, and returns once they're all done. Usable inside and outside of Run().
+	void ParallelFor(unsigned int Count, unsigned int Grain, const std::function<void(unsigned int Begin, unsigned int End)>& Function);
+
+	// Same as ParallelFor(), except that the chunks get dealt out before the workers start: worker i gets the i-th contiguous stretch of [0, Count) on its own queue, and goes through it in order.
+	// Workers that run out steal single chunks from the far ends of the others' stretches, so that neighboring chunks mostly stay on the same worker. Falls back to ParallelFor() inside of Run().
+	void DistributedFor(unsigned int Count, unsigned int Grain, const std::function<void(unsigned int Begin, unsigned int End)>& Function);
+
+	// Returns the number of workers.
+	unsigned int GetThreadCount() const;
+
+	// Returns the index of the worker the calling thread is, or 0 outside of Run().
+	unsigned int GetCurrentWorkerIndex() const;
+
+	// Returns the per-worker counts of the last Run() call.
+	const std::vector<PoolWorkerStatistics>& GetStatistics() const;
+
+	// Destructor.
+	~CPUWorkStealingPool();
+
+protected:
+	// Config data for this object.
+	CPUWorkStealingPoolConfig Config;
+
+	// Takes a task from the back of the worker's own queue, or from the front of someone else's.
+	bool FindTask(unsigned int WorkerIndex, PoolTask* pTask);
+
+	// Runs a task, and marks it as finished.
+	void ExecuteTask(unsigned int WorkerIndex, PoolTask& Task);
+
+	// Wakes the workers up on the tasks already queued, and returns once they have all finished.
+	void RunQueuedTasks();
+
+	// Scheduling loop of one worker, until every task has finished.
+	void RunWorker(unsigned int WorkerIndex);
+
+	// Loop of the threads of workers 1 and up: runs each job, then waits for the next one, until the pool gets destroyed.
+	void WorkerThread(unsigned int WorkerIndex);
+
+	// Puts the calling worker to sleep until a task gets queued, or *pCounter drops to 0.
+	void SleepUntilTaskOrZero(const std::atomic<unsigned int>* pCounter);
+
+	// Wakes up the sleeping workers, if any, after a task got queued or a counter dropped to 0.
+	void WakeSleepingWorkers(bool WakeAll);
+
+	// Stops and joins the worker threads.
+	void StopThreads();
+
+};
@@ -1,294 +0,0 @@
-#if 0
-;
-; Buffer Definitions:
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%struct.RayPayload = type { <3 x float>, <3 x float>, i32, i32 }
-%struct.IntersectionAttributes = type { <3 x float>, <3 x float> }
-%struct.RaytracingAccelerationStructure = type { i32 }
-%"class.RWTexture2D<vector<float, 4> >" = type { <4 x float> }
-%"class.RWBuffer<float>" = type { float }
-%struct.InlineConstantBuffer = type { %class.matrix.float.4.4, <4 x float>, <4 x float>, i32, <3 x float>, float, i32, i32, float }
-%class.matrix.float.4.4 = type { [4 x <4 x float>] }
-%Constants = type { %struct.InlineConstantBuffer }
-
-; Function Attrs: nounwind
-define void @"\01?DielectricAnyHit@@YAXURayPayload@@UIntersectionAttributes@@@Z"(%struct.RayPayload* noalias nocapture %Payload, %struct.IntersectionAttributes* nocapture readnone %Attributes) #0 {
-  ret void
-}
-
-attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "no-realign-stack" "stack-protector-buffer-size"="0" "unsafe-fp-math"="false" "use-soft-float"="false" }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.typeAnnotations = !{!4, !31}
-!dx.entryPoints = !{!37, !38}
-
-!0 = !{!"dxc 1.2"}
-!1 = !{i32 1, i32 3}
-!2 = !{i32 1, i32 4}
-!3 = !{!"lib", i32 6, i32 3}
-!4 = !{i32 0, %struct.RaytracingAccelerationStructure undef, !5, %"class.RWTexture2D<vector<float, 4> >" undef, !7, %"class.RWBuffer<float>" undef, !9, %struct.InlineConstantBuffer undef, !10, %struct.RayPayload undef, !21, %struct.IntersectionAttributes undef, !26, %Constants undef, !29}
-!5 = !{i32 4, !6}
-!6 = !{i32 6, !"h", i32 3, i32 0, i32 7, i32 4}
-!7 = !{i32 16, !8}
-!8 = !{i32 6, !"h", i32 3, i32 0, i32 7, i32 9}
-!9 = !{i32 4, !8}
-!10 = !{i32 128, !11, !13, !14, !15, !16, !17, !18, !19, !20}
-!11 = !{i32 6, !"CameraToWorld", i32 2, !12, i32 3, i32 0, i32 7, i32 9}
-!12 = !{i32 4, i32 4, i32 2}
-!13 = !{i32 6, !"SkyTopColor", i32 3, i32 64, i32 7, i32 9}
-!14 = !{i32 6, !"SkyBottomColor", i32 3, i32 80, i32 7, i32 9}
-!15 = !{i32 6, !"RandomFloatCount", i32 3, i32 96, i32 7, i32 5}
-!16 = !{i32 6, !"Pad01", i32 3, i32 100, i32 7, i32 9}
-!17 = !{i32 6, !"VertFoVRad", i32 3, i32 112, i32 7, i32 9}
-!18 = !{i32 6, !"MaxRecursionDepth", i32 3, i32 116, i32 7, i32 5}
-!19 = !{i32 6, !"RaysPerPixel", i32 3, i32 120, i32 7, i32 5}
-!20 = !{i32 6, !"LambertianAttenuationValue", i32 3, i32 124, i32 7, i32 9}
-!21 = !{i32 36, !22, !23, !24, !25}
-!22 = !{i32 6, !"Color", i32 3, i32 0, i32 7, i32 9}
-!23 = !{i32 6, !"WorldLastScatterDirection", i32 3, i32 16, i32 7, i32 9}
-!24 = !{i32 6, !"IntersectionCount", i32 3, i32 28, i32 7, i32 5}
-!25 = !{i32 6, !"RecursionDepth", i32 3, i32 32, i32 7, i32 5}
-!26 = !{i32 28, !27, !28}
-!27 = !{i32 6, !"ObjectIntersectionPoint", i32 3, i32 0, i32 7, i32 9}
-!28 = !{i32 6, !"ObjectSurfaceNormal", i32 3, i32 16, i32 7, i32 9}
-!29 = !{i32 128, !30}
-!30 = !{i32 6, !"Constants", i32 3, i32 0}
-!31 = !{i32 1, void (%struct.RayPayload*, %struct.IntersectionAttributes*)* @"\01?DielectricAnyHit@@YAXURayPayload@@UIntersectionAttributes@@@Z", !32}
-!32 = !{!33, !35, !36}
-!33 = !{i32 1, !34, !34}
-!34 = !{}
-!35 = !{i32 2, !34, !34}
-!36 = !{i32 0, !34, !34}
-!37 = !{null, !"", null, null, null}
-!38 = !{void (%struct.RayPayload*, %struct.IntersectionAttributes*)* @"\01?DielectricAnyHit@@YAXURayPayload@@UIntersectionAttributes@@@Z", !"\01?DielectricAnyHit@@YAXURayPayload@@UIntersectionAttributes@@@Z", null, null, !39}
-!39 = !{i32 8, i32 9, i32 6, i32 32, i32 7, i32 24, i32 5, !40}
-!40 = !{i32 0}
-
-#endif
-
-const unsigned char DielectricAnyHit[] = {
-  0x44, 0x58, 0x42, 0x43, 0x3a, 0x6b, 0x86, 0x01, 0x04, 0x76, 0x6f, 0xea,
-  0x81, 0xa6, 0x6e, 0x27, 0x3e, 0x2c, 0x61, 0x8a, 0x01, 0x00, 0x00, 0x00,
-  0xe8, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0x44, 0x41, 0x54, 0xa8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x44,
-  0x69, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x41, 0x6e, 0x79,
-  0x48, 0x69, 0x74, 0x40, 0x40, 0x59, 0x41, 0x58, 0x55, 0x52, 0x61, 0x79,
-  0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x40, 0x40, 0x55, 0x49, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x41, 0x74,
-  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x40, 0x40, 0x40, 0x5a,
-  0x00, 0x44, 0x69, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x41,
-  0x6e, 0x79, 0x48, 0x69, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x60, 0x00, 0x09, 0x00, 0x44, 0x58, 0x49, 0x4c,
-  0xf4, 0x08, 0x00, 0x00, 0x63, 0x00, 0x06, 0x00, 0x3d, 0x02, 0x00, 0x00,
-  0x44, 0x58, 0x49, 0x4c, 0x03, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xdc, 0x08, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00,
-  0x34, 0x02, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49,
-  0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19,
-  0x1e, 0x04, 0x8b, 0x62, 0x80, 0x14, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42,
-  0xa4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x52, 0x88,
-  0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42,
-  0xe4, 0x48, 0x0e, 0x90, 0x91, 0x22, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c,
-  0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x29, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00,
-  0x54, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0x20, 0x00, 0x12, 0x60, 0xd9, 0x60,
-  0x08, 0x02, 0xb0, 0x00, 0xd4, 0x06, 0xf0, 0x18, 0xfe, 0xff, 0xff, 0xff,
-  0x7f, 0x00, 0x24, 0x82, 0x1c, 0xd2, 0x61, 0x1e, 0xc2, 0x41, 0x1c, 0xd8,
-  0xa1, 0x1c, 0xda, 0x80, 0x1e, 0xc2, 0x21, 0x1d, 0xd8, 0xa1, 0x0d, 0xc6,
-  0x21, 0x1c, 0xd8, 0x81, 0x1d, 0xe6, 0x01, 0x30, 0x87, 0x70, 0x60, 0x87,
-  0x79, 0x28, 0x07, 0x80, 0x60, 0x87, 0x72, 0x98, 0x87, 0x79, 0x68, 0x03,
-  0x78, 0x90, 0x87, 0x72, 0x18, 0x87, 0x74, 0x98, 0x87, 0x72, 0x68, 0x03,
-  0x73, 0x80, 0x87, 0x76, 0x08, 0x07, 0x72, 0x00, 0xcc, 0x21, 0x1c, 0xd8,
-  0x61, 0x1e, 0xca, 0x01, 0x20, 0xdc, 0xe1, 0x1d, 0xda, 0xc0, 0x1c, 0xe4,
-  0x21, 0x1c, 0xda, 0xa1, 0x1c, 0xda, 0x00, 0x1e, 0xde, 0x21, 0x1d, 0xdc,
-  0x81, 0x1e, 0xca, 0x41, 0x1e, 0xda, 0xa0, 0x1c, 0xd8, 0x21, 0x1d, 0xda,
-  0x01, 0x30, 0x87, 0x70, 0x60, 0x87, 0x79, 0x28, 0x07, 0x80, 0x70, 0x87,
-  0x77, 0x68, 0x83, 0x74, 0x70, 0x07, 0x73, 0x98, 0x87, 0x36, 0x30, 0x07,
-  0x78, 0x68, 0x83, 0x76, 0x08, 0x07, 0x7a, 0x40, 0x07, 0xc0, 0x1c, 0xc2,
-  0x81, 0x1d, 0xe6, 0xa1, 0x1c, 0x00, 0xc2, 0x1d, 0xde, 0xa1, 0x0d, 0xdc,
-  0x21, 0x1c, 0xdc, 0x61, 0x1e, 0xda, 0xc0, 0x1c, 0xe0, 0xa1, 0x0d, 0xda,
-  0x21, 0x1c, 0xe8, 0x01, 0x1d, 0x00, 0x73, 0x08, 0x07, 0x76, 0x98, 0x87,
-  0x72, 0x00, 0x06, 0x77, 0x78, 0x87, 0x36, 0x90, 0x87, 0x72, 0x08, 0x07,
-  0x76, 0x48, 0x87, 0x73, 0x70, 0x87, 0x36, 0x98, 0x07, 0x7a, 0x08, 0x87,
-  0x71, 0x58, 0x07, 0x80, 0x98, 0x07, 0x7a, 0x08, 0x87, 0x71, 0x58, 0x87,
-  0x36, 0x80, 0x07, 0x79, 0x78, 0x07, 0x7a, 0x28, 0x87, 0x71, 0xa0, 0x87,
-  0x77, 0x90, 0x87, 0x36, 0x10, 0x87, 0x7a, 0x30, 0x07, 0x73, 0x28, 0x07,
-  0x79, 0x68, 0x83, 0x79, 0x48, 0x07, 0x7d, 0x28, 0x07, 0x00, 0x0e, 0x00,
-  0xa2, 0x1e, 0xdc, 0x61, 0x1e, 0xc2, 0xc1, 0x1c, 0xca, 0xa1, 0x0d, 0xcc,
-  0x01, 0x1e, 0xda, 0xa0, 0x1d, 0xc2, 0x81, 0x1e, 0xd0, 0x01, 0x30, 0x87,
-  0x70, 0x60, 0x87, 0x79, 0x28, 0x07, 0x80, 0xa8, 0x87, 0x79, 0x28, 0x87,
-  0x36, 0x98, 0x87, 0x77, 0x30, 0x07, 0x7a, 0x68, 0x03, 0x73, 0x60, 0x87,
-  0x77, 0x08, 0x07, 0x7a, 0x00, 0xcc, 0x21, 0x1c, 0xd8, 0x61, 0x1e, 0xca,
-  0x01, 0x00, 0x00, 0x00, 0x49, 0x18, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x13, 0x86, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x32, 0x22, 0x48, 0x09, 0x20, 0x64, 0x85, 0x04,
-  0x93, 0x22, 0xa4, 0x84, 0x04, 0x93, 0x22, 0xe3, 0x84, 0xa1, 0x90, 0x14,
-  0x12, 0x4c, 0x8a, 0x8c, 0x0b, 0x84, 0xa4, 0x4c, 0x10, 0x4c, 0x23, 0x00,
-  0x33, 0x00, 0xc3, 0x08, 0x43, 0x30, 0x47, 0x00, 0x06, 0x17, 0x49, 0x53,
-  0x44, 0x09, 0x93, 0xbf, 0x02, 0x58, 0x0a, 0x60, 0x8b, 0x03, 0x0c, 0x88,
-  0x10, 0x62, 0x0c, 0x22, 0xd7, 0x49, 0x53, 0x44, 0x09, 0x93, 0x2f, 0x36,
-  0x13, 0x11, 0x49, 0x84, 0x30, 0x21, 0x4e, 0xa3, 0x4d, 0x53, 0x84, 0x04,
-  0xd4, 0x44, 0x48, 0x48, 0x10, 0x82, 0x4c, 0x19, 0x40, 0x39, 0x84, 0x06,
-  0x02, 0xce, 0x0c, 0xa4, 0x29, 0xa2, 0x84, 0xc9, 0x5f, 0x01, 0x6c, 0x8a,
-  0x00, 0x01, 0x69, 0x0c, 0x4d, 0x10, 0x88, 0x85, 0x88, 0x80, 0x09, 0x71,
-  0x1a, 0x76, 0x8a, 0x28, 0x61, 0xa2, 0x22, 0x02, 0x05, 0x63, 0x18, 0x81,
-  0x08, 0x66, 0x22, 0x83, 0x71, 0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70,
-  0x03, 0x59, 0xb8, 0x05, 0x5a, 0x28, 0x07, 0x7c, 0xa0, 0x87, 0x7a, 0x90,
-  0x87, 0x72, 0x90, 0x03, 0x52, 0xe0, 0x03, 0x7b, 0x28, 0x87, 0x71, 0xa0,
-  0x87, 0x77, 0x90, 0x07, 0x3e, 0x30, 0x07, 0x76, 0x78, 0x87, 0x70, 0xa0,
-  0x07, 0x36, 0x00, 0x03, 0x3a, 0xf0, 0x03, 0x30, 0xf0, 0x03, 0x14, 0xb0,
-  0x99, 0xaa, 0x71, 0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70, 0x03, 0x59,
-  0xb8, 0x05, 0x51, 0xa8, 0x07, 0x73, 0x30, 0x87, 0x72, 0x90, 0x07, 0x3e,
-  0x30, 0x07, 0x76, 0x78, 0x87, 0x70, 0xa0, 0x07, 0x3f, 0x40, 0x41, 0x48,
-  0x02, 0x76, 0x96, 0xb0, 0x00, 0x92, 0xe4, 0x33, 0xc0, 0x14, 0x21, 0x97,
-  0x5f, 0x2c, 0x0e, 0x30, 0xf9, 0xb8, 0x8f, 0xa3, 0xe0, 0xdd, 0x26, 0x4d,
-  0x11, 0x25, 0x4c, 0xbe, 0xd8, 0x2c, 0x48, 0x43, 0x70, 0x4e, 0x23, 0x4d,
-  0x40, 0x33, 0x6d, 0x54, 0x51, 0x10, 0x11, 0x4a, 0x20, 0x63, 0x43, 0x84,
-  0x31, 0xc2, 0x25, 0x9c, 0xd3, 0x48, 0x13, 0xd0, 0x4c, 0x12, 0x0a, 0x22,
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87,
-  0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50,
-  0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30,
-  0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20,
-  0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0,
-  0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90,
-  0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10,
-  0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20,
-  0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0,
-  0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60,
-  0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x1e,
-  0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2,
-  0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18,
-  0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x1a,
-  0x25, 0x50, 0x06, 0x85, 0x50, 0x0c, 0x23, 0x00, 0xe5, 0x50, 0x20, 0x25,
-  0x51, 0x80, 0x02, 0x45, 0x50, 0x80, 0x01, 0x05, 0x1a, 0x50, 0xc0, 0x01,
-  0xa5, 0x50, 0xc8, 0x01, 0x05, 0x1e, 0x50, 0xe8, 0x01, 0x05, 0x1f, 0x50,
-  0xf8, 0x01, 0x85, 0x54, 0x38, 0x05, 0x54, 0x10, 0x05, 0x43, 0x64, 0x06,
-  0x80, 0xcc, 0x0c, 0x00, 0xad, 0x19, 0x00, 0x6a, 0x33, 0x00, 0xe4, 0x66,
-  0x00, 0x28, 0xce, 0x00, 0x90, 0x9c, 0x01, 0x00, 0x79, 0x18, 0x00, 0x00,
-  0xd0, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0xc4,
-  0x83, 0x0c, 0x6f, 0x0c, 0x24, 0xc6, 0x45, 0x66, 0x43, 0x10, 0x4c, 0x10,
-  0x86, 0x60, 0x82, 0x30, 0x08, 0x1b, 0x84, 0x81, 0x98, 0x20, 0x0c, 0xc3,
-  0x06, 0x61, 0x30, 0x38, 0xb0, 0xa5, 0x89, 0x4d, 0x10, 0x06, 0x62, 0xc3,
-  0x80, 0x24, 0xc4, 0x04, 0x61, 0x28, 0x26, 0x08, 0xcb, 0xc6, 0x00, 0x6d,
-  0x82, 0x30, 0x18, 0x1b, 0x8c, 0xa4, 0x21, 0x16, 0xc7, 0xd8, 0x20, 0x18,
-  0xcf, 0x04, 0xa1, 0xe1, 0x26, 0x08, 0xc3, 0x31, 0x41, 0x18, 0x90, 0x0d,
-  0x46, 0xd2, 0x10, 0x8b, 0x33, 0x6d, 0x10, 0x24, 0x6a, 0x82, 0xe0, 0x74,
-  0x1b, 0x04, 0x83, 0x9a, 0x20, 0x44, 0xde, 0x04, 0x61, 0x48, 0xd8, 0x0c,
-  0x85, 0xb5, 0x95, 0xc9, 0x85, 0x51, 0xbd, 0x5d, 0xbd, 0xc9, 0xb1, 0x91,
-  0x4d, 0x10, 0x06, 0x65, 0xc3, 0x60, 0x18, 0xdb, 0x06, 0x24, 0xd1, 0x36,
-  0x8e, 0x58, 0x9c, 0x89, 0xcb, 0xd4, 0x5a, 0x1e, 0xd5, 0x1b, 0xdc, 0xd0,
-  0x1b, 0xdb, 0x9b, 0xdc, 0x04, 0x61, 0x58, 0x36, 0x18, 0x89, 0x47, 0x7c,
-  0xce, 0x44, 0x67, 0x6a, 0x2d, 0x4f, 0xe8, 0x8d, 0x8e, 0xee, 0xad, 0x6d,
-  0xe8, 0x8d, 0xed, 0x4d, 0x6e, 0x82, 0x30, 0x30, 0x1b, 0x8c, 0x24, 0x0c,
-  0x08, 0x31, 0x70, 0x26, 0x42, 0x52, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x46,
-  0x6c, 0x6f, 0x61, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x13, 0x84, 0xa1,
-  0x99, 0x20, 0x0c, 0xce, 0x06, 0x23, 0x21, 0x03, 0xa2, 0x0c, 0x1c, 0x33,
-  0x60, 0x01, 0x15, 0x46, 0x06, 0x13, 0x33, 0x41, 0x18, 0x9e, 0x0d, 0x46,
-  0x82, 0x06, 0x44, 0x1a, 0x38, 0x13, 0x15, 0xab, 0x32, 0x39, 0x3a, 0xa3,
-  0x37, 0x2b, 0xa9, 0x30, 0xb2, 0x09, 0xc2, 0x00, 0x6d, 0x30, 0x92, 0x35,
-  0x20, 0xd8, 0xc0, 0x99, 0x18, 0x35, 0x85, 0xe1, 0x49, 0x95, 0x8d, 0xd5,
-  0xc9, 0xcd, 0xa5, 0xbd, 0xb9, 0x11, 0x95, 0xc1, 0xd1, 0xa1, 0x4d, 0x10,
-  0x86, 0x68, 0x83, 0x91, 0xb8, 0x01, 0xf1, 0x06, 0x8e, 0x19, 0x90, 0x91,
-  0x0a, 0xcb, 0x9b, 0x83, 0x2a, 0x93, 0x83, 0x4a, 0xc3, 0x2b, 0x63, 0x9b,
-  0x20, 0x0c, 0xd2, 0x06, 0x23, 0x89, 0x03, 0x42, 0x0e, 0x1c, 0x33, 0xa0,
-  0xc6, 0x14, 0xd6, 0x26, 0x56, 0x26, 0x47, 0x97, 0x16, 0xe6, 0x16, 0x44,
-  0x47, 0x57, 0xe6, 0x56, 0x17, 0x46, 0x97, 0xf6, 0xe6, 0x66, 0x15, 0xc6,
-  0x56, 0x57, 0x36, 0x41, 0x18, 0xa6, 0x0d, 0x46, 0x42, 0x07, 0x44, 0x1d,
-  0x38, 0xd3, 0x06, 0x25, 0xeb, 0xc0, 0x60, 0x0c, 0xce, 0x40, 0x0d, 0xda,
-  0x00, 0x0e, 0xe6, 0xc0, 0x0e, 0x26, 0x08, 0x44, 0x36, 0x41, 0x18, 0x28,
-  0x16, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x1b, 0x8c, 0x44, 0x0f, 0x88, 0xc5,
-  0x99, 0x98, 0x5d, 0xbd, 0xc9, 0xb1, 0x91, 0x31, 0x85, 0xcd, 0xd1, 0x4d,
-  0x8d, 0x85, 0xd1, 0xd1, 0x95, 0xc9, 0x11, 0xa5, 0xc9, 0x95, 0x8d, 0xd1,
-  0xa5, 0xbd, 0xb9, 0x6d, 0x30, 0x12, 0x3e, 0x20, 0x24, 0x67, 0x62, 0x94,
-  0xe4, 0x46, 0x57, 0x26, 0x37, 0x57, 0x36, 0x46, 0x97, 0xf6, 0xe6, 0x36,
-  0xf4, 0x56, 0xe7, 0x46, 0x37, 0x41, 0x18, 0xaa, 0x0d, 0x46, 0xe2, 0x07,
-  0xc4, 0x1f, 0x38, 0x66, 0x40, 0x47, 0xaa, 0x6c, 0xac, 0x4e, 0x6e, 0x2e,
-  0xed, 0xcd, 0x8d, 0xa8, 0x0c, 0x8e, 0x0e, 0x6d, 0x82, 0x30, 0x58, 0x1b,
-  0x8c, 0x24, 0x14, 0x08, 0x51, 0x70, 0xcc, 0x60, 0x43, 0x91, 0x07, 0x7b,
-  0xd0, 0x07, 0xa0, 0x30, 0x0a, 0x13, 0x04, 0x43, 0xe3, 0xf5, 0x24, 0xa6,
-  0x56, 0x36, 0x46, 0x97, 0xe4, 0x46, 0x57, 0x26, 0x37, 0x57, 0x36, 0x46,
-  0x97, 0xf6, 0xe6, 0x06, 0xf5, 0x96, 0xe6, 0x46, 0xb7, 0xc1, 0x48, 0x4c,
-  0x81, 0x58, 0x9c, 0x89, 0xd3, 0x93, 0x98, 0x5a, 0xd9, 0x18, 0xdd, 0x54,
-  0x9d, 0x9c, 0x59, 0xd8, 0x58, 0x99, 0xd3, 0x9b, 0x5c, 0x5b, 0x18, 0xdb,
-  0x06, 0x23, 0x41, 0x05, 0x42, 0x72, 0xa6, 0x0d, 0xc3, 0x1f, 0x9c, 0x42,
-  0x2a, 0x4c, 0x10, 0xa4, 0x8f, 0xc9, 0xd0, 0x9b, 0xdb, 0x1c, 0x5d, 0x98,
-  0x1b, 0xdd, 0xdc, 0x06, 0x22, 0x61, 0x05, 0x62, 0xd9, 0x20, 0x64, 0xad,
-  0xb0, 0xe1, 0x59, 0x18, 0x28, 0xaa, 0xac, 0x0b, 0xbb, 0x03, 0x3c, 0x20,
-  0x85, 0x52, 0x50, 0x85, 0x55, 0x70, 0x85, 0x09, 0x42, 0x02, 0x6c, 0x00,
-  0x36, 0x0c, 0x43, 0x2c, 0xc4, 0xc2, 0x86, 0x61, 0x8b, 0x85, 0x58, 0xd8,
-  0x30, 0x2c, 0xb1, 0x10, 0x0b, 0x1b, 0x06, 0x59, 0x98, 0x05, 0x5a, 0xd8,
-  0x30, 0x0c, 0xb0, 0x50, 0x0b, 0x04, 0x36, 0x14, 0xc0, 0x2d, 0x00, 0x00,
-  0xc0, 0x3f, 0x08, 0xf8, 0x21, 0x4a, 0x2b, 0x63, 0x2b, 0x1b, 0xa3, 0x93,
-  0x4b, 0x1b, 0x0b, 0x72, 0xcb, 0x43, 0x4a, 0xa3, 0x03, 0x02, 0xca, 0x0a,
-  0xc2, 0xaa, 0x92, 0x0a, 0xcb, 0x83, 0x0a, 0xcb, 0x63, 0x7b, 0x0b, 0x23,
-  0x03, 0x02, 0xaa, 0x4a, 0x72, 0xa3, 0x2b, 0x93, 0x9b, 0x2b, 0x1b, 0xa3,
-  0x4b, 0x7b, 0x73, 0x0b, 0xa2, 0xa3, 0x93, 0x4b, 0x13, 0xab, 0xa3, 0x2b,
-  0x9b, 0x03, 0x02, 0x02, 0xd2, 0x9a, 0x20, 0x0c, 0xd7, 0x04, 0x61, 0xc0,
-  0x36, 0x04, 0xcb, 0x06, 0x44, 0x17, 0xa6, 0x44, 0x14, 0x9c, 0x5d, 0x30,
-  0x03, 0x5e, 0xd8, 0x50, 0xc0, 0x42, 0x2e, 0x00, 0x40, 0x2f, 0x54, 0x61,
-  0x63, 0xb3, 0x6b, 0x73, 0x49, 0x23, 0x2b, 0x73, 0xa3, 0x9b, 0x12, 0x04,
-  0x55, 0xc8, 0xf0, 0x5c, 0xec, 0xca, 0xe4, 0xe6, 0xd2, 0xde, 0xdc, 0xa6,
-  0x04, 0x44, 0x13, 0x32, 0x3c, 0x17, 0xbb, 0x30, 0x36, 0xbb, 0x32, 0xb9,
-  0x29, 0x81, 0x51, 0x87, 0x0c, 0xcf, 0x65, 0x0e, 0x2d, 0x8c, 0xac, 0x4c,
-  0xae, 0xe9, 0x8d, 0xac, 0x8c, 0x6d, 0x4a, 0x90, 0x54, 0x22, 0xc3, 0x73,
-  0xa1, 0xcb, 0x83, 0x2b, 0x0b, 0x72, 0x73, 0x7b, 0xa3, 0x0b, 0xa3, 0x4b,
-  0x7b, 0x73, 0x9b, 0x9b, 0x22, 0xb8, 0x42, 0x2d, 0xd4, 0x21, 0xc3, 0x73,
-  0x29, 0x73, 0xa3, 0x93, 0xcb, 0x83, 0x7a, 0x4b, 0x73, 0xa3, 0x9b, 0x9b,
-  0x22, 0xdc, 0x42, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66,
-  0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07,
-  0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10,
-  0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce,
-  0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b,
-  0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c,
-  0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07,
-  0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11,
-  0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0,
-  0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8,
-  0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b,
-  0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b,
-  0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87,
-  0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07,
-  0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87,
-  0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81,
-  0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30,
-  0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4,
-  0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca,
-  0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39,
-  0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b,
-  0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b,
-  0xb0, 0xc3, 0x8c, 0xcc, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x74, 0x60, 0x07,
-  0x37, 0x90, 0x87, 0x72, 0x98, 0x87, 0x77, 0xa8, 0x07, 0x79, 0x18, 0x87,
-  0x72, 0x70, 0x83, 0x70, 0xa0, 0x07, 0x7a, 0x90, 0x87, 0x74, 0x10, 0x87,
-  0x7a, 0xa0, 0x87, 0x72, 0x00, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x05, 0xf0, 0x07, 0x81, 0x1f, 0x31, 0x5d, 0x66,
-  0x97, 0xc7, 0x74, 0x79, 0x7a, 0x1c, 0x74, 0xe7, 0x91, 0x69, 0x3a, 0x10,
-  0x98, 0x0d, 0x62, 0xab, 0xd2, 0x70, 0x1e, 0x1a, 0xce, 0xb3, 0xdf, 0x61,
-  0x32, 0x10, 0x58, 0x4d, 0xba, 0xe9, 0x65, 0xf9, 0xbc, 0x3c, 0xa6, 0xa7,
-  0xdf, 0xee, 0x20, 0x9d, 0x2e, 0x4f, 0x8b, 0xeb, 0xf4, 0xf2, 0x1c, 0x08,
-  0x04, 0x6a, 0x01, 0x00, 0x61, 0x20, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x13, 0x04, 0x01, 0x86, 0x03, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x16, 0xa2, 0x68, 0xd3, 0x14, 0x21, 0x01, 0x35, 0x11, 0x92, 0x81, 0x1c,
-  0x29, 0x80, 0x2d, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00
-};
@@ -1,416 +0,0 @@
-#if 0
-;
-; Buffer Definitions:
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%struct.IntersectionAttributes = type { <3 x float>, <3 x float> }
-%struct.RaytracingAccelerationStructure = type { i32 }
-%"class.RWTexture2D<vector<float, 4> >" = type { <4 x float> }
-%"class.RWBuffer<float>" = type { float }
-%struct.InlineConstantBuffer = type { %class.matrix.float.4.4, <4 x float>, <4 x float>, i32, <3 x float>, float, i32, i32, float }
-%class.matrix.float.4.4 = type { [4 x <4 x float>] }
-%Constants = type { %struct.InlineConstantBuffer }
-
-; Function Attrs: nounwind
-define void @"\01?DielectricIntersection@@YAXXZ"() #0 {
-  %Attributes = alloca %struct.IntersectionAttributes, align 4
-  %ObjectRayDirection43 = call float @dx.op.objectRayDirection.f32(i32 150, i8 0)  ; ObjectRayDirection(col)
-  %ObjectRayDirection44 = call float @dx.op.objectRayDirection.f32(i32 150, i8 1)  ; ObjectRayDirection(col)
-  %ObjectRayDirection45 = call float @dx.op.objectRayDirection.f32(i32 150, i8 2)  ; ObjectRayDirection(col)
-  %1 = call float @dx.op.dot3.f32(i32 55, float %ObjectRayDirection43, float %ObjectRayDirection44, float %ObjectRayDirection45, float %ObjectRayDirection43, float %ObjectRayDirection44, float %ObjectRayDirection45)  ; Dot3(ax,ay,az,bx,by,bz)
-  %ObjectRayOrigin37 = call float @dx.op.objectRayOrigin.f32(i32 149, i8 0)  ; ObjectRayOrigin(col)
-  %ObjectRayOrigin38 = call float @dx.op.objectRayOrigin.f32(i32 149, i8 1)  ; ObjectRayOrigin(col)
-  %ObjectRayOrigin39 = call float @dx.op.objectRayOrigin.f32(i32 149, i8 2)  ; ObjectRayOrigin(col)
-  %2 = call float @dx.op.dot3.f32(i32 55, float %ObjectRayDirection43, float %ObjectRayDirection44, float %ObjectRayDirection45, float %ObjectRayOrigin37, float %ObjectRayOrigin38, float %ObjectRayOrigin39)  ; Dot3(ax,ay,az,bx,by,bz)
-  %3 = fmul fast float %2, 2.000000e+00
-  %4 = call float @dx.op.dot3.f32(i32 55, float %ObjectRayOrigin37, float %ObjectRayOrigin38, float %ObjectRayOrigin39, float %ObjectRayOrigin37, float %ObjectRayOrigin38, float %ObjectRayOrigin39)  ; Dot3(ax,ay,az,bx,by,bz)
-  %5 = fadd fast float %4, -1.000000e+00
-  %6 = fmul fast float %3, %3
-  %7 = fmul fast float %1, 4.000000e+00
-  %8 = fmul fast float %7, %5
-  %9 = fsub fast float %6, %8
-  %10 = fcmp fast ult float %9, 0.000000e+00
-  br i1 %10, label %22, label %11
-
-; <label>:11                                      ; preds = %0
-  %12 = fsub fast float -0.000000e+00, %3
-  %Sqrt = call float @dx.op.unary.f32(i32 24, float %9)  ; Sqrt(value)
-  %13 = fsub fast float %12, %Sqrt
-  %14 = fmul fast float %1, 2.000000e+00
-  %15 = fdiv fast float %13, %14
-  %.i0 = fmul fast float %ObjectRayDirection43, %15
-  %.i1 = fmul fast float %ObjectRayDirection44, %15
-  %.i2 = fmul fast float %ObjectRayDirection45, %15
-  %.i046 = fadd fast float %.i0, %ObjectRayOrigin37
-  %.i147 = fadd fast float %.i1, %ObjectRayOrigin38
-  %.i248 = fadd fast float %.i2, %ObjectRayOrigin39
-  %.upto0 = insertelement <3 x float> undef, float %.i046, i32 0
-  %.upto1 = insertelement <3 x float> %.upto0, float %.i147, i32 1
-  %16 = insertelement <3 x float> %.upto1, float %.i248, i32 2
-  %17 = getelementptr inbounds %struct.IntersectionAttributes, %struct.IntersectionAttributes* %Attributes, i32 0, i32 0
-  store <3 x float> %16, <3 x float>* %17, align 4, !tbaa !34
-  %18 = call float @dx.op.dot3.f32(i32 55, float %.i046, float %.i147, float %.i248, float %.i046, float %.i147, float %.i248)  ; Dot3(ax,ay,az,bx,by,bz)
-  %Rsqrt = call float @dx.op.unary.f32(i32 25, float %18)  ; Rsqrt(value)
-  %.i053 = fmul fast float %Rsqrt, %.i046
-  %.i155 = fmul fast float %Rsqrt, %.i147
-  %.i257 = fmul fast float %.i248, %Rsqrt
-  %.upto058 = insertelement <3 x float> undef, float %.i053, i32 0
-  %.upto159 = insertelement <3 x float> %.upto058, float %.i155, i32 1
-  %19 = insertelement <3 x float> %.upto159, float %.i257, i32 2
-  %20 = getelementptr inbounds %struct.IntersectionAttributes, %struct.IntersectionAttributes* %Attributes, i32 0, i32 1
-  store <3 x float> %19, <3 x float>* %20, align 4, !tbaa !34
-  %RayTCurrent = call float @dx.op.rayTCurrent.f32(i32 154)  ; RayTCurrent()
-  %21 = call i1 @dx.op.reportHit.struct.IntersectionAttributes(i32 158, float %RayTCurrent, i32 0, %struct.IntersectionAttributes* nonnull %Attributes)  ; ReportHit(THit,HitKind,Attributes)
-  br label %22
-
-; <label>:22                                      ; preds = %11, %0
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot3.f32(i32, float, float, float, float, float, float) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.objectRayDirection.f32(i32, i8) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.objectRayOrigin.f32(i32, i8) #1
-
-; Function Attrs: nounwind
-declare i1 @dx.op.reportHit.struct.IntersectionAttributes(i32, float, i32, %struct.IntersectionAttributes*) #2
-
-; Function Attrs: nounwind readonly
-declare float @dx.op.rayTCurrent.f32(i32) #3
-
-attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "no-realign-stack" "stack-protector-buffer-size"="0" "unsafe-fp-math"="false" "use-soft-float"="false" }
-attributes #1 = { nounwind readnone }
-attributes #2 = { nounwind }
-attributes #3 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.typeAnnotations = !{!4, !26}
-!dx.entryPoints = !{!30, !31}
-
-!0 = !{!"dxc 1.2"}
-!1 = !{i32 1, i32 3}
-!2 = !{i32 1, i32 4}
-!3 = !{!"lib", i32 6, i32 3}
-!4 = !{i32 0, %struct.RaytracingAccelerationStructure undef, !5, %"class.RWTexture2D<vector<float, 4> >" undef, !7, %"class.RWBuffer<float>" undef, !9, %struct.InlineConstantBuffer undef, !10, %struct.IntersectionAttributes undef, !21, %Constants undef, !24}
-!5 = !{i32 4, !6}
-!6 = !{i32 6, !"h", i32 3, i32 0, i32 7, i32 4}
-!7 = !{i32 16, !8}
-!8 = !{i32 6, !"h", i32 3, i32 0, i32 7, i32 9}
-!9 = !{i32 4, !8}
-!10 = !{i32 128, !11, !13, !14, !15, !16, !17, !18, !19, !20}
-!11 = !{i32 6, !"CameraToWorld", i32 2, !12, i32 3, i32 0, i32 7, i32 9}
-!12 = !{i32 4, i32 4, i32 2}
-!13 = !{i32 6, !"SkyTopColor", i32 3, i32 64, i32 7, i32 9}
-!14 = !{i32 6, !"SkyBottomColor", i32 3, i32 80, i32 7, i32 9}
-!15 = !{i32 6, !"RandomFloatCount", i32 3, i32 96, i32 7, i32 5}
-!16 = !{i32 6, !"Pad01", i32 3, i32 100, i32 7, i32 9}
-!17 = !{i32 6, !"VertFoVRad", i32 3, i32 112, i32 7, i32 9}
-!18 = !{i32 6, !"MaxRecursionDepth", i32 3, i32 116, i32 7, i32 5}
-!19 = !{i32 6, !"RaysPerPixel", i32 3, i32 120, i32 7, i32 5}
-!20 = !{i32 6, !"LambertianAttenuationValue", i32 3, i32 124, i32 7, i32 9}
-!21 = !{i32 28, !22, !23}
-!22 = !{i32 6, !"ObjectIntersectionPoint", i32 3, i32 0, i32 7, i32 9}
-!23 = !{i32 6, !"ObjectSurfaceNormal", i32 3, i32 16, i32 7, i32 9}
-!24 = !{i32 128, !25}
-!25 = !{i32 6, !"Constants", i32 3, i32 0}
-!26 = !{i32 1, void ()* @"\01?DielectricIntersection@@YAXXZ", !27}
-!27 = !{!28}
-!28 = !{i32 1, !29, !29}
-!29 = !{}
-!30 = !{null, !"", null, null, null}
-!31 = !{void ()* @"\01?DielectricIntersection@@YAXXZ", !"\01?DielectricIntersection@@YAXXZ", null, null, !32}
-!32 = !{i32 8, i32 8, i32 5, !33}
-!33 = !{i32 0}
-!34 = !{!35, !35, i64 0}
-!35 = !{!"omnipotent char", !36, i64 0}
-!36 = !{!"Simple C/C++ TBAA"}
-
-#endif
-
-const unsigned char DielectricIntersection[] = {
-  0x44, 0x58, 0x42, 0x43, 0x9e, 0x08, 0x4f, 0xc8, 0x66, 0xff, 0xca, 0xae,
-  0x13, 0xda, 0x67, 0xa8, 0x28, 0x3d, 0x95, 0xa2, 0x01, 0x00, 0x00, 0x00,
-  0x7c, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0x44, 0x41, 0x54, 0x8c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x44,
-  0x69, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x69, 0x63, 0x49, 0x6e, 0x74,
-  0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x40, 0x40, 0x59,
-  0x41, 0x58, 0x58, 0x5a, 0x00, 0x44, 0x69, 0x65, 0x6c, 0x65, 0x63, 0x74,
-  0x72, 0x69, 0x63, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x00, 0x04, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x63, 0x00, 0x08, 0x00, 0x44, 0x58, 0x49, 0x4c, 0xa4, 0x0b, 0x00, 0x00,
-  0x63, 0x00, 0x06, 0x00, 0xe9, 0x02, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c,
-  0x03, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x8c, 0x0b, 0x00, 0x00,
-  0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00,
-  0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39,
-  0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62,
-  0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14,
-  0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20,
-  0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90,
-  0x11, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a,
-  0x04, 0x31, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
-  0x1b, 0xc0, 0x23, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x08, 0x72,
-  0x48, 0x87, 0x79, 0x08, 0x07, 0x71, 0x60, 0x87, 0x72, 0x68, 0x03, 0x7a,
-  0x08, 0x87, 0x74, 0x60, 0x87, 0x36, 0x18, 0x87, 0x70, 0x60, 0x07, 0x76,
-  0x98, 0x07, 0xc0, 0x1c, 0xc2, 0x81, 0x1d, 0xe6, 0xa1, 0x1c, 0x00, 0x82,
-  0x1d, 0xca, 0x61, 0x1e, 0xe6, 0xa1, 0x0d, 0xe0, 0x41, 0x1e, 0xca, 0x61,
-  0x1c, 0xd2, 0x61, 0x1e, 0xca, 0xa1, 0x0d, 0xcc, 0x01, 0x1e, 0xda, 0x21,
-  0x1c, 0xc8, 0x01, 0x30, 0x87, 0x70, 0x60, 0x87, 0x79, 0x28, 0x07, 0x80,
-  0x70, 0x87, 0x77, 0x68, 0x03, 0x73, 0x90, 0x87, 0x70, 0x68, 0x87, 0x72,
-  0x68, 0x03, 0x78, 0x78, 0x87, 0x74, 0x70, 0x07, 0x7a, 0x28, 0x07, 0x79,
-  0x68, 0x83, 0x72, 0x60, 0x87, 0x74, 0x68, 0x07, 0xc0, 0x1c, 0xc2, 0x81,
-  0x1d, 0xe6, 0xa1, 0x1c, 0x00, 0xc2, 0x1d, 0xde, 0xa1, 0x0d, 0xd2, 0xc1,
-  0x1d, 0xcc, 0x61, 0x1e, 0xda, 0xc0, 0x1c, 0xe0, 0xa1, 0x0d, 0xda, 0x21,
-  0x1c, 0xe8, 0x01, 0x1d, 0x00, 0x73, 0x08, 0x07, 0x76, 0x98, 0x87, 0x72,
-  0x00, 0x08, 0x77, 0x78, 0x87, 0x36, 0x70, 0x87, 0x70, 0x70, 0x87, 0x79,
-  0x68, 0x03, 0x73, 0x80, 0x87, 0x36, 0x68, 0x87, 0x70, 0xa0, 0x07, 0x74,
-  0x00, 0xcc, 0x21, 0x1c, 0xd8, 0x61, 0x1e, 0xca, 0x01, 0x18, 0xdc, 0xe1,
-  0x1d, 0xda, 0x40, 0x1e, 0xca, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xce, 0xc1,
-  0x1d, 0xda, 0x60, 0x1e, 0xe8, 0x21, 0x1c, 0xc6, 0x61, 0x1d, 0x00, 0x62,
-  0x1e, 0xe8, 0x21, 0x1c, 0xc6, 0x61, 0x1d, 0xda, 0x00, 0x1e, 0xe4, 0xe1,
-  0x1d, 0xe8, 0xa1, 0x1c, 0xc6, 0x81, 0x1e, 0xde, 0x41, 0x1e, 0xda, 0x40,
-  0x1c, 0xea, 0xc1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x0d, 0xe6, 0x21,
-  0x1d, 0xf4, 0xa1, 0x1c, 0x00, 0x38, 0x00, 0x88, 0x7a, 0x70, 0x87, 0x79,
-  0x08, 0x07, 0x73, 0x28, 0x87, 0x36, 0x30, 0x07, 0x78, 0x68, 0x83, 0x76,
-  0x08, 0x07, 0x7a, 0x40, 0x07, 0xc0, 0x1c, 0xc2, 0x81, 0x1d, 0xe6, 0xa1,
-  0x1c, 0x00, 0xa2, 0x1e, 0xe6, 0xa1, 0x1c, 0xda, 0x60, 0x1e, 0xde, 0xc1,
-  0x1c, 0xe8, 0xa1, 0x0d, 0xcc, 0x81, 0x1d, 0xde, 0x21, 0x1c, 0xe8, 0x01,
-  0x30, 0x87, 0x70, 0x60, 0x87, 0x79, 0x28, 0x07, 0x60, 0x83, 0x21, 0xfc,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x48, 0x00, 0xb5, 0x81, 0x18, 0xfe, 0xff,
-  0xff, 0xff, 0x7f, 0x00, 0xa4, 0x0d, 0x06, 0xf1, 0xff, 0xff, 0xff, 0xff,
-  0x03, 0x20, 0x01, 0xd5, 0x06, 0xa2, 0x20, 0x80, 0x33, 0x00, 0x00, 0x00,
-  0x49, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42,
-  0x20, 0x4c, 0x08, 0x86, 0x09, 0x01, 0x31, 0x21, 0x28, 0x00, 0x00, 0x00,
-  0x89, 0x20, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09,
-  0x20, 0x64, 0x85, 0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3,
-  0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c,
-  0x10, 0x80, 0xc1, 0x08, 0x40, 0x09, 0x00, 0x0a, 0x66, 0x00, 0xe6, 0x08,
-  0xc0, 0xa0, 0x0c, 0x03, 0x31, 0x50, 0x51, 0x90, 0x81, 0x18, 0x86, 0x61,
-  0x18, 0x06, 0x3a, 0xe6, 0x08, 0x90, 0x32, 0x0c, 0x44, 0x42, 0xca, 0x1c,
-  0x41, 0x30, 0x8c, 0x30, 0x0c, 0xd7, 0x49, 0x53, 0x44, 0x09, 0x93, 0x2f,
-  0x36, 0x13, 0x11, 0x49, 0x84, 0x30, 0x21, 0x4e, 0xa3, 0x4d, 0x53, 0x84,
-  0x04, 0xd4, 0x44, 0x48, 0x48, 0x68, 0x1a, 0x72, 0x4a, 0xc1, 0x10, 0x03,
-  0xf1, 0x10, 0x54, 0x84, 0x81, 0x20, 0x69, 0x20, 0xe0, 0xcc, 0x40, 0x9a,
-  0x22, 0x4a, 0x98, 0xfc, 0x15, 0xc0, 0xa6, 0x08, 0x10, 0x90, 0xc6, 0xd0,
-  0x04, 0x81, 0x58, 0x88, 0x08, 0x98, 0x10, 0xa7, 0x61, 0xa7, 0x88, 0x12,
-  0x26, 0x2a, 0x22, 0x50, 0x40, 0x0c, 0x23, 0x10, 0xc3, 0x4c, 0x64, 0x30,
-  0x0e, 0xec, 0x10, 0x0e, 0xf3, 0x30, 0x0f, 0x6e, 0x20, 0x0b, 0xb7, 0x40,
-  0x0b, 0xe5, 0x80, 0x0f, 0xf4, 0x50, 0x0f, 0xf2, 0x50, 0x0e, 0x72, 0x40,
-  0x0a, 0x7c, 0x60, 0x0f, 0xe5, 0x30, 0x0e, 0xf4, 0xf0, 0x0e, 0xf2, 0xc0,
-  0x07, 0xe6, 0xc0, 0x0e, 0xef, 0x10, 0x0e, 0xf4, 0xc0, 0x06, 0x60, 0x40,
-  0x07, 0x7e, 0x00, 0x06, 0x7e, 0x80, 0x02, 0x6b, 0xa6, 0x6a, 0x1c, 0xd8,
-  0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc, 0x40, 0x16, 0x6e, 0x41, 0x14, 0xea,
-  0xc1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0x81, 0x0f, 0xcc, 0x81, 0x1d, 0xde,
-  0x21, 0x1c, 0xe8, 0xc1, 0x0f, 0x50, 0x30, 0x24, 0x81, 0x75, 0x96, 0xb0,
-  0x00, 0x92, 0xe4, 0x33, 0xc0, 0x14, 0x21, 0x97, 0x5f, 0x2c, 0x0e, 0x30,
-  0xf9, 0xb8, 0x8f, 0xa3, 0x20, 0xbb, 0x4d, 0x9a, 0x22, 0x4a, 0x98, 0x7c,
-  0xb1, 0x59, 0x90, 0x86, 0xe0, 0x9c, 0x46, 0x9a, 0x80, 0x66, 0xda, 0xa8,
-  0xa2, 0x20, 0x22, 0x94, 0x68, 0x96, 0x45, 0x34, 0x03, 0x41, 0x0c, 0x97,
-  0x70, 0x4e, 0x23, 0x4d, 0x40, 0x33, 0x49, 0x28, 0xd8, 0xa6, 0x00, 0xa8,
-  0x99, 0x23, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0,
-  0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0,
-  0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d,
-  0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a,
-  0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74,
-  0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6,
-  0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78,
-  0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76,
-  0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x86, 0x3c, 0x05, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x0e, 0x20, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x28, 0x40, 0x00, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x51, 0x80, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x03, 0x01, 0x01,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x47, 0x02,
-  0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2c, 0x10,
-  0x15, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18, 0x19, 0x11, 0x4c, 0x90,
-  0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x22, 0x4a, 0xa0, 0x0c, 0x0a,
-  0xa1, 0x18, 0x46, 0x00, 0xca, 0xa1, 0x40, 0x4a, 0xa2, 0x00, 0x05, 0x8a,
-  0xa0, 0x00, 0x03, 0x0a, 0x34, 0xa0, 0x80, 0x03, 0x4a, 0xa1, 0x90, 0x03,
-  0x0a, 0x3c, 0xa0, 0xd0, 0x03, 0x0a, 0x3e, 0xa0, 0xf0, 0x03, 0x0a, 0xa7,
-  0x20, 0xe8, 0x1b, 0x01, 0xa0, 0x6a, 0x06, 0x80, 0xae, 0x19, 0x00, 0xc2,
-  0x66, 0x00, 0x68, 0x9b, 0x01, 0x20, 0x6e, 0x06, 0x80, 0x9c, 0x19, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
-  0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0xc4, 0x83, 0x0c, 0x6f, 0x0c,
-  0x24, 0xc6, 0x45, 0x66, 0x43, 0x10, 0x4c, 0x10, 0x88, 0x63, 0x82, 0x40,
-  0x20, 0x1b, 0x84, 0x81, 0x98, 0x20, 0x10, 0xc9, 0x06, 0x61, 0x30, 0x38,
-  0xb0, 0xa5, 0x89, 0x4d, 0x10, 0x08, 0x65, 0xc3, 0x80, 0x24, 0xc4, 0x04,
-  0x81, 0x58, 0x26, 0x08, 0x55, 0xc7, 0x00, 0x6d, 0x82, 0x40, 0x30, 0x1b,
-  0x8c, 0xa4, 0x21, 0x16, 0xc7, 0xd8, 0x20, 0x18, 0xcf, 0x04, 0xe1, 0xf2,
-  0x26, 0x08, 0x44, 0x33, 0x41, 0x20, 0x9c, 0x0d, 0x46, 0xd2, 0x10, 0x8b,
-  0x33, 0x6d, 0x10, 0x24, 0x6a, 0x82, 0x80, 0x7d, 0x1b, 0x04, 0x83, 0x9a,
-  0x20, 0x6c, 0x60, 0x30, 0x41, 0x20, 0x1e, 0x36, 0x43, 0x61, 0x6d, 0x65,
-  0x72, 0x61, 0x54, 0x6f, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x13, 0x04, 0x02,
-  0xda, 0x30, 0x18, 0xc6, 0xb6, 0x01, 0x49, 0xb4, 0x8d, 0x23, 0x16, 0x67,
-  0xe2, 0x32, 0xb5, 0x96, 0x47, 0xf5, 0x06, 0x37, 0xf4, 0xc6, 0xf6, 0x26,
-  0x37, 0x41, 0x20, 0xa2, 0x0d, 0x46, 0xe2, 0x11, 0x9f, 0x33, 0xd1, 0x99,
-  0x5a, 0xcb, 0x13, 0x7a, 0xa3, 0xa3, 0x7b, 0x6b, 0x1b, 0x7a, 0x63, 0x7b,
-  0x93, 0x9b, 0x20, 0x10, 0xd2, 0x06, 0x23, 0x09, 0x03, 0x42, 0x0c, 0x9c,
-  0x89, 0x90, 0x54, 0x98, 0x1b, 0xd9, 0x5b, 0x9b, 0x11, 0xdb, 0x5b, 0x18,
-  0xdd, 0xd0, 0x5b, 0x9d, 0x1b, 0xdd, 0x04, 0x81, 0x98, 0x26, 0x08, 0x04,
-  0xb5, 0xc1, 0x48, 0xc8, 0x80, 0x28, 0x03, 0xc7, 0x0c, 0x58, 0x40, 0x85,
-  0x91, 0xc1, 0xc4, 0x4c, 0x10, 0x88, 0x6a, 0x83, 0x91, 0xa0, 0x01, 0x91,
-  0x06, 0xce, 0x44, 0xc5, 0xaa, 0x4c, 0x8e, 0xce, 0xe8, 0xcd, 0x4a, 0x2a,
-  0x8c, 0x6c, 0x82, 0x40, 0x58, 0x1b, 0x8c, 0x64, 0x0d, 0x08, 0x36, 0x70,
-  0x26, 0x46, 0x4d, 0x61, 0x78, 0x52, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x44, 0x65, 0x70, 0x74, 0x68, 0x13, 0x04, 0xe2, 0xda, 0x60,
-  0x24, 0x6e, 0x40, 0xbc, 0x81, 0x63, 0x06, 0x64, 0xa4, 0xc2, 0xf2, 0xe6,
-  0xa0, 0xca, 0xe4, 0xa0, 0xd2, 0xf0, 0xca, 0xd8, 0x26, 0x08, 0x04, 0xb6,
-  0xc1, 0x48, 0xe2, 0x80, 0x90, 0x03, 0xc7, 0x0c, 0xa8, 0x31, 0x85, 0xb5,
-  0x89, 0x95, 0xc9, 0xd1, 0xa5, 0x85, 0xb9, 0x05, 0xd1, 0xd1, 0x95, 0xb9,
-  0xd5, 0x85, 0xd1, 0xa5, 0xbd, 0xb9, 0x59, 0x85, 0xb1, 0xd5, 0x95, 0x4d,
-  0x10, 0x88, 0x6c, 0x83, 0x91, 0xd0, 0x01, 0x51, 0x07, 0xce, 0xb4, 0x41,
-  0xc9, 0x3a, 0x30, 0x18, 0x83, 0x33, 0x50, 0x83, 0x36, 0x80, 0x83, 0x39,
-  0xb0, 0x83, 0x09, 0x82, 0x23, 0x06, 0x13, 0x04, 0x42, 0xe3, 0xf5, 0x24,
-  0xa6, 0x56, 0x36, 0x46, 0x97, 0xe4, 0x46, 0x57, 0x26, 0x37, 0x57, 0x36,
-  0x46, 0x97, 0xf6, 0xe6, 0x06, 0xf5, 0x96, 0xe6, 0x46, 0xb7, 0xc1, 0x48,
-  0xf4, 0x80, 0x58, 0x9c, 0x89, 0xd3, 0x93, 0x98, 0x5a, 0xd9, 0x18, 0xdd,
-  0x54, 0x9d, 0x9c, 0x59, 0xd8, 0x58, 0x99, 0xd3, 0x9b, 0x5c, 0x5b, 0x18,
-  0xdb, 0x06, 0x23, 0xe1, 0x03, 0x42, 0x72, 0xa6, 0x0d, 0x43, 0x1e, 0xec,
-  0x41, 0x1f, 0x4c, 0x10, 0xb8, 0x30, 0x60, 0x32, 0xf4, 0xe6, 0x36, 0x47,
-  0x17, 0xe6, 0x46, 0x37, 0xb7, 0x81, 0x48, 0x40, 0x81, 0x58, 0x36, 0x08,
-  0x59, 0x28, 0x6c, 0x68, 0x16, 0x06, 0x8a, 0x2a, 0xeb, 0xc2, 0xee, 0x00,
-  0x0f, 0xfc, 0xe0, 0x0f, 0x44, 0x61, 0x82, 0x20, 0x00, 0x1b, 0x80, 0x0d,
-  0xc3, 0x50, 0x0a, 0xa5, 0xb0, 0x21, 0x30, 0x85, 0x0d, 0xc3, 0x40, 0x0a,
-  0xa7, 0x40, 0x60, 0x43, 0x01, 0xa4, 0x02, 0x00, 0x00, 0xfc, 0x02, 0x7e,
-  0x88, 0xd2, 0xca, 0xd8, 0xca, 0xc6, 0xe8, 0xe4, 0xd2, 0xc6, 0x92, 0xdc,
-  0xe8, 0xca, 0xe4, 0xe6, 0xca, 0xc6, 0xe8, 0xd2, 0xde, 0xdc, 0x80, 0x80,
-  0xb2, 0x82, 0xb0, 0xb0, 0xb4, 0x26, 0x08, 0xc4, 0xb6, 0x21, 0x58, 0x36,
-  0x10, 0xac, 0xc0, 0x0a, 0x66, 0xd0, 0x0a, 0x1b, 0x0a, 0x52, 0x58, 0x05,
-  0x00, 0x70, 0x05, 0x3e, 0x6f, 0x6d, 0x6e, 0x69, 0x70, 0x6f, 0x74, 0x65,
-  0x6e, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x8c, 0xa6, 0xd2, 0xda, 0xe0,
-  0xd8, 0xca, 0x40, 0x86, 0x5e, 0x86, 0x56, 0x56, 0x40, 0xa8, 0x84, 0x82,
-  0x82, 0x36, 0x04, 0xb1, 0x30, 0x41, 0xf8, 0xb8, 0x0d, 0x03, 0x2c, 0xc8,
-  0xc2, 0x2c, 0x6c, 0x18, 0x68, 0x81, 0x16, 0x66, 0xa1, 0x0a, 0x1b, 0x9b,
-  0x5d, 0x9b, 0x4b, 0x1a, 0x59, 0x99, 0x1b, 0xdd, 0x94, 0x20, 0xa8, 0x42,
-  0x86, 0xe7, 0x62, 0x57, 0x26, 0x37, 0x97, 0xf6, 0xe6, 0x36, 0x25, 0x20,
-  0x9a, 0x90, 0xe1, 0xb9, 0xd8, 0x85, 0xb1, 0xd9, 0x95, 0xc9, 0x4d, 0x09,
-  0x8c, 0x3a, 0x64, 0x78, 0x2e, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x4d,
-  0x6f, 0x64, 0x65, 0x6c, 0x53, 0x82, 0xa4, 0x12, 0x19, 0x9e, 0x0b, 0x5d,
-  0x1e, 0x5c, 0x59, 0x90, 0x9b, 0xdb, 0x1b, 0x5d, 0x18, 0x5d, 0xda, 0x9b,
-  0xdb, 0xdc, 0x14, 0x41, 0x14, 0x4e, 0xa1, 0x0e, 0x19, 0x9e, 0x4b, 0x99,
-  0x1b, 0x9d, 0x5c, 0x1e, 0xd4, 0x5b, 0x9a, 0x1b, 0xdd, 0xdc, 0x14, 0x21,
-  0x15, 0x5c, 0x01, 0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88,
-  0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73,
-  0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e,
-  0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30,
-  0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8,
-  0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b,
-  0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76,
-  0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e,
-  0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e,
-  0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61,
-  0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4,
-  0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76,
-  0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37,
-  0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76,
-  0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71,
-  0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e,
-  0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1,
-  0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61,
-  0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90,
-  0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8,
-  0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc,
-  0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x8c, 0xcc,
-  0x21, 0x07, 0x7c, 0x70, 0x03, 0x74, 0x60, 0x07, 0x37, 0x90, 0x87, 0x72,
-  0x98, 0x87, 0x77, 0xa8, 0x07, 0x79, 0x18, 0x87, 0x72, 0x70, 0x83, 0x70,
-  0xa0, 0x07, 0x7a, 0x90, 0x87, 0x74, 0x10, 0x87, 0x7a, 0xa0, 0x87, 0x72,
-  0x00, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x66, 0x50, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x04, 0x60, 0x2d, 0x47, 0x45,
-  0x11, 0xd1, 0x4c, 0x7e, 0x71, 0xdb, 0x26, 0xe0, 0x0c, 0x97, 0xef, 0x3c,
-  0xfe, 0xe0, 0x4c, 0xb7, 0x5f, 0xdc, 0x76, 0x01, 0x7c, 0x81, 0x1f, 0x31,
-  0x5d, 0x66, 0x97, 0xc7, 0x74, 0x79, 0x7a, 0x9c, 0x74, 0xd3, 0xcb, 0xf2,
-  0x79, 0x79, 0x4c, 0x4f, 0xbf, 0xdd, 0x40, 0x60, 0x36, 0x88, 0xc5, 0x6a,
-  0x6d, 0x80, 0x1b, 0x2e, 0xdf, 0x79, 0x7c, 0x27, 0x48, 0x08, 0x61, 0x5a,
-  0x01, 0xac, 0x43, 0x22, 0x42, 0x98, 0x10, 0xa7, 0xf1, 0x8b, 0xdb, 0xb6,
-  0x82, 0x36, 0x18, 0x2e, 0xdf, 0x79, 0xfc, 0x88, 0x78, 0x9c, 0x68, 0x0a,
-  0x91, 0xc9, 0x97, 0xa6, 0x88, 0x12, 0x26, 0x5f, 0x6c, 0x26, 0x22, 0x92,
-  0x08, 0x61, 0x42, 0x9c, 0x46, 0x9b, 0xa6, 0x08, 0x09, 0xa8, 0x89, 0x90,
-  0x8c, 0x20, 0x1b, 0x2e, 0xdf, 0x79, 0x7c, 0x27, 0x48, 0x08, 0x61, 0x5a,
-  0x01, 0x0c, 0x8d, 0x10, 0x03, 0x69, 0xfc, 0xe2, 0xb6, 0x2d, 0xe0, 0x19,
-  0x2e, 0xdf, 0x79, 0x7c, 0xaa, 0x01, 0x22, 0xcc, 0x2f, 0x6e, 0x1b, 0x00,
-  0x61, 0x20, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x13, 0x04, 0x43, 0x2c,
-  0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x94, 0x14, 0x41, 0x09,
-  0x8c, 0x00, 0x10, 0x51, 0xbc, 0x02, 0x45, 0x2b, 0x50, 0x6e, 0xc5, 0x2a,
-  0x50, 0xaa, 0x02, 0x05, 0x53, 0x32, 0x34, 0x8c, 0x11, 0x80, 0x20, 0x08,
-  0x82, 0xa0, 0x30, 0x02, 0x30, 0x46, 0x00, 0x82, 0x20, 0x88, 0x82, 0xc1,
-  0x18, 0x01, 0x08, 0x82, 0x20, 0xfe, 0x0b, 0x63, 0x04, 0x20, 0x08, 0x82,
-  0x20, 0x18, 0x50, 0x33, 0x03, 0x00, 0x00, 0x00, 0x33, 0x11, 0x0e, 0x71,
-  0x8c, 0xc2, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x28, 0x71, 0xb0, 0x3c,
-  0x23, 0x06, 0x06, 0x00, 0x82, 0x60, 0xa0, 0xc8, 0x01, 0x13, 0x8d, 0x18,
-  0x18, 0x00, 0x08, 0x82, 0x81, 0x32, 0x07, 0xcd, 0x34, 0x62, 0xb0, 0x00,
-  0x20, 0x08, 0x06, 0x47, 0x1d, 0x3c, 0x83, 0x10, 0x0c, 0x42, 0x30, 0x62,
-  0x60, 0x00, 0x20, 0x08, 0x06, 0x0a, 0x1d, 0x38, 0xd3, 0x88, 0x81, 0x01,
-  0x80, 0x20, 0x18, 0x28, 0x75, 0xf0, 0x54, 0x23, 0x06, 0x06, 0x00, 0x82,
-  0x60, 0xa0, 0xd8, 0x01, 0x74, 0x8d, 0x18, 0x2c, 0x00, 0x08, 0x82, 0xc1,
-  0x91, 0x07, 0xd3, 0x61, 0x14, 0x83, 0x10, 0x58, 0xb0, 0xc8, 0x67, 0xc4,
-  0x60, 0x01, 0x40, 0x10, 0x0c, 0x8e, 0x3d, 0xa8, 0x0a, 0x62, 0x28, 0x88,
-  0xc1, 0x02, 0x07, 0x3e, 0x36, 0x0c, 0xf2, 0xb1, 0x24, 0x92, 0x8f, 0x05,
-  0x83, 0x7c, 0x6c, 0x08, 0xe2, 0x33, 0x1c, 0x11, 0x54, 0xcc, 0x37, 0xcb,
-  0x20, 0x04, 0x81, 0x5d, 0x48, 0x7c, 0x46, 0x0c, 0x0c, 0x00, 0x04, 0xc1,
-  0xa0, 0x20, 0x05, 0x6d, 0x30, 0x21, 0x88, 0x8f, 0x41, 0x96, 0x7c, 0x4c,
-  0x08, 0xe8, 0x63, 0x55, 0x20, 0x1f, 0xab, 0x04, 0xf9, 0x58, 0x35, 0xc8,
-  0xc7, 0x06, 0x0a, 0x3e, 0x36, 0x50, 0xf0, 0xb1, 0x81, 0x82, 0xcf, 0x1c,
-  0x43, 0x37, 0x90, 0xc2, 0x1c, 0x43, 0x30, 0xa4, 0xc2, 0x1c, 0x43, 0x30,
-  0x84, 0xc2, 0x76, 0x86, 0xef, 0x14, 0x4e, 0x61, 0xd8, 0x80, 0x08, 0x84,
-  0x01, 0x18, 0x31, 0x58, 0x00, 0x10, 0x04, 0x83, 0x23, 0x16, 0xd6, 0xe0,
-  0x30, 0x8a, 0xc3, 0x28, 0x46, 0x0c, 0x0c, 0x00, 0x04, 0xc1, 0xa0, 0x98,
-  0x05, 0x34, 0x08, 0x2c, 0x48, 0xe4, 0x63, 0x42, 0x22, 0x1f, 0x4b, 0x06,
-  0xf9, 0xcc, 0x31, 0x98, 0xc1, 0xd0, 0x0a, 0x73, 0x0c, 0xc1, 0x20, 0x0b,
-  0x73, 0x0c, 0xc1, 0xa0, 0x0a, 0xdb, 0x19, 0xd0, 0x00, 0x16, 0x68, 0x61,
-  0xd8, 0x80, 0x08, 0x84, 0x01, 0x18, 0x31, 0x28, 0x00, 0x10, 0x04, 0x03,
-  0xc9, 0x16, 0xea, 0x60, 0xc4, 0x00, 0x29, 0x40, 0x10, 0x0c, 0x20, 0x5c,
-  0xb8, 0x83, 0x40, 0x16, 0xd4, 0x60, 0x96, 0x40, 0xc0, 0x70, 0x20, 0x00,
-  0x35, 0x00, 0x00, 0x00, 0x46, 0x43, 0xa1, 0x41, 0x42, 0x08, 0xd3, 0x0a,
-  0x60, 0x1d, 0x12, 0x11, 0xc2, 0x84, 0x38, 0x0d, 0x7e, 0x5b, 0x0d, 0x85,
-  0x06, 0x09, 0x21, 0x4c, 0x2b, 0x80, 0x75, 0x48, 0x44, 0x08, 0x13, 0xe2,
-  0x34, 0x38, 0x6e, 0x36, 0x14, 0x1a, 0x24, 0x84, 0x30, 0xad, 0x00, 0xd6,
-  0x21, 0x11, 0x21, 0x4c, 0x88, 0xd3, 0xe0, 0xb9, 0x31, 0x15, 0x3e, 0x42,
-  0xe3, 0xba, 0x39, 0x15, 0x3e, 0x62, 0xe3, 0xbc, 0x65, 0x21, 0x3e, 0xf5,
-  0x4c, 0x4e, 0x9d, 0xf7, 0xc6, 0xb5, 0xac, 0x00, 0xd6, 0x72, 0x54, 0x14,
-  0x11, 0xcd, 0x64, 0x55, 0x85, 0x8f, 0xd0, 0xf9, 0x6d, 0x57, 0x85, 0x8f,
-  0xd8, 0xf9, 0x6e, 0x54, 0xc5, 0x2a, 0x41, 0xd1, 0x64, 0x4f, 0x86, 0x4f,
-  0x3d, 0x93, 0x43, 0x1b, 0x94, 0xe1, 0x53, 0xcf, 0xe4, 0xd4, 0x56, 0x44,
-  0xb0, 0x50, 0x34, 0x59, 0x53, 0xe1, 0x23, 0x35, 0xbe, 0x1b, 0x4e, 0x84,
-  0x06, 0x09, 0x21, 0x4c, 0x2b, 0x80, 0xa1, 0x11, 0x62, 0x20, 0xcd, 0xbd,
-  0x5b, 0x4e, 0x84, 0x06, 0x09, 0x21, 0x4c, 0x2b, 0x80, 0xa1, 0x11, 0x62,
-  0x20, 0xcd, 0xcd, 0x9b, 0x4e, 0x84, 0x06, 0x09, 0x21, 0x4c, 0x2b, 0x80,
-  0xa1, 0x11, 0x62, 0x20, 0xcd, 0xdd, 0x1b, 0x16, 0xe2, 0x53, 0xcf, 0xe4,
-  0xd0, 0x39, 0x6f, 0x33, 0x8a, 0x36, 0x4d, 0x11, 0x12, 0x50, 0x13, 0x21,
-  0x59, 0xd2, 0xe0, 0x23, 0xb4, 0x2d, 0x0d, 0x3e, 0x62, 0x9b, 0xd2, 0xe0,
-  0x23, 0xb5, 0x59, 0x15, 0x3e, 0x52, 0xe7, 0x39, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x31, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5b, 0x86, 0x30, 0x08,
-  0x68, 0x61, 0xcb, 0xb0, 0x06, 0x01, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00
-};
@@ -1,415 +0,0 @@
-#if 0
-;
-; Buffer Definitions:
-;
-; cbuffer Constants
-; {
-;
-;   struct Constants
-;   {
-;
-;       struct struct.InlineConstantBuffer
-;       {
-;
-;           column_major float4x4 CameraToWorld;      ; Offset:    0
-;           float4 SkyTopColor;                       ; Offset:   64
-;           float4 SkyBottomColor;                    ; Offset:   80
-;           uint RandomFloatCount;                    ; Offset:   96
-;           float3 Pad01;                             ; Offset:  100
-;           float VertFoVRad;                         ; Offset:  112
-;           uint MaxRecursionDepth;                   ; Offset:  116
-;           uint RaysPerPixel;                        ; Offset:  120
-;           float LambertianAttenuationValue;         ; Offset:  124
-;       
-;       } Constants                                   ; Offset:    0
-;
-;   
-;   } Constants                                       ; Offset:    0 Size:   128
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; Constants                         cbuffer      NA          NA     CB0            cb0     1
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%Constants = type { %struct.InlineConstantBuffer }
-%struct.InlineConstantBuffer = type { %class.matrix.float.4.4, <4 x float>, <4 x float>, i32, <3 x float>, float, i32, i32, float }
-%class.matrix.float.4.4 = type { [4 x <4 x float>] }
-%struct.RayPayload = type { <3 x float>, <3 x float>, i32, i32 }
-%dx.types.Handle = type { i8* }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%struct.RaytracingAccelerationStructure = type { i32 }
-%"class.RWTexture2D<vector<float, 4> >" = type { <4 x float> }
-%"class.RWBuffer<float>" = type { float }
-
-@Constants = external constant %Constants
-
-; Function Attrs: nounwind
-define void @"\01?LambertianMiss@@YAXURayPayload@@@Z"(%struct.RayPayload* noalias nocapture %Payload) #0 {
-  %1 = load %Constants, %Constants* @Constants, align 4
-  %Constants = call %dx.types.Handle @dx.op.createHandleForLib.Constants(i32 160, %Constants %1)  ; CreateHandleForLib(Resource)
-  %2 = getelementptr inbounds %struct.RayPayload, %struct.RayPayload* %Payload, i32 0, i32 2
-  %3 = load i32, i32* %2, align 4, !tbaa !40
-  %4 = icmp eq i32 %3, 0
-  br i1 %4, label %5, label %30
-
-; <label>:5                                       ; preds = %0
-  %WorldRayDirection1 = call float @dx.op.worldRayDirection.f32(i32 148, i8 1)  ; WorldRayDirection(col)
-  %6 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %Constants, i32 5)  ; CBufferLoadLegacy(handle,regIndex)
-  %7 = extractvalue %dx.types.CBufRet.f32 %6, 0
-  %8 = extractvalue %dx.types.CBufRet.f32 %6, 1
-  %9 = extractvalue %dx.types.CBufRet.f32 %6, 2
-  %10 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %Constants, i32 4)  ; CBufferLoadLegacy(handle,regIndex)
-  %11 = extractvalue %dx.types.CBufRet.f32 %10, 0
-  %12 = extractvalue %dx.types.CBufRet.f32 %10, 1
-  %13 = extractvalue %dx.types.CBufRet.f32 %10, 2
-  %14 = fmul fast float %WorldRayDirection1, 5.000000e-01
-  %15 = fsub fast float 5.000000e-01, %14
-  %16 = fmul fast float %15, %7
-  %17 = fadd fast float %14, 5.000000e-01
-  %18 = fmul fast float %11, %17
-  %19 = fadd fast float %18, %16
-  %20 = insertelement <3 x float> undef, float %19, i32 0
-  %21 = fmul fast float %15, %8
-  %22 = fmul fast float %12, %17
-  %23 = fadd fast float %22, %21
-  %24 = insertelement <3 x float> %20, float %23, i32 1
-  %25 = fmul fast float %15, %9
-  %26 = fmul fast float %13, %17
-  %27 = fadd fast float %26, %25
-  %28 = insertelement <3 x float> %24, float %27, i32 2
-  %29 = getelementptr inbounds %struct.RayPayload, %struct.RayPayload* %Payload, i32 0, i32 0
-  store <3 x float> %28, <3 x float>* %29, align 4, !tbaa !44
-  br label %30
-
-; <label>:30                                      ; preds = %5, %0
-  ret void
-}
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.worldRayDirection.f32(i32, i8) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandleForLib.Constants(i32, %Constants) #1
-
-attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "no-realign-stack" "stack-protector-buffer-size"="0" "unsafe-fp-math"="false" "use-soft-float"="false" }
-attributes #1 = { nounwind readonly }
-attributes #2 = { nounwind readnone }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.typeAnnotations = !{!7, !31}
-!dx.entryPoints = !{!36, !37}
-
-!0 = !{!"dxc 1.2"}
-!1 = !{i32 1, i32 3}
-!2 = !{i32 1, i32 4}
-!3 = !{!"lib", i32 6, i32 3}
-!4 = !{null, null, !5, null}
-!5 = !{!6}
-!6 = !{i32 0, %Constants* @Constants, !"Constants", i32 0, i32 0, i32 1, i32 128, null}
-!7 = !{i32 0, %struct.RaytracingAccelerationStructure undef, !8, %"class.RWTexture2D<vector<float, 4> >" undef, !10, %"class.RWBuffer<float>" undef, !12, %struct.InlineConstantBuffer undef, !13, %struct.RayPayload undef, !24, %Constants undef, !29}
-!8 = !{i32 4, !9}
-!9 = !{i32 6, !"h", i32 3, i32 0, i32 7, i32 4}
-!10 = !{i32 16, !11}
-!11 = !{i32 6, !"h", i32 3, i32 0, i32 7, i32 9}
-!12 = !{i32 4, !11}
-!13 = !{i32 128, !14, !16, !17, !18, !19, !20, !21, !22, !23}
-!14 = !{i32 6, !"CameraToWorld", i32 2, !15, i32 3, i32 0, i32 7, i32 9}
-!15 = !{i32 4, i32 4, i32 2}
-!16 = !{i32 6, !"SkyTopColor", i32 3, i32 64, i32 7, i32 9}
-!17 = !{i32 6, !"SkyBottomColor", i32 3, i32 80, i32 7, i32 9}
-!18 = !{i32 6, !"RandomFloatCount", i32 3, i32 96, i32 7, i32 5}
-!19 = !{i32 6, !"Pad01", i32 3, i32 100, i32 7, i32 9}
-!20 = !{i32 6, !"VertFoVRad", i32 3, i32 112, i32 7, i32 9}
-!21 = !{i32 6, !"MaxRecursionDepth", i32 3, i32 116, i32 7, i32 5}
-!22 = !{i32 6, !"RaysPerPixel", i32 3, i32 120, i32 7, i32 5}
-!23 = !{i32 6, !"LambertianAttenuationValue", i32 3, i32 124, i32 7, i32 9}
-!24 = !{i32 36, !25, !26, !27, !28}
-!25 = !{i32 6, !"Color", i32 3, i32 0, i32 7, i32 9}
-!26 = !{i32 6, !"WorldLastScatterDirection", i32 3, i32 16, i32 7, i32 9}
-!27 = !{i32 6, !"IntersectionCount", i32 3, i32 28, i32 7, i32 5}
-!28 = !{i32 6, !"RecursionDepth", i32 3, i32 32, i32 7, i32 5}
-!29 = !{i32 128, !30}
-!30 = !{i32 6, !"Constants", i32 3, i32 0}
-!31 = !{i32 1, void (%struct.RayPayload*)* @"\01?LambertianMiss@@YAXURayPayload@@@Z", !32}
-!32 = !{!33, !35}
-!33 = !{i32 1, !34, !34}
-!34 = !{}
-!35 = !{i32 2, !34, !34}
-!36 = !{null, !"", null, !4, null}
-!37 = !{void (%struct.RayPayload*)* @"\01?LambertianMiss@@YAXURayPayload@@@Z", !"\01?LambertianMiss@@YAXURayPayload@@@Z", null, null, !38}
-!38 = !{i32 8, i32 11, i32 6, i32 32, i32 5, !39}
-!39 = !{i32 0}
-!40 = !{!41, !41, i64 0}
-!41 = !{!"int", !42, i64 0}
-!42 = !{!"omnipotent char", !43, i64 0}
-!43 = !{!"Simple C/C++ TBAA"}
-!44 = !{!42, !42, i64 0}
-
-#endif
-
-const unsigned char LambertianMiss[] = {
-  0x44, 0x58, 0x42, 0x43, 0x10, 0x6e, 0x67, 0x9a, 0xd6, 0xd0, 0x9f, 0xb6,
-  0x34, 0x59, 0x06, 0xb6, 0x65, 0x73, 0xff, 0x99, 0x01, 0x00, 0x00, 0x00,
-  0xb0, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0x44, 0x41, 0x54, 0xdc, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x90, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x74, 0x73, 0x00, 0x01, 0x3f, 0x4c, 0x61, 0x6d, 0x62, 0x65, 0x72, 0x74,
-  0x69, 0x61, 0x6e, 0x4d, 0x69, 0x73, 0x73, 0x40, 0x40, 0x59, 0x41, 0x58,
-  0x55, 0x52, 0x61, 0x79, 0x50, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x40,
-  0x40, 0x40, 0x5a, 0x00, 0x4c, 0x61, 0x6d, 0x62, 0x65, 0x72, 0x74, 0x69,
-  0x61, 0x6e, 0x4d, 0x69, 0x73, 0x73, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x00, 0x00, 0x63, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x44, 0x58, 0x49, 0x4c, 0x88, 0x0a, 0x00, 0x00, 0x63, 0x00, 0x06, 0x00,
-  0xa2, 0x02, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x03, 0x01, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x70, 0x0a, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde,
-  0x21, 0x0c, 0x00, 0x00, 0x99, 0x02, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91,
-  0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c,
-  0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02,
-  0x42, 0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b,
-  0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5,
-  0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 0x50,
-  0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46, 0x06,
-  0x51, 0x18, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0x20, 0x00,
-  0x12, 0x60, 0xd9, 0x00, 0x1e, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x80,
-  0x44, 0x90, 0x43, 0x3a, 0xcc, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0x43,
-  0x1b, 0xd0, 0x43, 0x38, 0xa4, 0x03, 0x3b, 0xb4, 0xc1, 0x38, 0x84, 0x03,
-  0x3b, 0xb0, 0xc3, 0x3c, 0x00, 0xe6, 0x10, 0x0e, 0xec, 0x30, 0x0f, 0xe5,
-  0x00, 0x10, 0xec, 0x50, 0x0e, 0xf3, 0x30, 0x0f, 0x6d, 0x00, 0x0f, 0xf2,
-  0x50, 0x0e, 0xe3, 0x90, 0x0e, 0xf3, 0x50, 0x0e, 0x6d, 0x60, 0x0e, 0xf0,
-  0xd0, 0x0e, 0xe1, 0x40, 0x0e, 0x80, 0x39, 0x84, 0x03, 0x3b, 0xcc, 0x43,
-  0x39, 0x00, 0x84, 0x3b, 0xbc, 0x43, 0x1b, 0x98, 0x83, 0x3c, 0x84, 0x43,
-  0x3b, 0x94, 0x43, 0x1b, 0xc0, 0xc3, 0x3b, 0xa4, 0x83, 0x3b, 0xd0, 0x43,
-  0x39, 0xc8, 0x43, 0x1b, 0x94, 0x03, 0x3b, 0xa4, 0x43, 0x3b, 0x00, 0xe6,
-  0x10, 0x0e, 0xec, 0x30, 0x0f, 0xe5, 0x00, 0x10, 0xee, 0xf0, 0x0e, 0x6d,
-  0x90, 0x0e, 0xee, 0x60, 0x0e, 0xf3, 0xd0, 0x06, 0xe6, 0x00, 0x0f, 0x6d,
-  0xd0, 0x0e, 0xe1, 0x40, 0x0f, 0xe8, 0x00, 0x98, 0x43, 0x38, 0xb0, 0xc3,
-  0x3c, 0x94, 0x03, 0x40, 0xb8, 0xc3, 0x3b, 0xb4, 0x81, 0x3b, 0x84, 0x83,
-  0x3b, 0xcc, 0x43, 0x1b, 0x98, 0x03, 0x3c, 0xb4, 0x41, 0x3b, 0x84, 0x03,
-  0x3d, 0xa0, 0x03, 0x60, 0x0e, 0xe1, 0xc0, 0x0e, 0xf3, 0x50, 0x0e, 0xc0,
-  0xe0, 0x0e, 0xef, 0xd0, 0x06, 0xf2, 0x50, 0x0e, 0xe1, 0xc0, 0x0e, 0xe9,
-  0x70, 0x0e, 0xee, 0xd0, 0x06, 0xf3, 0x40, 0x0f, 0xe1, 0x30, 0x0e, 0xeb,
-  0x00, 0x10, 0xf3, 0x40, 0x0f, 0xe1, 0x30, 0x0e, 0xeb, 0xd0, 0x06, 0xf0,
-  0x20, 0x0f, 0xef, 0x40, 0x0f, 0xe5, 0x30, 0x0e, 0xf4, 0xf0, 0x0e, 0xf2,
-  0xd0, 0x06, 0xe2, 0x50, 0x0f, 0xe6, 0x60, 0x0e, 0xe5, 0x20, 0x0f, 0x6d,
-  0x30, 0x0f, 0xe9, 0xa0, 0x0f, 0xe5, 0x00, 0xc0, 0x01, 0x40, 0xd4, 0x83,
-  0x3b, 0xcc, 0x43, 0x38, 0x98, 0x43, 0x39, 0xb4, 0x81, 0x39, 0xc0, 0x43,
-  0x1b, 0xb4, 0x43, 0x38, 0xd0, 0x03, 0x3a, 0x00, 0xe6, 0x10, 0x0e, 0xec,
-  0x30, 0x0f, 0xe5, 0x00, 0x10, 0xf5, 0x30, 0x0f, 0xe5, 0xd0, 0x06, 0xf3,
-  0xf0, 0x0e, 0xe6, 0x40, 0x0f, 0x6d, 0x60, 0x0e, 0xec, 0xf0, 0x0e, 0xe1,
-  0x40, 0x0f, 0x80, 0x39, 0x84, 0x03, 0x3b, 0xcc, 0x43, 0x39, 0x00, 0x1b,
-  0x8c, 0xe1, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xaa, 0x0d, 0x06,
-  0xf1, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x84, 0x40, 0x98,
-  0x10, 0x0c, 0x13, 0x02, 0x02, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00,
-  0x52, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85, 0x04,
-  0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14,
-  0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 0x84, 0xc1, 0x0c,
-  0xc0, 0x30, 0x02, 0x01, 0x24, 0x41, 0x70, 0x96, 0xb0, 0x00, 0x92, 0xe4,
-  0x33, 0xc0, 0x14, 0x21, 0x97, 0x5f, 0x2c, 0x0e, 0x30, 0xf9, 0xb8, 0x8f,
-  0xa3, 0x40, 0x98, 0x23, 0x00, 0x83, 0x61, 0x84, 0x01, 0xb8, 0x4d, 0x9a,
-  0x22, 0x4a, 0x98, 0x7c, 0xb1, 0x59, 0x90, 0x86, 0xe0, 0x9c, 0x46, 0x9a,
-  0x80, 0x66, 0xda, 0xa8, 0xa2, 0x20, 0x22, 0x94, 0x0c, 0x41, 0x40, 0x14,
-  0x00, 0x41, 0x00, 0x97, 0x70, 0x4e, 0x23, 0x4d, 0x40, 0x33, 0x49, 0x28,
-  0x30, 0xe8, 0x18, 0x01, 0xb8, 0x48, 0x9a, 0x22, 0x4a, 0x98, 0xfc, 0x15,
-  0xc0, 0x52, 0x00, 0x5b, 0x1c, 0x60, 0x40, 0x44, 0x51, 0x10, 0x04, 0x29,
-  0x45, 0x48, 0x16, 0x62, 0x8e, 0x1a, 0x2e, 0x7f, 0xc2, 0x1e, 0x42, 0xf2,
-  0xb9, 0x8d, 0x2a, 0x56, 0x62, 0xf2, 0x8b, 0xdb, 0x46, 0x04, 0x00, 0x00,
-  0xc0, 0x1c, 0x01, 0x42, 0xcf, 0x3d, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 0x48,
-  0x7e, 0x08, 0x34, 0xc3, 0x42, 0xa0, 0x00, 0x2a, 0x84, 0x43, 0x44, 0x04,
-  0x49, 0x65, 0x00, 0x88, 0x87, 0xa8, 0x32, 0x44, 0xc4, 0x41, 0xd6, 0x40,
-  0xc0, 0x99, 0x81, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x2b, 0x80, 0x4d, 0x11,
-  0x20, 0x20, 0x8d, 0xa1, 0x09, 0x02, 0xb1, 0x10, 0x11, 0x30, 0x21, 0x4e,
-  0xc3, 0x4e, 0x11, 0x25, 0x4c, 0x54, 0x44, 0xa0, 0x80, 0x98, 0x89, 0x0c,
-  0xc6, 0x81, 0x1d, 0xc2, 0x61, 0x1e, 0xe6, 0xc1, 0x0d, 0x64, 0xe1, 0x16,
-  0x68, 0xa1, 0x1c, 0xf0, 0x81, 0x1e, 0xea, 0x41, 0x1e, 0xca, 0x41, 0x0e,
-  0x48, 0x81, 0x0f, 0xec, 0xa1, 0x1c, 0xc6, 0x81, 0x1e, 0xde, 0x41, 0x1e,
-  0xf8, 0xc0, 0x1c, 0xd8, 0xe1, 0x1d, 0xc2, 0x81, 0x1e, 0xd8, 0x00, 0x0c,
-  0xe8, 0xc0, 0x0f, 0xc0, 0xc0, 0x0f, 0x50, 0x10, 0xcc, 0x54, 0x8d, 0x03,
-  0x3b, 0x84, 0xc3, 0x3c, 0xcc, 0x83, 0x1b, 0xc8, 0xc2, 0x2d, 0x88, 0x42,
-  0x3d, 0x98, 0x83, 0x39, 0x94, 0x83, 0x3c, 0xf0, 0x81, 0x39, 0xb0, 0xc3,
-  0x3b, 0x84, 0x03, 0x3d, 0xf8, 0x01, 0x0a, 0x00, 0x22, 0xe6, 0x08, 0x40,
-  0x61, 0x8e, 0x20, 0x98, 0x02, 0xa0, 0x02, 0x00, 0x13, 0x14, 0x72, 0xc0,
-  0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0,
-  0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d,
-  0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a,
-  0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74,
-  0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6,
-  0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78,
-  0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76,
-  0x40, 0x07, 0x3a, 0x0f, 0x64, 0x90, 0x21, 0x23, 0x25, 0x40, 0x00, 0x7e,
-  0x00, 0xc0, 0x90, 0x87, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x21, 0x8f, 0x04, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x0a, 0x08, 0x80, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x16, 0x10, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x81, 0x00, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18, 0x19, 0x11, 0x4c, 0x90,
-  0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x22, 0x4a, 0xa0, 0x0c, 0x0a,
-  0xa1, 0x18, 0x46, 0x00, 0x0a, 0x50, 0xa0, 0x1c, 0x0a, 0xa4, 0x24, 0x8a,
-  0xa0, 0x00, 0x03, 0x0a, 0x34, 0xa0, 0x80, 0x03, 0x4a, 0xa1, 0x90, 0x03,
-  0x0a, 0x3c, 0xa0, 0xd0, 0x03, 0x0a, 0x3e, 0xa0, 0xf0, 0x03, 0x0a, 0xa9,
-  0x70, 0x0a, 0xa8, 0x20, 0xca, 0x82, 0xba, 0x11, 0x00, 0x3a, 0x66, 0x00,
-  0x48, 0x99, 0x01, 0xa0, 0x6c, 0x06, 0x80, 0xb4, 0x19, 0x00, 0xda, 0x66,
-  0x00, 0xc8, 0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00,
-  0xd1, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0xc4,
-  0x83, 0x0c, 0x6f, 0x0c, 0x24, 0xc6, 0x45, 0x66, 0x43, 0x10, 0x4c, 0x10,
-  0x88, 0x62, 0x82, 0x40, 0x18, 0x1b, 0x84, 0x81, 0x98, 0x20, 0x10, 0xc7,
-  0x06, 0x61, 0x30, 0x38, 0xb0, 0xa5, 0x89, 0x4d, 0x10, 0x08, 0x64, 0xc3,
-  0x80, 0x24, 0xc4, 0x04, 0x81, 0x48, 0x26, 0x08, 0x08, 0xc0, 0x64, 0xe8,
-  0xcd, 0x6d, 0x8e, 0x2e, 0xcc, 0x8d, 0x6e, 0x6e, 0x82, 0x40, 0x28, 0x1b,
-  0x90, 0x85, 0x69, 0x96, 0x65, 0x70, 0x80, 0x0d, 0xc1, 0xb3, 0x81, 0x00,
-  0x00, 0x08, 0x98, 0x20, 0x64, 0x60, 0xc0, 0x00, 0x6d, 0x82, 0x40, 0x2c,
-  0x1b, 0x8c, 0x64, 0x22, 0x16, 0xca, 0xd8, 0x20, 0x18, 0xd5, 0x04, 0x41,
-  0x0b, 0x83, 0x09, 0x02, 0xc1, 0x4c, 0x10, 0x88, 0x66, 0x83, 0x91, 0x4c,
-  0xc4, 0x42, 0x65, 0x1b, 0x04, 0x4c, 0x9b, 0x20, 0x6c, 0x62, 0xb0, 0x41,
-  0x30, 0xb4, 0x09, 0x82, 0x31, 0x06, 0x6c, 0x86, 0xc2, 0xda, 0xca, 0xe4,
-  0xc2, 0xa8, 0xde, 0xae, 0xde, 0xe4, 0xd8, 0xc8, 0x26, 0x08, 0x84, 0xb3,
-  0x61, 0x30, 0x0c, 0x30, 0xd8, 0x80, 0x24, 0x1f, 0x18, 0x84, 0x01, 0xb1,
-  0x50, 0x19, 0x97, 0xa9, 0xb5, 0x3c, 0xaa, 0x37, 0xb8, 0xa1, 0x37, 0xb6,
-  0x37, 0xb9, 0x09, 0x02, 0xf1, 0x6c, 0x30, 0x92, 0x31, 0x20, 0xc8, 0x80,
-  0xca, 0xe8, 0x4c, 0xad, 0xe5, 0x09, 0xbd, 0xd1, 0xd1, 0xbd, 0xb5, 0x0d,
-  0xbd, 0xb1, 0xbd, 0xc9, 0x4d, 0x10, 0x08, 0x68, 0x83, 0x91, 0x98, 0x01,
-  0x71, 0x06, 0x54, 0x46, 0x48, 0x2a, 0xcc, 0x8d, 0xec, 0xad, 0xcd, 0x88,
-  0xed, 0x2d, 0x8c, 0x6e, 0xe8, 0xad, 0xce, 0x8d, 0x6e, 0x82, 0x40, 0x44,
-  0x13, 0x04, 0x42, 0xda, 0x60, 0x24, 0x69, 0x40, 0xa8, 0x01, 0xb5, 0x06,
-  0x2c, 0xa0, 0xc2, 0xc8, 0x60, 0x62, 0x26, 0x08, 0xc4, 0xb4, 0xc1, 0x48,
-  0xda, 0x80, 0x70, 0x03, 0x2a, 0xa3, 0x62, 0x55, 0x26, 0x47, 0x67, 0xf4,
-  0x66, 0x25, 0x15, 0x46, 0x36, 0x41, 0x20, 0xa8, 0x0d, 0x46, 0x02, 0x07,
-  0x44, 0x1c, 0x50, 0x19, 0xa3, 0xa6, 0x30, 0x3c, 0xa9, 0xb2, 0xb1, 0x3a,
-  0xb9, 0xb9, 0xb4, 0x37, 0x37, 0xa2, 0x32, 0x38, 0x3a, 0xb4, 0x09, 0x02,
-  0x51, 0x6d, 0x30, 0x92, 0x39, 0x20, 0xe8, 0x80, 0x5a, 0x03, 0x32, 0x52,
-  0x61, 0x79, 0x73, 0x50, 0x65, 0x72, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x13,
-  0x04, 0xc2, 0xda, 0x60, 0x24, 0x76, 0x40, 0xdc, 0x01, 0xb5, 0x06, 0xd4,
-  0x98, 0xc2, 0xda, 0xc4, 0xca, 0xe4, 0xe8, 0xd2, 0xc2, 0xdc, 0x82, 0xe8,
-  0xe8, 0xca, 0xdc, 0xea, 0xc2, 0xe8, 0xd2, 0xde, 0xdc, 0xac, 0xc2, 0xd8,
-  0xea, 0xca, 0x26, 0x08, 0xc4, 0xb5, 0xc1, 0x48, 0xf2, 0x80, 0xd0, 0x03,
-  0x2a, 0xdb, 0xa0, 0x38, 0x62, 0x50, 0x06, 0x68, 0xc0, 0x06, 0x6f, 0x20,
-  0x07, 0x75, 0x80, 0x07, 0x7b, 0x30, 0x41, 0x50, 0xbe, 0x09, 0x02, 0x81,
-  0xb1, 0x18, 0x7a, 0x63, 0x7b, 0x93, 0xdb, 0x60, 0x24, 0x7f, 0x40, 0x2c,
-  0x54, 0xc6, 0xec, 0xea, 0x4d, 0x8e, 0x8d, 0x8c, 0x29, 0x6c, 0x8e, 0x6e,
-  0x6a, 0x2c, 0x8c, 0x8e, 0xae, 0x4c, 0x8e, 0x28, 0x4d, 0xae, 0x6c, 0x8c,
-  0x2e, 0xed, 0xcd, 0x6d, 0x83, 0x91, 0x84, 0x02, 0x81, 0x51, 0x19, 0xa3,
-  0x24, 0x37, 0xba, 0x32, 0xb9, 0xb9, 0xb2, 0x31, 0xba, 0xb4, 0x37, 0xb7,
-  0xa1, 0xb7, 0x3a, 0x37, 0xba, 0x09, 0x02, 0x91, 0x6d, 0x30, 0x92, 0x51,
-  0x20, 0x48, 0x81, 0x5a, 0x03, 0x3a, 0x52, 0x65, 0x63, 0x75, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x44, 0x65, 0x70, 0x74, 0x68, 0x13, 0x04, 0x42, 0xdb,
-  0x60, 0x24, 0xa6, 0x40, 0x9c, 0x02, 0xb5, 0x06, 0x1b, 0x0a, 0x3f, 0x00,
-  0x05, 0x51, 0x28, 0x05, 0x54, 0x98, 0x20, 0x1c, 0xde, 0x06, 0x22, 0x69,
-  0x88, 0x65, 0x83, 0xe0, 0xac, 0xc2, 0x86, 0x66, 0x91, 0xac, 0x6b, 0xe3,
-  0x3a, 0x8f, 0x0f, 0xfa, 0x20, 0x15, 0x54, 0x81, 0x15, 0x26, 0x08, 0x4d,
-  0xb0, 0x01, 0xd8, 0x30, 0x0c, 0xaf, 0xf0, 0x0a, 0x1b, 0x06, 0x30, 0x78,
-  0x85, 0x57, 0xd8, 0x20, 0xc0, 0x42, 0x2c, 0x6c, 0x18, 0x06, 0x57, 0x90,
-  0x05, 0x02, 0x1b, 0x0a, 0x80, 0x16, 0x80, 0x08, 0x20, 0x19, 0x04, 0xfc,
-  0x30, 0x85, 0xb5, 0x89, 0x95, 0xc9, 0xd1, 0xa5, 0x85, 0xb9, 0x35, 0xa5,
-  0xcd, 0xcd, 0x01, 0x01, 0x65, 0x05, 0x61, 0x55, 0x49, 0x85, 0xe5, 0x41,
-  0x85, 0xe5, 0xb1, 0xbd, 0x85, 0x91, 0x01, 0x01, 0x01, 0x69, 0x4d, 0x10,
-  0x88, 0x6d, 0x82, 0x40, 0x70, 0x1b, 0x82, 0x65, 0x83, 0x71, 0x0b, 0xb8,
-  0x90, 0x9c, 0xc2, 0x1a, 0xe4, 0xc2, 0x86, 0xc2, 0x15, 0x6c, 0x01, 0x00,
-  0x74, 0x81, 0x43, 0x9a, 0x1b, 0x1d, 0x9f, 0xb7, 0x36, 0xb7, 0x34, 0xb8,
-  0x37, 0xba, 0x32, 0x37, 0x3a, 0x90, 0x31, 0xb4, 0x30, 0x39, 0x46, 0x53,
-  0x69, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x43, 0x2f, 0x43, 0x2b, 0x2b, 0x20,
-  0x54, 0x42, 0x41, 0x41, 0x1b, 0x02, 0x5f, 0x98, 0x20, 0x74, 0xdd, 0x86,
-  0xa1, 0x17, 0x7e, 0x01, 0x1c, 0x36, 0x0c, 0xbc, 0x10, 0x0e, 0xe0, 0xb0,
-  0x61, 0x10, 0x07, 0x71, 0x00, 0x87, 0x0d, 0x43, 0x38, 0x84, 0x03, 0x38,
-  0x54, 0x61, 0x63, 0xb3, 0x6b, 0x73, 0x49, 0x23, 0x2b, 0x73, 0xa3, 0x9b,
-  0x12, 0x04, 0x55, 0xc8, 0xf0, 0x5c, 0xec, 0xca, 0xe4, 0xe6, 0xd2, 0xde,
-  0xdc, 0xa6, 0x04, 0x44, 0x13, 0x32, 0x3c, 0x17, 0xbb, 0x30, 0x36, 0xbb,
-  0x32, 0xb9, 0x29, 0x81, 0x51, 0x87, 0x0c, 0xcf, 0x65, 0x0e, 0x2d, 0x8c,
-  0xac, 0x4c, 0xae, 0xe9, 0x8d, 0xac, 0x8c, 0x6d, 0x4a, 0x90, 0x94, 0x21,
-  0xc3, 0x73, 0x91, 0x2b, 0x9b, 0x7b, 0xab, 0x93, 0x1b, 0x2b, 0x9b, 0x9b,
-  0x12, 0x40, 0x95, 0xc8, 0xf0, 0x5c, 0xe8, 0xf2, 0xe0, 0xca, 0x82, 0xdc,
-  0xdc, 0xde, 0xe8, 0xc2, 0xe8, 0xd2, 0xde, 0xdc, 0xe6, 0xa6, 0x08, 0xac,
-  0x20, 0x0b, 0x75, 0xc8, 0xf0, 0x5c, 0xca, 0xdc, 0xe8, 0xe4, 0xf2, 0xa0,
-  0xde, 0xd2, 0xdc, 0xe8, 0xe6, 0xa6, 0x08, 0xb4, 0xa0, 0x0b, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c,
-  0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3,
-  0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6,
-  0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e,
-  0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43,
-  0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03,
-  0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48,
-  0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20,
-  0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e,
-  0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d,
-  0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89,
-  0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83,
-  0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68,
-  0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90,
-  0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78,
-  0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98,
-  0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5,
-  0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c,
-  0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c,
-  0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43,
-  0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43,
-  0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82,
-  0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x8c, 0xcc, 0x21, 0x07, 0x7c, 0x70,
-  0x03, 0x74, 0x60, 0x07, 0x37, 0x90, 0x87, 0x72, 0x98, 0x87, 0x77, 0xa8,
-  0x07, 0x79, 0x18, 0x87, 0x72, 0x70, 0x83, 0x70, 0xa0, 0x07, 0x7a, 0x90,
-  0x87, 0x74, 0x10, 0x87, 0x7a, 0xa0, 0x87, 0x72, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x20, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x46, 0x20, 0x06, 0xc3,
-  0xe5, 0x3b, 0x8f, 0x2f, 0x44, 0x04, 0x30, 0x11, 0x21, 0xd0, 0x0c, 0x0b,
-  0xf1, 0x39, 0x51, 0x89, 0x04, 0x3e, 0xe7, 0x34, 0xd2, 0x04, 0x34, 0x93,
-  0x64, 0x02, 0xdb, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x01, 0x55, 0x14, 0x44,
-  0x54, 0x3a, 0xc0, 0x50, 0x12, 0x06, 0x20, 0x60, 0x7e, 0x71, 0xdb, 0x06,
-  0x90, 0x70, 0x4e, 0x23, 0x4d, 0x40, 0x33, 0x49, 0x36, 0xb0, 0x0d, 0x97,
-  0xef, 0x3c, 0xbe, 0xe5, 0x44, 0xcb, 0xb0, 0x02, 0x58, 0x87, 0x44, 0x84,
-  0x30, 0x21, 0x4e, 0xe3, 0x17, 0xb7, 0x5d, 0x01, 0x64, 0x10, 0xf8, 0x31,
-  0xc3, 0x6d, 0x71, 0x59, 0x4e, 0x4f, 0x87, 0xdd, 0xcd, 0xf4, 0x7c, 0x0e,
-  0x04, 0x66, 0x83, 0xd8, 0xaa, 0x34, 0x9c, 0x87, 0x86, 0xf3, 0xec, 0x77,
-  0x98, 0x0c, 0x04, 0x02, 0xb5, 0x00, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00,
-  0x41, 0x00, 0x00, 0x00, 0x13, 0x04, 0x43, 0x2c, 0x10, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0xf4, 0x94, 0x00, 0x11, 0x65, 0x57, 0xc0, 0x02,
-  0x85, 0x2a, 0x40, 0xc5, 0x0c, 0x00, 0x01, 0x63, 0x04, 0x20, 0x08, 0x82,
-  0xf0, 0x07, 0x00, 0x00, 0xb4, 0x06, 0xc7, 0x18, 0x31, 0x30, 0x00, 0x10,
-  0x04, 0x03, 0x0b, 0x0d, 0x8a, 0x60, 0x2b, 0x43, 0x42, 0x06, 0x1f, 0x05,
-  0xc4, 0x18, 0x6e, 0x08, 0xcc, 0x00, 0x0c, 0x66, 0x19, 0x02, 0x21, 0x18,
-  0x31, 0x30, 0x00, 0x10, 0x04, 0x03, 0xaa, 0x0d, 0x90, 0x65, 0xc4, 0xe0,
-  0x00, 0x40, 0x10, 0x0c, 0xa4, 0x37, 0x58, 0x8a, 0x6f, 0x34, 0x21, 0x00,
-  0x46, 0x13, 0x84, 0x60, 0x34, 0x61, 0x10, 0x46, 0x0c, 0x0e, 0x00, 0x04,
-  0xc1, 0x40, 0x9a, 0x83, 0x27, 0x71, 0x83, 0xd1, 0x84, 0x00, 0x18, 0x4d,
-  0x10, 0x82, 0xd1, 0x84, 0x41, 0xb0, 0xe4, 0x91, 0x8f, 0x41, 0x41, 0x7c,
-  0x2c, 0x48, 0xe4, 0x63, 0x83, 0x04, 0x1f, 0x3b, 0x02, 0xf9, 0x58, 0x30,
-  0xc0, 0x67, 0x8e, 0xc1, 0x0a, 0xec, 0xc0, 0x8c, 0x46, 0x3e, 0xa6, 0x14,
-  0xf2, 0xb1, 0x40, 0x80, 0xcf, 0x1c, 0x03, 0x11, 0xf8, 0x81, 0x29, 0x90,
-  0x7c, 0xac, 0x49, 0xe4, 0x63, 0x81, 0x00, 0x9f, 0x39, 0x06, 0x22, 0xc8,
-  0x83, 0xad, 0x0c, 0x64, 0xf0, 0x07, 0x7f, 0x30, 0x6c, 0x40, 0x04, 0xc2,
-  0x00, 0xcc, 0x12, 0x08, 0x18, 0x0e, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x06, 0x23, 0xc1, 0x4e, 0xb4, 0x0c, 0x2b, 0x80, 0x75, 0x48, 0x44, 0x08,
-  0x13, 0xe2, 0x34, 0xb5, 0x91, 0x1c, 0x29, 0x80, 0x2d, 0x0e, 0x30, 0x18,
-  0x4b, 0xc2, 0x39, 0x8d, 0x34, 0x01, 0xcd, 0x24, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x31, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5b, 0x86, 0x21, 0x10,
-  0x87, 0x2d, 0xc3, 0x17, 0x8c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00
-};
@@ -25,16 +25,21 @@
 #include "WD3D12.hpp"
 #include "WDXGI.hpp"
 #include "RGBAWelcomeMat.hpp"
+#include "SceneDescription.hpp"
+#include "ProgressiveAccumulator.hpp"
 
-#include "Compiled Shaders/DielectricAnyHit.h"
+// The shader libraries, compiled from "Shader Source" by CompileShaders.bat.
+#if !__has_include("Compiled Shaders/RayGeneration.h")
+#error Run "Shader Source/CompileShaders.bat" to generate the headers in "Source/Compiled Shaders".
+#endif
+
+#include "Compiled Shaders/DielectricClosestHit.h"
 #include "Compiled Shaders/DielectricIntersection.h"
-#include "Compiled Shaders/DielectricMiss.h"
 #include "Compiled Shaders/LambertianClosestHit.h"
 #include "Compiled Shaders/LambertianIntersection.h"
 #include "Compiled Shaders/LambertianMiss.h"
 #include "Compiled Shaders/MetallicClosestHit.h"
 #include "Compiled Shaders/MetallicIntersection.h"
-#include "Compiled Shaders/MetallicMiss.h"
 #include "Compiled Shaders/RayGeneration.h"
 
 // Sphere center as a set of 3D coordinates.
@@ -328,6 +333,64 @@ int WINAPI WinMain(
 	TextureCopyLocationIntersectionMap2DTexture.pResource = IntersectionMap2DTexture.GetInterface();
 	TextureCopyLocationIntersectionMap2DTexture.SubresourceIndex = 0;
 
+	// Create the Accumulation Buffer, for adding up the colors of the rays of each progressive rendering pass, right after the Intersection Map in the pipeline heap.
+	D3D12_RESOURCE_ALLOCATION_INFO IntersectionMapAllocationInfo
+	{
+		Device.GetInterface()->GetResourceAllocationInfo
+		(
+			0,
+			1,
+			&(IntersectionMap2DTexture.InitConfig.d3d12_resource_description)
+		)
+	};
+
+	WD3D12PlacedResource0 AccumulationBuffer2DTexture{};
+	AccumulationBuffer2DTexture.InitConfig.unicode_debug_name = L"AccumulationBuffer2DTexture";
+	AccumulationBuffer2DTexture.InitConfig.ptr_id3d12device_v5 = Device.GetInterface();
+	AccumulationBuffer2DTexture.InitConfig.ptr_id3d12heap_v0 = PipelineHeap.GetInterface();
+	AccumulationBuffer2DTexture.InitConfig.heap_offset_in_bytes = (6 * 65536) + (((IntersectionMapAllocationInfo.SizeInBytes + 65535) / 65536) * 65536);
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.Width = PixelWidth;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.Height = PixelHeight;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.DepthOrArraySize = 1;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.MipLevels = 1;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.SampleDesc.Count = 1;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.SampleDesc.Quality = 0;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+	AccumulationBuffer2DTexture.InitConfig.d3d12_resource_description.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+	AccumulationBuffer2DTexture.InitConfig.initial_resource_state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+	AccumulationBuffer2DTexture.Initialize();
+
+	// Create its Unordered Access View, in the descriptor right after the Intersection Map's, so that both are in the same descriptor table.
+	D3D12_UNORDERED_ACCESS_VIEW_DESC UAVDescription_AccumulationBuffer{};
+	UAVDescription_AccumulationBuffer.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+	UAVDescription_AccumulationBuffer.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
+	UAVDescription_AccumulationBuffer.Texture2D.MipSlice = 0;
+	UAVDescription_AccumulationBuffer.Texture2D.PlaneSlice = 0;
+
+	D3D12_CPU_DESCRIPTOR_HANDLE CPUDescriptorHandleToAccumulationBuffer2DTextureUAV{};
+	D3D12_GPU_DESCRIPTOR_HANDLE GPUDescriptorHandleToAccumulationBuffer2DTextureUAV{};
+
+	GetDescriptorHandles
+	(
+		DescriptorHeap.GetInterface(),
+		DescriptorHeapOffset,
+		DescriptorHandleIncrementSize,
+		&CPUDescriptorHandleToAccumulationBuffer2DTextureUAV,
+		&GPUDescriptorHandleToAccumulationBuffer2DTextureUAV
+	);
+
+	DescriptorHeapOffset++;
+
+	Device.GetInterface()->CreateUnorderedAccessView
+	(
+		AccumulationBuffer2DTexture.GetInterface(),
+		nullptr,
+		&UAVDescription_AccumulationBuffer,
+		CPUDescriptorHandleToAccumulationBuffer2DTextureUAV
+	);
+
 	// Generate the RGBA data for the intersection map and move it into the upload buffer.
 	RGBAWelcomeMat WelcomeMat{};
 	WelcomeMat.InitConfig.color_format = COLOR_FORMAT_R8G8B8A8;
@@ -365,181 +428,18 @@ int WINAPI WinMain(
 
 
 
-	// Create a buffer filled with random numbers, for generating random direction vectors in the shaders.
-	const unsigned __int64 RandomFloatCount{ PixelCount };
-	const unsigned __int64 RandomNumberUploadBufferByteSize{ RandomFloatCount * sizeof(float) };
-
-	// Upload buffer with CPU and GPU access.
-	WD3D12CommittedResource0 RandomNumberUploadBuffer{};
-	RandomNumberUploadBuffer.InitConfig.unicode_debug_name = L"RandomNumberUploadBuffer";
-	RandomNumberUploadBuffer.InitConfig.ptr_id3d12device_v5 = Device.GetInterface();
-	RandomNumberUploadBuffer.InitConfig.d3d12_heap_properties.Type = D3D12_HEAP_TYPE_CUSTOM;
-	RandomNumberUploadBuffer.InitConfig.d3d12_heap_properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_WRITE_COMBINE;
-	RandomNumberUploadBuffer.InitConfig.d3d12_heap_properties.MemoryPoolPreference = D3D12_MEMORY_POOL_L0;
-	RandomNumberUploadBuffer.InitConfig.d3d12_heap_properties.CreationNodeMask = 0;
-	RandomNumberUploadBuffer.InitConfig.d3d12_heap_properties.VisibleNodeMask = 0;
-	RandomNumberUploadBuffer.InitConfig.d3d12_heap_flags = D3D12_HEAP_FLAG_NONE;
-	RandomNumberUploadBuffer.InitConfig.d3d12_resource_description.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-	RandomNumberUploadBuffer.InitConfig.d3d12_resource_description.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-	RandomNumberUploadBuffer.InitConfig.d3d12_resource_description.Flags = D3D12_RESOURCE_FLAG_NONE;
-	RandomNumberUploadBuffer.InitConfig.d3d12_resource_description.Format = DXGI_FORMAT_UNKNOWN;
-	RandomNumberUploadBuffer.InitConfig.d3d12_resource_description.Width = RandomNumberUploadBufferByteSize;
-	RandomNumberUploadBuffer.InitConfig.d3d12_resource_state = D3D12_RESOURCE_STATE_GENERIC_READ;
-	RandomNumberUploadBuffer.Initialize();
-
-	// Generate the Pseudo-Random numbers (Range [-1.0, +1.0]) here on the host-side.
-	float* pRandomNumbers{ nullptr };
-	pRandomNumbers = new float[RandomFloatCount];
-
-	int RandomNumber{ 0 };
-	float RandomComponent{ 0.0f };
-
-	for (unsigned __int32 i = 0; i < RandomFloatCount; i++)
-	{
-		RandomNumber = rand();
-		RandomComponent = 2.0f * ((float)RandomNumber / (float)RAND_MAX) - 1.0f;
-		pRandomNumbers[i] = RandomComponent;
-	}
-
-	// Copy the numbers into the upload buffer.
-	MemCopyToUploadBuffer
-	(
-		RandomNumberUploadBuffer.GetInterface(),
-		RandomNumberUploadBufferByteSize,
-		pRandomNumbers,
-		RandomNumberUploadBufferByteSize
-	);
-
-	delete[] pRandomNumbers;
-	pRandomNumbers = nullptr;
-
-	// GPU-Only random number buffer.
-	WD3D12CommittedResource0 RandomNumberBuffer{};
-	RandomNumberBuffer.InitConfig.unicode_debug_name = L"RandomNumberBuffer";
-	RandomNumberBuffer.InitConfig.ptr_id3d12device_v5 = Device.GetInterface();
-	RandomNumberBuffer.InitConfig.d3d12_heap_properties.Type = D3D12_HEAP_TYPE_CUSTOM;
-	RandomNumberBuffer.InitConfig.d3d12_heap_properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_NOT_AVAILABLE;
-	RandomNumberBuffer.InitConfig.d3d12_heap_properties.MemoryPoolPreference = D3D12_MEMORY_POOL_L1;
-	RandomNumberBuffer.InitConfig.d3d12_heap_properties.CreationNodeMask = 0;
-	RandomNumberBuffer.InitConfig.d3d12_heap_properties.VisibleNodeMask = 0;
-	RandomNumberBuffer.InitConfig.d3d12_heap_flags = D3D12_HEAP_FLAG_NONE;
-	RandomNumberBuffer.InitConfig.d3d12_resource_description.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-	RandomNumberBuffer.InitConfig.d3d12_resource_description.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-	RandomNumberBuffer.InitConfig.d3d12_resource_description.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-	RandomNumberBuffer.InitConfig.d3d12_resource_description.Format = DXGI_FORMAT_UNKNOWN;
-	RandomNumberBuffer.InitConfig.d3d12_resource_description.Width = RandomNumberUploadBufferByteSize;
-	RandomNumberBuffer.InitConfig.d3d12_resource_state = D3D12_RESOURCE_STATE_COPY_DEST;
-	RandomNumberBuffer.Initialize();
-
-	D3D12_CPU_DESCRIPTOR_HANDLE CPUDescriptorHandleToRandomNumberBuffer{};
-	D3D12_GPU_DESCRIPTOR_HANDLE GPUDescriptorHandleToRandomNumberBuffer{};
-
-	GetDescriptorHandles(
-		DescriptorHeap.GetInterface(),
-		DescriptorHeapOffset,
-		DescriptorHandleIncrementSize,
-		&CPUDescriptorHandleToRandomNumberBuffer,
-		&GPUDescriptorHandleToRandomNumberBuffer
-	);
-
-	DescriptorHeapOffset++;
-
-	D3D12_UNORDERED_ACCESS_VIEW_DESC RandomNumberBufferUAVDescription{};
-	RandomNumberBufferUAVDescription.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
-	RandomNumberBufferUAVDescription.Format = DXGI_FORMAT_R32_TYPELESS;
-	RandomNumberBufferUAVDescription.Buffer.Flags = D3D12_BUFFER_UAV_FLAG_RAW;
-	RandomNumberBufferUAVDescription.Buffer.FirstElement = 0;
-	RandomNumberBufferUAVDescription.Buffer.NumElements = RandomFloatCount;
-
-	Device.GetInterface()->CreateUnorderedAccessView(
-		RandomNumberBuffer.GetInterface(),
-		nullptr,
-		&RandomNumberBufferUAVDescription,
-		CPUDescriptorHandleToRandomNumberBuffer
-	);
-
-
-
-
-
 	// Collection of scene and rendering constants, to be passed into the shaders as a collection of global inline root constants.
+	// The structure and the default scene values are shared with the CPU rendering path, via SceneDescription.hpp.
 	using namespace DirectX;
 
-	// Global "Constant Buffer" structure to contain scene data for the shaders.
-	struct InlineConstantBuffer
-	{
-		// Camera-to-World transform, for moving the camera around in world-space.
-		XMMATRIX CameraToWorld;
-
-		// "Sky Color" at the top of the sky.
-		XMFLOAT4 SkyTopColor;
-
-		// "Sky Color" at the bottom of the sky.
-		XMFLOAT4 SkyBottomColor;
-
-		// Number of Random Floats.
-		UINT RandomFloatCount;
-		float Pad01[3];
-
-		// Vertical Field of View, in Radians.
-		float VertFoVRad;
-
-		// Max Recursion Depth.
-		UINT MaxRecursionDepth;
-
-		// Number of Rays per pixel.
-		UINT RaysPerPixel;
-
-		// For Lambertian Light Attenuation.
-		float LambertianAttenuationValue;
-	};
-
 	// Constant buffer of inline root constants.
 	InlineConstantBuffer InlineConstantBuffer{};
 
-	// Camera-to-World transform, for moving the camera around in world-space.
-	XMFLOAT3 CameraPosition{ 0.0f, 20.0f, 30.0001f };
-	XMFLOAT3 FocusPoint{ 0.0f, 0.0f, 0.0f };
-	XMFLOAT3 UpDirection{ 0.0f, +1.0f, 0.0f };
-
-	InlineConstantBuffer.CameraToWorld = XMMatrixInverse
+	GetDefaultSceneConstants
 	(
-		nullptr,
-		XMMatrixLookAtLH
-		(
-			XMLoadFloat3(&CameraPosition),
-			XMLoadFloat3(&FocusPoint),
-			XMLoadFloat3(&UpDirection)
-		)
+		&InlineConstantBuffer
 	);
 
-	// "Sky Color" at the top of the sky.
-	InlineConstantBuffer.SkyTopColor.x = 0.0f;
-	InlineConstantBuffer.SkyTopColor.y = 0.502f;
-	InlineConstantBuffer.SkyTopColor.z = 1.0f;
-	InlineConstantBuffer.SkyTopColor.w = 0.0f;
-
-	// "Sky Color" at the bottom of the sky.
-	InlineConstantBuffer.SkyBottomColor.x = 1.0f;
-	InlineConstantBuffer.SkyBottomColor.y = 1.0f;
-	InlineConstantBuffer.SkyBottomColor.z = 1.0f;
-	InlineConstantBuffer.SkyBottomColor.w = 0.0f;
-
-	// Number of Random Floats.
-	InlineConstantBuffer.RandomFloatCount = RandomFloatCount;
-
-	// Vertical field-of-view in radians.
-	InlineConstantBuffer.VertFoVRad = XMConvertToRadians(90.0f);
-
-	// Max Recursion Depth.
-	InlineConstantBuffer.MaxRecursionDepth = 31U;
-
-	// Number of Rays per pixel.
-	InlineConstantBuffer.RaysPerPixel = 500U;
-
-	// For Lambertian Light Attenuation.
-	InlineConstantBuffer.LambertianAttenuationValue = 0.5f;
-
 	// Total number of 32-bit Inline Root Constants, for the Global Root Signature.
 	const unsigned __int64 InlineConstantsCount{ sizeof(InlineConstantBuffer) / sizeof(__int32) };
 
@@ -688,65 +588,30 @@ int WINAPI WinMain(
 
 	// Instance description(s), for the TLAS build inputs - To be uploaded to GPU memory for usage within the TLAS inputs structure via GPUVirtualAddress.
 
-	// Some values for material indexing.
-	UINT LambertianHitGroupIndex{ 0 };
-	UINT MetallicHitGroupIndex{ 1 };
-	UINT DielectricHitGroupIndex{ 2 };
+	// Instance descriptions of the scene's spheres, shared with the CPU rendering path.
+	const unsigned __int64 InstanceDescriptionCount{ DefaultSceneInstanceCount };
 
-	// Instance description of the planet sphere.
-	UINT PlanetSphereInstanceID{ 1 };				// 1
-	UINT PlanetSphereInstanceMask{ 0b0000'0001 };	// 1
-	FLOAT PlanetSphereTransform[12]
-	{
-		+7.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, +7.0f, 0.0f, +8.0f,
-		0.0f, 0.0f, +7.0f, 0.0f
-	};
-
-	D3D12_RAYTRACING_INSTANCE_DESC PlanetSphereInstanceDesc{};
-	PlanetSphereInstanceDesc.AccelerationStructure = BLASResource.GetInterface()->GetGPUVirtualAddress();
-	PlanetSphereInstanceDesc.Flags = D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_OPAQUE;
-	PlanetSphereInstanceDesc.InstanceContributionToHitGroupIndex = LambertianHitGroupIndex;
-	PlanetSphereInstanceDesc.InstanceID = PlanetSphereInstanceID;
-	PlanetSphereInstanceDesc.InstanceMask = PlanetSphereInstanceMask;
-	memcpy_s
-	(
-		PlanetSphereInstanceDesc.Transform,
-		sizeof(PlanetSphereTransform),
-		PlanetSphereTransform,
-		sizeof(PlanetSphereTransform)
-	);
-
-	// Instance description of the other sphere.
-	UINT MainSphereInstanceID{ 2 };				// 2
-	UINT MainSphereInstanceMask{ 0b0000'0010 };	// 2
-	FLOAT MainSphereTransform[12]
-	{
-		+300.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, +300.0f, 0.0f, -300.0f,
-		0.0f, 0.0f, +300.0f, 0.0f
-	};
-
-	D3D12_RAYTRACING_INSTANCE_DESC MainSphereInstanceDesc{};
-	MainSphereInstanceDesc.AccelerationStructure = BLASResource.GetInterface()->GetGPUVirtualAddress();
-	MainSphereInstanceDesc.Flags = D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_OPAQUE;
-	MainSphereInstanceDesc.InstanceContributionToHitGroupIndex = LambertianHitGroupIndex;
-	MainSphereInstanceDesc.InstanceID = MainSphereInstanceID;
-	MainSphereInstanceDesc.InstanceMask = MainSphereInstanceMask;
-	memcpy_s
-	(
-		MainSphereInstanceDesc.Transform,
-		sizeof(MainSphereTransform),
-		MainSphereTransform,
-		sizeof(MainSphereTransform)
-	);
+	SceneInstanceDesc SceneInstances[InstanceDescriptionCount]{};
+	GetDefaultSceneInstances(SceneInstances);
 
 	// Pack the instance descriptions into an array.
-	const unsigned __int64 InstanceDescriptionCount{ 2 };
-
 	D3D12_RAYTRACING_INSTANCE_DESC InstanceDescriptionArray[InstanceDescriptionCount]{};
-	InstanceDescriptionArray[0] = PlanetSphereInstanceDesc;
-	InstanceDescriptionArray[1] = MainSphereInstanceDesc;
+
+	for (unsigned __int64 i = 0; i < InstanceDescriptionCount; i++)
+	{
+		InstanceDescriptionArray[i].AccelerationStructure = BLASResource.GetInterface()->GetGPUVirtualAddress();
+		InstanceDescriptionArray[i].Flags = SceneInstances[i].Flags;
+		InstanceDescriptionArray[i].InstanceContributionToHitGroupIndex = SceneInstances[i].InstanceContributionToHitGroupIndex;
+		InstanceDescriptionArray[i].InstanceID = SceneInstances[i].InstanceID;
+		InstanceDescriptionArray[i].InstanceMask = SceneInstances[i].InstanceMask;
+		memcpy_s
+		(
+			InstanceDescriptionArray[i].Transform,
+			sizeof(InstanceDescriptionArray[i].Transform),
+			SceneInstances[i].Transform,
+			sizeof(SceneInstances[i].Transform)
+		);
+	}
 
 	// Create an upload resource for the D3D12_RAYTRACING_INSTANCE_DESC array.
 	const unsigned __int64 InstanceDescUploadResourceByteSize{ sizeof(InstanceDescriptionArray) };
@@ -769,6 +634,27 @@ int WINAPI WinMain(
 		sizeof(InstanceDescriptionArray)
 	);
 
+	// Material table of the scene's spheres, one material per instance, shared with the CPU rendering path. It never changes, so it gets uploaded once, into a buffer that the shaders read from directly.
+	SceneMaterial SceneMaterials[InstanceDescriptionCount]{};
+	GetDefaultSceneMaterials(SceneMaterials);
+
+	WD3D12CommittedResource0 MaterialBuffer{};
+	MaterialBuffer.InitConfig.unicode_debug_name = L"MaterialBuffer";
+	MaterialBuffer.InitConfig.ptr_id3d12device_v5 = Device.GetInterface();
+	MaterialBuffer.InitConfig.d3d12_heap_properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_WRITE_COMBINE;
+	MaterialBuffer.InitConfig.d3d12_heap_properties.MemoryPoolPreference = D3D12_MEMORY_POOL_L0;
+	MaterialBuffer.InitConfig.d3d12_resource_description.Width = sizeof(SceneMaterials);
+	MaterialBuffer.InitConfig.d3d12_resource_state = D3D12_RESOURCE_STATE_GENERIC_READ;
+	MaterialBuffer.Initialize();
+
+	MemCopyToUploadBuffer
+	(
+		MaterialBuffer.GetInterface(),
+		sizeof(SceneMaterials),
+		SceneMaterials,
+		sizeof(SceneMaterials)
+	);
+
 	// Create a GPU-Only resource, for storing the D3D12_RAYTRACING_INSTANCE_DESC structure.
 	const unsigned __int64 InstanceDescPipelineResourceByteSize{ InstanceDescUploadResourceByteSize };
 
@@ -882,7 +768,13 @@ int WINAPI WinMain(
 	SRVRootDescriptor.RegisterSpace = 0;
 	SRVRootDescriptor.ShaderRegister = 0;
 
-	// Descriptor table containing a UAV of the intersection map.
+	// Shader resource view of the material table.
+	D3D12_ROOT_DESCRIPTOR1 MaterialSRVRootDescriptor{};
+	MaterialSRVRootDescriptor.RegisterSpace = 0;
+	MaterialSRVRootDescriptor.ShaderRegister = 1;
+	MaterialSRVRootDescriptor.Flags = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC;
+
+	// Descriptor table containing UAVs of the intersection map and the accumulation buffer.
 	D3D12_DESCRIPTOR_RANGE1 UAVDescriptorRange[1]{};
 	UAVDescriptorRange[0].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_UAV;
 	UAVDescriptorRange[0].NumDescriptors = 2;
@@ -901,7 +793,7 @@ int WINAPI WinMain(
 	InlineConstants.ShaderRegister = 0;
 
 	// Define the root parameters within an array.
-	D3D12_ROOT_PARAMETER1 GlobalRootParameters[3]{};
+	D3D12_ROOT_PARAMETER1 GlobalRootParameters[4]{};
 	GlobalRootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
 	GlobalRootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
 	GlobalRootParameters[0].Descriptor = SRVRootDescriptor;
@@ -914,10 +806,14 @@ int WINAPI WinMain(
 	GlobalRootParameters[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
 	GlobalRootParameters[2].Constants = InlineConstants;
 
+	GlobalRootParameters[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+	GlobalRootParameters[3].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+	GlobalRootParameters[3].Descriptor = MaterialSRVRootDescriptor;
+
 	// Describe the global root signature.
 	D3D12_VERSIONED_ROOT_SIGNATURE_DESC GlobalRootSignatureDescription{};
 	GlobalRootSignatureDescription.Version = D3D_ROOT_SIGNATURE_VERSION_1_1;
-	GlobalRootSignatureDescription.Desc_1_1.NumParameters = 3;
+	GlobalRootSignatureDescription.Desc_1_1.NumParameters = 4;
 	GlobalRootSignatureDescription.Desc_1_1.pParameters = GlobalRootParameters;
 
 	ID3DBlob* GlobalRootSignatureBlob{};
@@ -1044,9 +940,119 @@ int WINAPI WinMain(
 	LambertianHitGroupSubobject.Type = D3D12_STATE_SUBOBJECT_TYPE_HIT_GROUP;
 	LambertianHitGroupSubobject.pDesc = LambertianHitGroupDescription;
 
+	// Metallic intersection shader export + DXIL library + state subobject.
+	const wchar_t* Name_MetallicIntersectionShader{ L"MetallicIntersection" };
+
+	D3D12_SHADER_BYTECODE MetallicIntersectionShaderByteCode{};
+	MetallicIntersectionShaderByteCode.pShaderBytecode = (void*)MetallicIntersection;
+	MetallicIntersectionShaderByteCode.BytecodeLength = sizeof(MetallicIntersection);
+
+	D3D12_EXPORT_DESC MetallicIntersectionShaderExportDescription[1]{};
+	MetallicIntersectionShaderExportDescription[0].Name = Name_MetallicIntersectionShader;
+	MetallicIntersectionShaderExportDescription[0].ExportToRename = nullptr;
+	MetallicIntersectionShaderExportDescription[0].Flags = D3D12_EXPORT_FLAG_NONE;
+
+	D3D12_DXIL_LIBRARY_DESC MetallicIntersectionShaderLibDescription[1]{};
+	MetallicIntersectionShaderLibDescription[0].DXILLibrary = MetallicIntersectionShaderByteCode;
+	MetallicIntersectionShaderLibDescription[0].NumExports = 1;
+	MetallicIntersectionShaderLibDescription[0].pExports = MetallicIntersectionShaderExportDescription;
+
+	D3D12_STATE_SUBOBJECT MetallicIntersectionShaderSubobject{};
+	MetallicIntersectionShaderSubobject.Type = D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY;
+	MetallicIntersectionShaderSubobject.pDesc = MetallicIntersectionShaderLibDescription;
+
+	// Metallic closest hit shader export + DXIL library + state subobject.
+	const wchar_t* Name_MetallicClosestHitShader{ L"MetallicClosestHit" };
+
+	D3D12_SHADER_BYTECODE MetallicClosestHitShaderByteCode{};
+	MetallicClosestHitShaderByteCode.pShaderBytecode = (void*)MetallicClosestHit;
+	MetallicClosestHitShaderByteCode.BytecodeLength = sizeof(MetallicClosestHit);
+
+	D3D12_EXPORT_DESC MetallicClosestHitShaderExportDescription[1]{};
+	MetallicClosestHitShaderExportDescription[0].Name = Name_MetallicClosestHitShader;
+	MetallicClosestHitShaderExportDescription[0].ExportToRename = nullptr;
+	MetallicClosestHitShaderExportDescription[0].Flags = D3D12_EXPORT_FLAG_NONE;
+
+	D3D12_DXIL_LIBRARY_DESC MetallicClosestHitShaderLibDescription[1]{};
+	MetallicClosestHitShaderLibDescription[0].DXILLibrary = MetallicClosestHitShaderByteCode;
+	MetallicClosestHitShaderLibDescription[0].NumExports = 1;
+	MetallicClosestHitShaderLibDescription[0].pExports = MetallicClosestHitShaderExportDescription;
+
+	D3D12_STATE_SUBOBJECT MetallicClosestHitShaderSubobject{};
+	MetallicClosestHitShaderSubobject.Type = D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY;
+	MetallicClosestHitShaderSubobject.pDesc = MetallicClosestHitShaderLibDescription;
+
+	// Metallic hit group + state subobject.
+	const wchar_t* Name_MetallicHitGroup{ L"MetallicHitGroup" };
+
+	D3D12_HIT_GROUP_DESC MetallicHitGroupDescription[1]{};
+	MetallicHitGroupDescription[0].Type = D3D12_HIT_GROUP_TYPE_PROCEDURAL_PRIMITIVE;
+	MetallicHitGroupDescription[0].IntersectionShaderImport = Name_MetallicIntersectionShader;
+	MetallicHitGroupDescription[0].ClosestHitShaderImport = Name_MetallicClosestHitShader;
+	MetallicHitGroupDescription[0].HitGroupExport = Name_MetallicHitGroup;
+
+	D3D12_STATE_SUBOBJECT MetallicHitGroupSubobject{};
+	MetallicHitGroupSubobject.Type = D3D12_STATE_SUBOBJECT_TYPE_HIT_GROUP;
+	MetallicHitGroupSubobject.pDesc = MetallicHitGroupDescription;
+
+	// Dielectric intersection shader export + DXIL library + state subobject.
+	const wchar_t* Name_DielectricIntersectionShader{ L"DielectricIntersection" };
+
+	D3D12_SHADER_BYTECODE DielectricIntersectionShaderByteCode{};
+	DielectricIntersectionShaderByteCode.pShaderBytecode = (void*)DielectricIntersection;
+	DielectricIntersectionShaderByteCode.BytecodeLength = sizeof(DielectricIntersection);
+
+	D3D12_EXPORT_DESC DielectricIntersectionShaderExportDescription[1]{};
+	DielectricIntersectionShaderExportDescription[0].Name = Name_DielectricIntersectionShader;
+	DielectricIntersectionShaderExportDescription[0].ExportToRename = nullptr;
+	DielectricIntersectionShaderExportDescription[0].Flags = D3D12_EXPORT_FLAG_NONE;
+
+	D3D12_DXIL_LIBRARY_DESC DielectricIntersectionShaderLibDescription[1]{};
+	DielectricIntersectionShaderLibDescription[0].DXILLibrary = DielectricIntersectionShaderByteCode;
+	DielectricIntersectionShaderLibDescription[0].NumExports = 1;
+	DielectricIntersectionShaderLibDescription[0].pExports = DielectricIntersectionShaderExportDescription;
+
+	D3D12_STATE_SUBOBJECT DielectricIntersectionShaderSubobject{};
+	DielectricIntersectionShaderSubobject.Type = D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY;
+	DielectricIntersectionShaderSubobject.pDesc = DielectricIntersectionShaderLibDescription;
+
+	// Dielectric closest hit shader export + DXIL library + state subobject.
+	const wchar_t* Name_DielectricClosestHitShader{ L"DielectricClosestHit" };
+
+	D3D12_SHADER_BYTECODE DielectricClosestHitShaderByteCode{};
+	DielectricClosestHitShaderByteCode.pShaderBytecode = (void*)DielectricClosestHit;
+	DielectricClosestHitShaderByteCode.BytecodeLength = sizeof(DielectricClosestHit);
+
+	D3D12_EXPORT_DESC DielectricClosestHitShaderExportDescription[1]{};
+	DielectricClosestHitShaderExportDescription[0].Name = Name_DielectricClosestHitShader;
+	DielectricClosestHitShaderExportDescription[0].ExportToRename = nullptr;
+	DielectricClosestHitShaderExportDescription[0].Flags = D3D12_EXPORT_FLAG_NONE;
+
+	D3D12_DXIL_LIBRARY_DESC DielectricClosestHitShaderLibDescription[1]{};
+	DielectricClosestHitShaderLibDescription[0].DXILLibrary = DielectricClosestHitShaderByteCode;
+	DielectricClosestHitShaderLibDescription[0].NumExports = 1;
+	DielectricClosestHitShaderLibDescription[0].pExports = DielectricClosestHitShaderExportDescription;
+
+	D3D12_STATE_SUBOBJECT DielectricClosestHitShaderSubobject{};
+	DielectricClosestHitShaderSubobject.Type = D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY;
+	DielectricClosestHitShaderSubobject.pDesc = DielectricClosestHitShaderLibDescription;
+
+	// Dielectric hit group + state subobject.
+	const wchar_t* Name_DielectricHitGroup{ L"DielectricHitGroup" };
+
+	D3D12_HIT_GROUP_DESC DielectricHitGroupDescription[1]{};
+	DielectricHitGroupDescription[0].Type = D3D12_HIT_GROUP_TYPE_PROCEDURAL_PRIMITIVE;
+	DielectricHitGroupDescription[0].IntersectionShaderImport = Name_DielectricIntersectionShader;
+	DielectricHitGroupDescription[0].ClosestHitShaderImport = Name_DielectricClosestHitShader;
+	DielectricHitGroupDescription[0].HitGroupExport = Name_DielectricHitGroup;
+
+	D3D12_STATE_SUBOBJECT DielectricHitGroupSubobject{};
+	DielectricHitGroupSubobject.Type = D3D12_STATE_SUBOBJECT_TYPE_HIT_GROUP;
+	DielectricHitGroupSubobject.pDesc = DielectricHitGroupDescription;
+
 	// Raytracing shader config + state subobject.
 	D3D12_RAYTRACING_SHADER_CONFIG RaytracingShaderConfig{};
-	RaytracingShaderConfig.MaxPayloadSizeInBytes = 32U;
+	RaytracingShaderConfig.MaxPayloadSizeInBytes = 60U;
 	RaytracingShaderConfig.MaxAttributeSizeInBytes = 24U;
 
 	D3D12_STATE_SUBOBJECT RaytracingShaderConfigSubobject{};
@@ -1055,20 +1061,27 @@ int WINAPI WinMain(
 
 	// Raytracing pipeline config + state subobject.
 	D3D12_RAYTRACING_PIPELINE_CONFIG RaytracingPipelineConfig{};
-	RaytracingPipelineConfig.MaxTraceRecursionDepth = InlineConstantBuffer.MaxRecursionDepth;
+	// Only the Ray Generation shader calls TraceRay(), one bounce at a time.
+	RaytracingPipelineConfig.MaxTraceRecursionDepth = 1U;
 
 	D3D12_STATE_SUBOBJECT RaytracingPipelineConfigSubobject{};
 	RaytracingPipelineConfigSubobject.Type = D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG;
 	RaytracingPipelineConfigSubobject.pDesc = &RaytracingPipelineConfig;
 
 	// Describe the pipeline state object.
-	D3D12_STATE_SUBOBJECT StateSubobjects[8]
+	D3D12_STATE_SUBOBJECT StateSubobjects[14]
 	{
 		RayGenerationShaderSubobject,
 		LambertianIntersectionShaderSubobject,
 		LambertianClosestHitShaderSubobject,
 		LambertianMissShaderSubobject,
 		LambertianHitGroupSubobject,
+		MetallicIntersectionShaderSubobject,
+		MetallicClosestHitShaderSubobject,
+		MetallicHitGroupSubobject,
+		DielectricIntersectionShaderSubobject,
+		DielectricClosestHitShaderSubobject,
+		DielectricHitGroupSubobject,
 		RaytracingShaderConfigSubobject,
 		RaytracingPipelineConfigSubobject,
 		GlobalRootSignatureSubobject
@@ -1100,11 +1113,30 @@ int WINAPI WinMain(
 		Name_RayGenerationShader
 	);
 
-	void* HitGroupShaderIdentifier{};
-	HitGroupShaderIdentifier = IStateObjectProperties->GetShaderIdentifier
-	(
-		Name_LambertianHitGroup
-	);
+	// One hit group record per material, in the order of LambertianHitGroupIndex, MetallicHitGroupIndex and DielectricHitGroupIndex, which the instances pick theirs with.
+	const unsigned int HitGroupCount{ 3 };
+
+	const wchar_t* HitGroupNames[HitGroupCount]{ Name_LambertianHitGroup, Name_MetallicHitGroup, Name_DielectricHitGroup };
+
+	unsigned char HitGroupShaderRecords[HitGroupCount * D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES]{};
+
+	for (unsigned int i = 0; i < HitGroupCount; i++)
+	{
+		void* HitGroupShaderIdentifier = IStateObjectProperties->GetShaderIdentifier
+		(
+			HitGroupNames[i]
+		);
+
+		// A hit group whose shaders are missing from the libraries has no identifier.
+		if (HitGroupShaderIdentifier == nullptr)
+		{
+			MessageBoxW(NULL, HitGroupNames[i], L"ID3D12StateObjectProperties.GetShaderIdentifier() failed.", NULL);
+
+			return 1;
+		}
+
+		memcpy(&(HitGroupShaderRecords[i * D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES]), HitGroupShaderIdentifier, D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES);
+	}
 
 	void* MissShaderIdentifier{};
 	MissShaderIdentifier = IStateObjectProperties->GetShaderIdentifier
@@ -1137,7 +1169,7 @@ int WINAPI WinMain(
 	HitGroupShaderTableBuffer.InitConfig.ptr_id3d12device_v5 = Device.GetInterface();
 	HitGroupShaderTableBuffer.InitConfig.d3d12_heap_properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_WRITE_COMBINE;
 	HitGroupShaderTableBuffer.InitConfig.d3d12_heap_properties.MemoryPoolPreference = D3D12_MEMORY_POOL_L0;
-	HitGroupShaderTableBuffer.InitConfig.d3d12_resource_description.Width = D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES;
+	HitGroupShaderTableBuffer.InitConfig.d3d12_resource_description.Width = sizeof(HitGroupShaderRecords);
 	HitGroupShaderTableBuffer.InitConfig.d3d12_resource_state = D3D12_RESOURCE_STATE_GENERIC_READ;
 	HitGroupShaderTableBuffer.Initialize();
 
@@ -1145,9 +1177,9 @@ int WINAPI WinMain(
 	MemCopyToUploadBuffer
 	(
 		HitGroupShaderTableBuffer.GetInterface(),
-		D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES,
-		HitGroupShaderIdentifier,
-		D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES
+		sizeof(HitGroupShaderRecords),
+		HitGroupShaderRecords,
+		sizeof(HitGroupShaderRecords)
 	);
 
 	// Miss shader table.
@@ -1177,7 +1209,7 @@ int WINAPI WinMain(
 	DispatchRaysDescription.RayGenerationShaderRecord.StartAddress = RayGenerationShaderTableBuffer.GetInterface()->GetGPUVirtualAddress();
 	DispatchRaysDescription.RayGenerationShaderRecord.SizeInBytes = D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES;
 	DispatchRaysDescription.HitGroupTable.StartAddress = HitGroupShaderTableBuffer.GetInterface()->GetGPUVirtualAddress();
-	DispatchRaysDescription.HitGroupTable.SizeInBytes = D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES;
+	DispatchRaysDescription.HitGroupTable.SizeInBytes = sizeof(HitGroupShaderRecords);
 	DispatchRaysDescription.HitGroupTable.StrideInBytes = D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES;
 	DispatchRaysDescription.MissShaderTable.StartAddress = MissShaderTableBuffer.GetInterface()->GetGPUVirtualAddress();
 	DispatchRaysDescription.MissShaderTable.SizeInBytes = D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES;
@@ -1206,7 +1238,7 @@ int WINAPI WinMain(
 		nullptr
 	);
 
-	// Prepare the resource state for shader access.
+	// Prepare the resource state for presenting the welcome mat, until the first pass has been traced.
 	InitializationCommandList.GetInterface()->ResourceBarrier
 	(
 		1,
@@ -1215,24 +1247,7 @@ int WINAPI WinMain(
 			IntersectionMap2DTexture.GetInterface(),
 			0,
 			D3D12_RESOURCE_STATE_COPY_DEST,
-			D3D12_RESOURCE_STATE_UNORDERED_ACCESS
-		)
-			)
-	);
-
-	// Copy the random numbers from shared memory to dedicated GPU memory and update the resource state for shader access.
-	InitializationCommandList.GetInterface()->CopyResource(
-		RandomNumberBuffer.GetInterface(),
-		RandomNumberUploadBuffer.GetInterface()
-	);
-
-	InitializationCommandList.GetInterface()->ResourceBarrier(
-		1,
-		&(CreateResourceTransitionBarrier(
-			RandomNumberBuffer.GetInterface(),
-			0,
-			D3D12_RESOURCE_STATE_COPY_DEST,
-			D3D12_RESOURCE_STATE_UNORDERED_ACCESS
+			D3D12_RESOURCE_STATE_COPY_SOURCE
 		)
 			)
 	);
@@ -1292,78 +1307,6 @@ int WINAPI WinMain(
 		nullptr
 	);
 
-	// Set the global root signature.
-	InitializationCommandList.GetInterface()->SetComputeRootSignature
-	(
-		IGlobalRootSignature.GetInterface()
-	);
-
-	// Set the descriptor heap.
-	ID3D12DescriptorHeap* pDescriptorHeap{ DescriptorHeap.GetInterface() };
-	InitializationCommandList.GetInterface()->SetDescriptorHeaps
-	(
-		1,
-		&pDescriptorHeap
-	);
-
-	// Set a root descriptor.
-	InitializationCommandList.GetInterface()->SetComputeRootShaderResourceView
-	(
-		0,
-		TLASResource.GetInterface()->GetGPUVirtualAddress()
-	);
-
-	// Set the descriptor table.
-	InitializationCommandList.GetInterface()->SetComputeRootDescriptorTable
-	(
-		1,
-		DescriptorHeap.GetInterface()->GetGPUDescriptorHandleForHeapStart()
-	);
-
-	// Set the global inline root constants.
-	InitializationCommandList.GetInterface()->SetComputeRoot32BitConstants
-	(
-		2,
-		InlineConstantsCount,
-		&InlineConstantBuffer,
-		0
-	);
-
-	// Set the pipeline state.
-	InitializationCommandList.GetInterface()->SetPipelineState1
-	(
-		StateObject_RaytracingPipeline.GetInterface()
-	);
-
-	// Time to dispatch some rays.
-	InitializationCommandList.GetInterface()->DispatchRays
-	(
-		&(DispatchRaysDescription)
-	);
-
-	// Change some resource states.
-	D3D12_RESOURCE_BARRIER UAVBarrier{};
-	UAVBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-	UAVBarrier.UAV.pResource = IntersectionMap2DTexture.GetInterface();
-
-	InitializationCommandList.GetInterface()->ResourceBarrier
-	(
-		1,
-		&UAVBarrier
-	);
-
-	InitializationCommandList.GetInterface()->ResourceBarrier
-	(
-		1,
-		&CreateResourceTransitionBarrier
-		(
-			IntersectionMap2DTexture.GetInterface(),
-			0,
-			D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
-			D3D12_RESOURCE_STATE_COPY_SOURCE
-		)
-	);
-
 	// Close and submit the list of commands, and wait for completion.
 	InitializationCommandList.GetInterface()->Close();
 
@@ -1544,6 +1487,37 @@ int WINAPI WinMain(
 
 
 
+	// Progressive rendering: each frame traces a pass of a few rays per pixel and presents the average so far, until RaysPerPixel of them have been accumulated.
+	// The schedule of the passes is shared with the CPU rendering path, via ProgressiveAccumulator.hpp.
+	ProgressiveAccumulator Accumulator{};
+	Accumulator.InitConfig.samples_per_pass = 4U;
+	Accumulator.InitConfig.target_sample_count = InlineConstantBuffer.RaysPerPixel;
+	Accumulator.Initialize();
+
+	// Command allocator and list for the passes, which get recorded again for each one, as their constants change.
+	WD3D12CommandAllocator0 PassCommandAllocator{};
+	PassCommandAllocator.InitConfig.unicode_debug_name = L"PassCommandAllocator";
+	PassCommandAllocator.InitConfig.ptr_id3d12device_v5 = Device.GetInterface();
+	PassCommandAllocator.InitConfig.d3d12_command_list_type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+	PassCommandAllocator.Initialize();
+
+	WD3D12GraphicsCommandList4 PassCommandList{};
+	PassCommandList.InitConfig.unicode_debug_name = L"PassCommandList";
+	PassCommandList.InitConfig.ptr_id3d12device_v5 = Device.GetInterface();
+	PassCommandList.InitConfig.ptr_id3d12commandallocator_v0 = PassCommandAllocator.GetInterface();
+	PassCommandList.InitConfig.ptr_id3d12pipelinestate_v0 = nullptr;
+	PassCommandList.InitConfig.d3d12_command_list_type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+	PassCommandList.InitConfig.node_mask = 0;
+	PassCommandList.Initialize();
+
+	PassCommandList.GetInterface()->Close();
+
+	ID3D12DescriptorHeap* pDescriptorHeap{ DescriptorHeap.GetInterface() };
+
+
+
+
+
 	// Main event loop of the application.
 	MSG MessageStruct{};
 	UINT FrameIndex{};	
@@ -1572,6 +1546,134 @@ int WINAPI WinMain(
 		{
 			FrameIndex = SwapChain.GetInterface()->GetCurrentBackBufferIndex();
 
+			// Trace the next pass, unless the image has already reached its target sample count.
+			if (Accumulator.BeginPass(&InlineConstantBuffer) == true)
+			{
+				WD3D12::FailCheck
+				(
+					PassCommandAllocator.GetInterface()->Reset(),
+					L"Resetting the pass command allocator failed",
+					L"Resetting the pass command allocator failed"
+				);
+
+				WD3D12::FailCheck
+				(
+					PassCommandList.GetInterface()->Reset
+					(
+						PassCommandAllocator.GetInterface(),
+						nullptr
+					),
+					L"Resetting the pass command list failed",
+					L"Resetting the pass command list failed"
+				);
+
+				// Prepare the resource state for shader access.
+				PassCommandList.GetInterface()->ResourceBarrier
+				(
+					1,
+					&CreateResourceTransitionBarrier
+					(
+						IntersectionMap2DTexture.GetInterface(),
+						0,
+						D3D12_RESOURCE_STATE_COPY_SOURCE,
+						D3D12_RESOURCE_STATE_UNORDERED_ACCESS
+					)
+				);
+
+				// Set the global root signature.
+				PassCommandList.GetInterface()->SetComputeRootSignature
+				(
+					IGlobalRootSignature.GetInterface()
+				);
+
+				// Set the descriptor heap.
+				PassCommandList.GetInterface()->SetDescriptorHeaps
+				(
+					1,
+					&pDescriptorHeap
+				);
+
+				// Set a root descriptor.
+				PassCommandList.GetInterface()->SetComputeRootShaderResourceView
+				(
+					0,
+					TLASResource.GetInterface()->GetGPUVirtualAddress()
+				);
+
+				// Set the descriptor table.
+				PassCommandList.GetInterface()->SetComputeRootDescriptorTable
+				(
+					1,
+					DescriptorHeap.GetInterface()->GetGPUDescriptorHandleForHeapStart()
+				);
+
+				// Set the global inline root constants, with the sample range of this pass.
+				PassCommandList.GetInterface()->SetComputeRoot32BitConstants
+				(
+					2,
+					InlineConstantsCount,
+					&InlineConstantBuffer,
+					0
+				);
+
+				// Set the material table's root descriptor.
+				PassCommandList.GetInterface()->SetComputeRootShaderResourceView
+				(
+					3,
+					MaterialBuffer.GetInterface()->GetGPUVirtualAddress()
+				);
+
+				// Set the pipeline state.
+				PassCommandList.GetInterface()->SetPipelineState1
+				(
+					StateObject_RaytracingPipeline.GetInterface()
+				);
+
+				// Time to dispatch some rays.
+				PassCommandList.GetInterface()->DispatchRays
+				(
+					&(DispatchRaysDescription)
+				);
+
+				// Change some resource states.
+				D3D12_RESOURCE_BARRIER UAVBarriers[2]{};
+				UAVBarriers[0].Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+				UAVBarriers[0].UAV.pResource = IntersectionMap2DTexture.GetInterface();
+				UAVBarriers[1].Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+				UAVBarriers[1].UAV.pResource = AccumulationBuffer2DTexture.GetInterface();
+
+				PassCommandList.GetInterface()->ResourceBarrier
+				(
+					2,
+					UAVBarriers
+				);
+
+				PassCommandList.GetInterface()->ResourceBarrier
+				(
+					1,
+					&CreateResourceTransitionBarrier
+					(
+						IntersectionMap2DTexture.GetInterface(),
+						0,
+						D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+						D3D12_RESOURCE_STATE_COPY_SOURCE
+					)
+				);
+
+				PassCommandList.GetInterface()->Close();
+
+				ID3D12CommandList* pPassCommandList{ PassCommandList.GetInterface() };
+
+				DirectCommandQueue.GetInterface()->ExecuteCommandLists
+				(
+					1,
+					&pPassCommandList
+				);
+
+				Accumulator.EndPass();
+			}
+
+			// Copy the Intersection Map to the back buffer.
 			DirectCommandQueue.GetInterface()->ExecuteCommandLists
 			(
 				1,
@@ -0,0 +1,129 @@
+// ProgressiveAccumulator.hpp (Header-Only) - Schedule of progressive rendering passes, shared by the DXR and CPU rendering paths.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include "SceneDescription.hpp"
+
+// Config data for this class.
+struct ProgressiveAccumulatorConfig
+{
+	// Samples per pixel traced by the passes that have finished.
+	unsigned int accumulated_sample_count;
+
+	// Samples per pixel being traced by the current pass.
+	unsigned int pass_sample_count;
+
+	// Number of passes that have finished.
+	unsigned int pass_count;
+
+	// Label for this class.
+	const char* name;
+};
+
+// Populate this before calling the initializer function.
+struct ProgressiveAccumulatorInitConfig
+{
+	// Samples per pixel to trace in each pass. Use 0 to trace all of them in a single pass.
+	unsigned int samples_per_pass;
+
+	// Samples per pixel after which the image is done, and no more passes are traced.
+	unsigned int target_sample_count;
+};
+
+// Splits the rendering of a frame into passes of a few samples per pixel each, which the ray generation shader adds up in the accumulation buffer.
+// Each pass publishes the average of every pass so far into the render target, so that an image shows up right away, and keeps refining until the target is reached.
+// Passes continue the sample sequences of each pixel where the previous pass stopped, so that the Sobol sampler stays stratified across them.
+class ProgressiveAccumulator
+{
+public:
+	ProgressiveAccumulator() : InitConfig{}, Config{}
+	{
+		this->Config.accumulated_sample_count = 0U;
+		this->Config.pass_sample_count = 0U;
+		this->Config.pass_count = 0U;
+		this->Config.name = "ProgressiveAccumulator";
+
+		this->InitConfig.samples_per_pass = 0U;
+		this->InitConfig.target_sample_count = 0U;
+	}
+
+	// Populate this before calling the initializer function.
+	ProgressiveAccumulatorInitConfig InitConfig;
+
+	// Initializes the instance of this class.
+	void Initialize()
+	{
+		if (this->InitConfig.samples_per_pass == 0U || this->InitConfig.samples_per_pass > this->InitConfig.target_sample_count)
+		{
+			this->InitConfig.samples_per_pass = this->InitConfig.target_sample_count;
+		}
+
+		this->Reset();
+	}
+
+	// Fills out the constants of the next pass. Returns false, and leaves them alone, once the target has been reached.
+	bool BeginPass(InlineConstantBuffer* pConstants)
+	{
+		if (this->IsConverged() == true)
+		{
+			return false;
+		}
+
+		unsigned int RemainingSampleCount = this->InitConfig.target_sample_count - this->Config.accumulated_sample_count;
+
+		this->Config.pass_sample_count = RemainingSampleCount < this->InitConfig.samples_per_pass ? RemainingSampleCount : this->InitConfig.samples_per_pass;
+
+		pConstants->FirstSampleIndex = this->Config.accumulated_sample_count;
+		pConstants->RaysPerPixel = this->Config.pass_sample_count;
+
+		return true;
+	}
+
+	// Marks the samples of the pass begun by BeginPass() as accumulated, once it has been traced.
+	void EndPass()
+	{
+		this->Config.accumulated_sample_count += this->Config.pass_sample_count;
+		this->Config.pass_sample_count = 0U;
+		this->Config.pass_count++;
+	}
+
+	// Starts over from the first sample, for when the camera or the scene has changed. The next pass overwrites the accumulation buffer.
+	void Reset()
+	{
+		this->Config.accumulated_sample_count = 0U;
+		this->Config.pass_sample_count = 0U;
+		this->Config.pass_count = 0U;
+	}
+
+	// Returns true once every sample of the target has been accumulated.
+	bool IsConverged() const
+	{
+		return this->Config.accumulated_sample_count >= this->InitConfig.target_sample_count;
+	}
+
+	// Returns the number of samples per pixel accumulated so far.
+	unsigned int GetAccumulatedSampleCount() const
+	{
+		return this->Config.accumulated_sample_count;
+	}
+
+	// Returns the number of passes traced since the last reset.
+	unsigned int GetPassCount() const
+	{
+		return this->Config.pass_count;
+	}
+
+	// Destructor.
+	~ProgressiveAccumulator()
+	{
+		// Nothing here, for now.
+	}
+
+protected:
+	// Config data for this object.
+	ProgressiveAccumulatorConfig Config;
+
+};
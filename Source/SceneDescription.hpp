@@ -0,0 +1,401 @@
+// SceneDescription.hpp (Header-Only) - Scene data shared by the DXR and CPU rendering paths.
+// October 2019
+// Chris M.
+// https://github.com/RealTimeChris
+
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Portable 3-component float vector, for describing the scene without DirectXMath.
+struct SceneFloat3
+{
+	float x, y, z;
+};
+
+// Portable 4-component float vector, laid out like XMFLOAT4.
+struct SceneFloat4
+{
+	float x, y, z, w;
+};
+
+// Portable 4x4 float matrix, laid out like XMMATRIX (row-major storage, row-vector convention).
+struct SceneFloat4x4
+{
+	float m[4][4];
+};
+
+// Global "Constant Buffer" structure to contain scene data for the shaders.
+// NOTE: Must match the layout of InlineConstantBuffer in CommonShaderStuff.h, as it is passed as global inline root constants.
+struct InlineConstantBuffer
+{
+	// Camera-to-World transform, for moving the camera around in world-space.
+	SceneFloat4x4 CameraToWorld;
+
+	// "Sky Color" at the top of the sky.
+	SceneFloat4 SkyTopColor;
+
+	// "Sky Color" at the bottom of the sky.
+	SceneFloat4 SkyBottomColor;
+
+	// Seed for the random numbers, so that different frames can get different ones.
+	unsigned int RandomSeed;
+
+	// Generator of the random numbers. (SamplerTypeRandom or SamplerTypeSobol.)
+	unsigned int SamplerType;
+
+	// Index of the first sample of this pass, within each pixel. The rays of a pass are added to the accumulation buffer, unless this is 0. (See ProgressiveAccumulator.hpp.)
+	unsigned int FirstSampleIndex;
+
+	// Standard error of a pixel's mean luminance below which it stops being traced, for adaptive sampling across passes. (0.0 traces every pixel with every pass.)
+	float AdaptiveThreshold;
+
+	// Vertical Field of View, in Radians.
+	float VertFoVRad;
+
+	// Max number of rays traced along a path: the camera ray, then one per bounce.
+	unsigned int MaxPathDepth;
+
+	// Number of rays a path traces before Russian roulette may end it. (0 traces every path until it misses, or reaches MaxPathDepth.)
+	unsigned int RouletteMinDepth;
+
+	// Number of Rays per pixel, in this pass.
+	unsigned int RaysPerPixel;
+};
+
+// Portable mirror of D3D12_RAYTRACING_INSTANCE_DESC, minus the bottom-level acceleration structure address.
+struct SceneInstanceDesc
+{
+	// Object-to-World transform, 3x4 row-major (column-vector convention, translation in the last column).
+	float Transform[3][4];
+
+	unsigned int InstanceID : 24;
+	unsigned int InstanceMask : 8;
+	unsigned int InstanceContributionToHitGroupIndex : 24;
+	unsigned int Flags : 8;
+};
+
+// Parameters of an instance's material. Both rendering paths keep one per instance in a material table, indexed by InstanceIndex(): the DXR path as a StructuredBuffer (see Materials in CommonShaderStuff.h), and the CPU path split into the per-field arrays CPUDXRPipeline keeps alongside its World-Space spheres (see WorldSphereArrays in CPUDXR.hpp), which the shaders read through GetInstanceMaterial().
+// The instance's hit group decides what they mean: Lambertian surfaces scatter with their albedo, metals reflect with theirs, fuzzed by their roughness, and glass refracts by its index of refraction, tinted by its albedo. 32 bytes, so that two of them fit in a cache line.
+struct SceneMaterial
+{
+	SceneFloat3 Albedo;
+	float Roughness;
+
+	// Radiance the surface emits, which gets added to every path that hits it, whatever its hit group.
+	SceneFloat3 Emission;
+	float IndexOfRefraction;
+};
+
+// Some values for material indexing, matching the order of the hit group shader table.
+const unsigned int LambertianHitGroupIndex{ 0 };
+const unsigned int MetallicHitGroupIndex{ 1 };
+const unsigned int DielectricHitGroupIndex{ 2 };
+
+// Generators for the random numbers of camera rays and their bounces, matching the ones in CommonShaderStuff.h.
+const unsigned int SamplerTypeRandom{ 0 };
+const unsigned int SamplerTypeSobol{ 1 };
+
+// Samples a pixel needs before adaptive sampling may consider it converged, matching the one in CommonShaderStuff.h.
+const unsigned int AdaptiveMinSampleCount{ 16 };
+
+// First group of sample dimensions that Russian roulette draws from, past those of every bounce, matching the one in CommonShaderStuff.h.
+const unsigned int RouletteSampleGroup{ 0x10000 };
+
+// Instance flag values, matching D3D12_RAYTRACING_INSTANCE_FLAGS.
+const unsigned int SceneInstanceFlagForceOpaque{ 0x4 };
+
+// Number of instances in the default scene.
+const unsigned int DefaultSceneInstanceCount{ 2 };
+
+// Builds a Camera-to-World transform, equivalent to XMMatrixInverse(XMMatrixLookAtLH(...)).
+inline SceneFloat4x4 GetCameraToWorld
+(
+	SceneFloat3 CameraPosition,
+	SceneFloat3 FocusPoint,
+	SceneFloat3 UpDirection
+)
+{
+	// Forward axis.
+	SceneFloat3 z{ FocusPoint.x - CameraPosition.x, FocusPoint.y - CameraPosition.y, FocusPoint.z - CameraPosition.z };
+	float zLength = std::sqrt(z.x * z.x + z.y * z.y + z.z * z.z);
+	z = { z.x / zLength, z.y / zLength, z.z / zLength };
+
+	// Right axis.
+	SceneFloat3 x{ UpDirection.y * z.z - UpDirection.z * z.y, UpDirection.z * z.x - UpDirection.x * z.z, UpDirection.x * z.y - UpDirection.y * z.x };
+	float xLength = std::sqrt(x.x * x.x + x.y * x.y + x.z * x.z);
+	x = { x.x / xLength, x.y / xLength, x.z / xLength };
+
+	// Up axis.
+	SceneFloat3 y{ z.y * x.z - z.z * x.y, z.z * x.x - z.x * x.z, z.x * x.y - z.y * x.x };
+
+	SceneFloat4x4 CameraToWorld
+	{
+		{
+			{ x.x, x.y, x.z, 0.0f },
+			{ y.x, y.y, y.z, 0.0f },
+			{ z.x, z.y, z.z, 0.0f },
+			{ CameraPosition.x, CameraPosition.y, CameraPosition.z, 1.0f }
+		}
+	};
+
+	return CameraToWorld;
+}
+
+// Camera-to-World transform of the default scene's camera, after orbiting it by OrbitRadians around the vertical axis through the point it looks at.
+inline SceneFloat4x4 GetDefaultCameraToWorld
+(
+	float OrbitRadians
+)
+{
+	return GetCameraToWorld
+	(
+		SceneFloat3{ 30.0001f * std::sin(OrbitRadians), 20.0f, 30.0001f * std::cos(OrbitRadians) },
+		SceneFloat3{ 0.0f, 0.0f, 0.0f },
+		SceneFloat3{ 0.0f, +1.0f, 0.0f }
+	);
+}
+
+// Fills out the scene and rendering constants of the default scene.
+inline void GetDefaultSceneConstants
+(
+	InlineConstantBuffer* pConstants
+)
+{
+	*pConstants = InlineConstantBuffer{};
+
+	// Camera-to-World transform, for moving the camera around in world-space.
+	pConstants->CameraToWorld = GetDefaultCameraToWorld(0.0f);
+
+	// "Sky Color" at the top of the sky.
+	pConstants->SkyTopColor = SceneFloat4{ 0.0f, 0.502f, 1.0f, 0.0f };
+
+	// "Sky Color" at the bottom of the sky.
+	pConstants->SkyBottomColor = SceneFloat4{ 1.0f, 1.0f, 1.0f, 0.0f };
+
+	// Seed for the random numbers.
+	pConstants->RandomSeed = 0U;
+
+	// Owen-scrambled Sobol points, which converge with far fewer rays per pixel than independent random numbers.
+	pConstants->SamplerType = SamplerTypeSobol;
+
+	// All of the rays in one pass.
+	pConstants->FirstSampleIndex = 0U;
+
+	// No adaptive sampling.
+	pConstants->AdaptiveThreshold = 0.0f;
+
+	// Vertical field-of-view in radians. (90 degrees)
+	pConstants->VertFoVRad = 1.57079632679f;
+
+	// Max Path Depth.
+	pConstants->MaxPathDepth = 31U;
+
+	// Russian Roulette Min Depth.
+	pConstants->RouletteMinDepth = 8U;
+
+	// Number of Rays per pixel.
+	pConstants->RaysPerPixel = 500U;
+}
+
+// Material that scatters like a Lambertian surface of the given gray albedo, and emits nothing.
+inline SceneMaterial GetLambertianMaterial(float Albedo)
+{
+	return SceneMaterial{ { Albedo, Albedo, Albedo }, 0.0f, { 0.0f, 0.0f, 0.0f }, 1.0f };
+}
+
+// Fills out the materials of the default scene's instances. (pMaterials must hold DefaultSceneInstanceCount elements.)
+inline void GetDefaultSceneMaterials
+(
+	SceneMaterial* pMaterials
+)
+{
+	// The planet and the ground both reflect half of the light they get.
+	pMaterials[0] = GetLambertianMaterial(0.5f);
+	pMaterials[1] = GetLambertianMaterial(0.5f);
+}
+
+// Fills out the instance descriptions of the default scene. (pInstances must hold DefaultSceneInstanceCount elements.)
+inline void GetDefaultSceneInstances
+(
+	SceneInstanceDesc* pInstances
+)
+{
+	// Instance description of the planet sphere.
+	pInstances[0] = SceneInstanceDesc
+	{
+		{
+			{ +7.0f, 0.0f, 0.0f, 0.0f },
+			{ 0.0f, +7.0f, 0.0f, +8.0f },
+			{ 0.0f, 0.0f, +7.0f, 0.0f }
+		},
+		1,				// InstanceID
+		0b0000'0001,	// InstanceMask
+		LambertianHitGroupIndex,
+		SceneInstanceFlagForceOpaque
+	};
+
+	// Instance description of the other sphere.
+	pInstances[1] = SceneInstanceDesc
+	{
+		{
+			{ +300.0f, 0.0f, 0.0f, 0.0f },
+			{ 0.0f, +300.0f, 0.0f, -300.0f },
+			{ 0.0f, 0.0f, +300.0f, 0.0f }
+		},
+		2,				// InstanceID
+		0b0000'0010,	// InstanceMask
+		LambertianHitGroupIndex,
+		SceneInstanceFlagForceOpaque
+	};
+}
+
+// Fills out the default scene, plus SphereCount small spheres scattered over the ground sphere around the planet.
+// For stress-testing the acceleration structures with large instance counts.
+inline void GetScatteredSceneInstances
+(
+	std::vector<SceneInstanceDesc>* pInstances,
+	unsigned int SphereCount,
+	unsigned int Seed
+)
+{
+	pInstances->resize(DefaultSceneInstanceCount + (size_t)SphereCount);
+
+	GetDefaultSceneInstances(pInstances->data());
+
+	// Keep roughly the same density as the count grows, up to the edge of the ground sphere's cap.
+	float ScatterRadius = std::fmin(10.0f + std::sqrt((float)SphereCount), 250.0f);
+
+	std::mt19937 Generator{ Seed };
+	std::uniform_real_distribution<float> Unit{ 0.0f, 1.0f };
+
+	for (unsigned int i = 0; i < SphereCount; i++)
+	{
+		float Radius = 0.2f + 0.4f * Unit(Generator);
+
+		// Uniform point on the disc, outside of the planet's footprint.
+		float x{}, z{};
+
+		do
+		{
+			float r = ScatterRadius * std::sqrt(Unit(Generator));
+			float Angle = 6.28318530718f * Unit(Generator);
+
+			x = r * std::cos(Angle);
+			z = r * std::sin(Angle);
+		}
+		while ((x * x) + (z * z) < 8.0f * 8.0f);
+
+		// Rest it on the ground sphere. (Radius 300, centered at y = -300.)
+		float y = -300.0f + std::sqrt((300.0f * 300.0f) - (x * x) - (z * z)) + Radius;
+
+		(*pInstances)[DefaultSceneInstanceCount + i] = SceneInstanceDesc
+		{
+			{
+				{ Radius, 0.0f, 0.0f, x },
+				{ 0.0f, Radius, 0.0f, y },
+				{ 0.0f, 0.0f, Radius, z }
+			},
+			0,				// InstanceID (Unused: every ray gets traced with a mask of ~0, and keeps off the sphere it leaves by only hitting spheres where it enters them.)
+			0b1111'1111,	// InstanceMask
+			LambertianHitGroupIndex,
+			SceneInstanceFlagForceOpaque
+		};
+	}
+}
+
+// Fills out the material table of the scene of GetScatteredSceneInstances(), one material per instance, and turns the scattered spheres into a mix of materials:
+// about MetallicFraction of them Metallic, DielectricFraction of them Dielectric and EmissiveFraction of them glowing Lambertian spheres, the rest staying plain Lambertian ones.
+// Each sphere's material only depends on its index, so that the same spheres keep their materials as the fractions grow. Metals get a roughness in [0.0, 0.5] and an albedo in [0.6, 1.0], and glasses an index of refraction in [1.3, 1.8], from the rest of the hash.
+inline void SetScatteredSceneMaterials
+(
+	std::vector<SceneInstanceDesc>* pInstances,
+	std::vector<SceneMaterial>* pMaterials,
+	float MetallicFraction,
+	float DielectricFraction,
+	float EmissiveFraction
+)
+{
+	pMaterials->resize(pInstances->size());
+
+	GetDefaultSceneMaterials(pMaterials->data());
+
+	for (size_t i = DefaultSceneInstanceCount; i < pInstances->size(); i++)
+	{
+		// Hash of the index, mapped to [0, 1).
+		unsigned int Hash = (unsigned int)i * 2654435761U;
+		Hash ^= Hash >> 16;
+		Hash *= 0x7FEB352DU;
+		Hash ^= Hash >> 15;
+
+		float Unit = (float)(Hash >> 8) / 16777216.0f;
+
+		// Two more values in [0, 1), for the material's parameters.
+		unsigned int ParameterHash = Hash * 0x846CA68BU;
+		ParameterHash ^= ParameterHash >> 16;
+
+		float FirstParameter = (float)(ParameterHash & 0xFFFF) / 65536.0f;
+		float SecondParameter = (float)(ParameterHash >> 16) / 65536.0f;
+
+		SceneInstanceDesc& Instance = (*pInstances)[i];
+		SceneMaterial& Material = (*pMaterials)[i];
+
+		Instance.InstanceContributionToHitGroupIndex = LambertianHitGroupIndex;
+		Material = GetLambertianMaterial(0.5f);
+
+		if (Unit < MetallicFraction)
+		{
+			float Albedo = 0.6f + 0.4f * SecondParameter;
+
+			Instance.InstanceContributionToHitGroupIndex = MetallicHitGroupIndex;
+			Material.Albedo = SceneFloat3{ Albedo, Albedo, Albedo };
+			Material.Roughness = 0.5f * FirstParameter;
+		}
+		else if (Unit < MetallicFraction + DielectricFraction)
+		{
+			Instance.InstanceContributionToHitGroupIndex = DielectricHitGroupIndex;
+			Material.Albedo = SceneFloat3{ 1.0f, 1.0f, 1.0f };
+			Material.IndexOfRefraction = 1.3f + 0.5f * FirstParameter;
+		}
+		else if (Unit < MetallicFraction + DielectricFraction + EmissiveFraction)
+		{
+			// Warm white light, a few times brighter than the sky.
+			Material.Emission = SceneFloat3{ 4.0f, 3.2f, 2.4f };
+		}
+	}
+}
+
+// Moves the first MovingCount scattered spheres of GetScatteredSceneInstances() to where they are at the given time: orbiting the planet at their own speeds, and bouncing on the ground sphere.
+// RestInstances is the unanimated scene, which pInstances must be a copy of.
+inline void AnimateScatteredSceneInstances
+(
+	const std::vector<SceneInstanceDesc>& RestInstances,
+	unsigned int MovingCount,
+	float Time,
+	std::vector<SceneInstanceDesc>* pInstances
+)
+{
+	for (unsigned int i = 0; i < MovingCount && DefaultSceneInstanceCount + i < RestInstances.size(); i++)
+	{
+		const SceneInstanceDesc& Rest = RestInstances[DefaultSceneInstanceCount + i];
+		SceneInstanceDesc& Moving = (*pInstances)[DefaultSceneInstanceCount + i];
+
+		float Radius = Rest.Transform[0][0];
+		float RestX = Rest.Transform[0][3];
+		float RestZ = Rest.Transform[2][3];
+
+		// Spheres orbit at different speeds, so that neighbors drift apart over time.
+		float Speed = 0.05f + 0.1f * (float)(((i * 2654435761U) >> 16) & 0xFF) / 255.0f;
+		float Angle = Speed * Time;
+
+		float x = (RestX * std::cos(Angle)) - (RestZ * std::sin(Angle));
+		float z = (RestX * std::sin(Angle)) + (RestZ * std::cos(Angle));
+		float Bounce = 2.0f * Radius * std::fabs(std::sin((3.0f * Time) + (float)i));
+
+		Moving.Transform[0][3] = x;
+		Moving.Transform[1][3] = -300.0f + std::sqrt((300.0f * 300.0f) - (x * x) - (z * z)) + Radius + Bounce;
+		Moving.Transform[2][3] = z;
+	}
+}